@@ -0,0 +1,617 @@
+/*
+	FileName : Benchmark.cpp
+	Project Color Cuberator
+
+	PURPOSE:
+		To time each phase of the client separately, populating the cube, searching it for its
+		largest contiguous blocks, printing the largest block and printing the color statistics,
+		over a range of cube sizes, palettes and color distributions. The results are the
+		baseline any change to the cube, the list or the searches is held against.
+
+	INPUT:
+		Everything may be given on the command line:
+			Benchmark [-max edge] [-warmup amount] [-repeat amount] [-threads amount] [-runs]
+				[-packed] [-tiled] [-chunked] [-sparse] [-out file]
+			-max	The largest edge benched, cubes of every size in BENCH_SIZES up to it are run.
+					DEFAULT_MAX_EDGE is used when none is given, 1024 runs every size
+			-warmup	The amount of untimed runs of a phase before it is timed
+			-repeat	The amount of timed runs of a phase
+			-threads	Populate and label with the given amount of threads, 0 uses every core
+			-runs	Label by runs of cells instead of cell by cell
+			-packed	Store the cube as packed planes instead of a CellRec per cell
+			-tiled	Store the cube as bricks of cells in Morton order instead of row major
+			-chunked	Store the cube as chunks, a chunk of one color kept as that color alone
+			-sparse	Store the cube as a hash table of the chunks that hold a type
+			-out	Write the results to the named file instead of BENCH_FILE_NAME
+
+	PROCESSING:
+		For every size a cube is made once and PopulateCube is timed on it. Then for every
+		palette in BENCH_PALETTES and every distribution the cube is given that palette and
+		distribution (untimed) and the search, PrintContig and ColorStats are timed on it
+		Every phase is run warmup times untimed, then repeat times timed, and the median,
+		95th percentile, fastest and mean time are kept
+		The search is the client's label search, the cube is labeled, the two largest blocks
+		are found and their cells are gathered
+		The flood is the client's original flood search on the same cube, timed on cubes up
+		to FLOOD_MAX_EDGE. Each run starts with ClearStatus (untimed), so the cube is searched
+		again without being rebuilt
+		PrintContig and ColorStats write through a text ReportWriterClass to BENCH_SCRATCH_NAME,
+		which is emptied before each run
+
+	OUTPUT:
+		A table of every phase is displayed as it finishes
+		The results are also written to BENCH_FILE_NAME as CSV, one line per phase of each case:
+			edge,cells,palette,distribution,phase,runs,median_ms,p95_ms,min_ms,mean_ms
+		PopulateCube does not depend on the palette or distribution, it is timed once per size
+		and listed with DEFAULT_COLOR_AMT colors and the uniform distribution
+
+	ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+		1 - The benchmark is built with ContigClient.cpp compiled with CUBE_BENCHMARK defined,
+			so the phases timed are the client's own functions
+		2 - The cube of the largest size asked for fits in memory, a 1024^3 cube needs several GB
+		3 - Every palette in BENCH_PALETTES has from MIN_PALETTE_AMT to MAX_PALETTE_AMT colors,
+			the last being the largest. The cube is made to hold the largest, so a packed cube
+			keeps 16 bit planes for every palette
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1 - If the command line options are not valid a usage message is displayed and the
+			program ends
+		2 - If the results file can not be written a message is displayed and the program ends
+
+						   SUMMARY OF FUNCTIONS:
+ReadBenchArguments(*IN*int argc,
+				   *IN*char* argv[],
+				   *OUT*BenchOptionsRec& options)
+		- To read the sizes, runs and cube options to bench from the command line
+BenchSize(*IN*const BenchOptionsRec& options,
+		  *IN*const int& edge,
+		  *IN/OUT*ofstream& bout)
+		- To time every phase for every palette and distribution of a single cube size
+ApplyDistribution(*IN/OUT*CubeClass& colCube,
+				  *IN*const int& palette,
+				  *IN*const DistributionEnum& dist,
+				  *OUT*ColorArr& colArr)
+		- To give every cell of the cube a color of a palette in a distribution
+TimePhase(*IN*const BenchOptionsRec& options,
+		  *IN*const function<void()>& prepare,
+		  *IN*const function<void()>& phase)
+		- To time the runs of a single phase and summarize them
+ReportPhase(*IN*const int& edge,
+			*IN*const int& palette,
+			*IN*const DistributionEnum& dist,
+			*IN*const PhaseEnum& phase,
+			*IN*const TimingRec& timing,
+			*IN/OUT*ofstream& bout)
+		- To output the times of a single phase to the display and the results file
+DistributionName(*IN*const DistributionEnum& dist)
+		- To convert a distribution to its name
+PhaseName(*IN*const PhaseEnum& phase)
+		- To convert a phase to its name
+*/
+#include "ContigClient.h"	// Grants Access to the options and functions of the client
+#include <chrono>		// Used to time each run
+#include <functional>	// Used to pass each phase to be timed
+#include <vector>		// Used to hold the time of each run
+#include <cstdio>		// Used to remove the scratch file
+using namespace std;	// Standard namespace
+
+
+
+// Constants
+const int BENCH_SIZES[] = { 5, 16, 32, 64, 128, 256, 512, 1024 };	// The edges of the cubes benched
+const int BENCH_SIZE_AMT = 8;			// The amount of edges in BENCH_SIZES
+const int BENCH_PALETTES[] = { 2, 3, DEFAULT_COLOR_AMT, 1024 };	// The amounts of colors benched
+const int BENCH_PALETTE_AMT = 4;		// The amount of palettes in BENCH_PALETTES
+const int BENCH_MAX_PALETTE = BENCH_PALETTES[BENCH_PALETTE_AMT - OFFSET];	// The largest palette benched
+const int DEFAULT_MAX_EDGE = 256;		// The largest edge benched when none is given
+const int FLOOD_MAX_EDGE = 256;			// The largest edge the flood search is timed on, its list holds every cell
+const int DEFAULT_WARMUP = 1;			// The untimed runs of a phase when none are given
+const int DEFAULT_REPEAT = 5;			// The timed runs of a phase when none are given
+const int CLUSTER_EDGE = 8;				// The edge of the tiles of a clustered cube
+const int CLUSTER_NOISE = 10;			// The percent of cells of a clustered cube not given their tile's color
+const int PERCENTILE = 95;				// The percentile reported with the median
+const double MS_PER_SECOND = 1000.0;	// Converts seconds to milliseconds
+const string BENCH_FILE_NAME = "Benchmark.csv";		// The results file name
+const string BENCH_SCRATCH_NAME = "Benchmark.tmp";	// The file the printing phases write to
+
+
+// The ways the colors of a benched cube can be spread
+//		UNIFORM_DIST - Every color is as likely, as PopulateCube gives
+//		SKEWED_DIST - Each color is half as likely as the one before, the last takes what is left
+//		CLUSTERED_DIST - Tiles of CLUSTER_EDGE cells share a color, with CLUSTER_NOISE percent random
+enum DistributionEnum { UNIFORM_DIST, SKEWED_DIST, CLUSTERED_DIST };
+const int DIST_AMT = 3;		// The amount of distributions
+
+
+// The phases of the client that are timed
+enum PhaseEnum { POPULATE_PHASE, SEARCH_PHASE, FLOOD_PHASE, PRINT_PHASE, STATS_PHASE };
+
+
+// Struct to contain the options chosen on the command line
+struct BenchOptionsRec
+{
+	int maxEdge;			// The largest edge benched
+	int warmup;				// The untimed runs of a phase
+	int repeat;				// The timed runs of a phase
+	int threadAmt;			// The amount of threads to populate and label with
+	LabelMethodEnum method;	// How the labeler gives provisional labels
+	StorageEnum storage;	// How the cells of the cube are stored
+	string outName;			// The results file
+};
+
+
+// Struct to contain the summary of the timed runs of a phase, in milliseconds
+struct TimingRec
+{
+	int runs;			// The amount of timed runs
+	double median;		// The middle run
+	double p95;			// The run PERCENTILE percent of the runs are no slower than
+	double fastest;		// The fastest run
+	double mean;		// The average run
+};
+
+
+
+// Prototypes
+bool ReadBenchArguments(/*IN*/int,				// The amount of command line arguments
+						/*IN*/char*[],			// The command line arguments
+						/*OUT*/BenchOptionsRec&);	// The options chosen
+void BenchSize(/*IN*/const BenchOptionsRec&,	// The options chosen
+			   /*IN*/const int&,				// The edge of the cube
+			   /*IN/OUT*/ofstream&);			// The results file
+void ApplyDistribution(/*IN/OUT*/CubeClass&,	// The cube being colored
+					   /*IN*/const int&,		// The amount of colors
+					   /*IN*/const DistributionEnum&,	// How the colors are spread
+					   /*OUT*/ColorArr&);		// The amount of each color
+TimingRec TimePhase(/*IN*/const BenchOptionsRec&,	// The options holding the runs
+					/*IN*/const function<void()>&,	// Readies a run, untimed
+					/*IN*/const function<void()>&);	// The run being timed
+void ReportPhase(/*IN*/const int&,				// The edge of the cube
+				 /*IN*/const int&,				// The amount of colors
+				 /*IN*/const DistributionEnum&,	// How the colors are spread
+				 /*IN*/const PhaseEnum&,		// The phase timed
+				 /*IN*/const TimingRec&,		// The times of the phase
+				 /*IN/OUT*/ofstream&);			// The results file
+string DistributionName(/*IN*/const DistributionEnum&);	// The distribution
+string PhaseName(/*IN*/const PhaseEnum&);		// The phase
+
+
+
+
+int main(int argc, char* argv[])
+{
+	BenchOptionsRec options;	// The options chosen on the command line
+	ofstream bout;				// The results file
+
+	if (!ReadBenchArguments(argc, argv, options))
+	{
+		cerr << "Usage: " << argv[ZERO] << " [-max edge] [-warmup amount] [-repeat amount]"
+			 << " [-threads amount] [-runs] [-packed] [-tiled] [-chunked]"
+			 << " [-sparse] [-out file]" << endl;
+		return 1;
+	}
+
+	bout.open(options.outName);
+	if (!bout)
+	{
+		cerr << "Unable to write " << options.outName << endl;
+		return 1;
+	}
+
+	bout << "edge,cells,palette,distribution,phase,runs,median_ms,p95_ms,min_ms,mean_ms\n";
+
+	cout << left << setw(6) << "Edge" << setw(9) << "Palette" << setw(11) << "Dist"
+		 << setw(10) << "Phase" << right << setw(12) << "Median ms" << setw(12) << "P95 ms"
+		 << setw(12) << "Min ms" << "\n";
+
+	// Bench every size up to the largest asked for
+	for (int i = 0; i < BENCH_SIZE_AMT && BENCH_SIZES[i] <= options.maxEdge; i++)
+		BenchSize(options, BENCH_SIZES[i], bout);
+
+	bout.close();
+	remove(BENCH_SCRATCH_NAME.c_str());
+
+}// end main
+
+
+
+
+
+// --------------------------------- FUNCTIONS ------------------------------------------
+
+
+//O(N)
+//Purpose: To read the sizes, runs and cube options to bench from the command line
+//Pre: The command line arguments
+//Post: options holds the options chosen, the defaults are used for any not given.
+//		Returns false if the arguments are invalid
+bool ReadBenchArguments(/*IN*/int argc,					// The amount of command line arguments
+						/*IN*/char* argv[],				// The command line arguments
+						/*OUT*/BenchOptionsRec& options)	// The options chosen
+{
+	options.maxEdge = DEFAULT_MAX_EDGE;
+	options.warmup = DEFAULT_WARMUP;
+	options.repeat = DEFAULT_REPEAT;
+	options.threadAmt = OFFSET;
+	options.method = CELL_LABELING;
+	options.storage = RECORD_STORAGE;
+	options.outName = BENCH_FILE_NAME;
+
+	// Cycle through each argument after the program name
+	for (int i = OFFSET; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-max") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.maxEdge = atoi(argv[i]);
+
+			if (options.maxEdge < BENCH_SIZES[ZERO])
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-warmup") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.warmup = atoi(argv[i]);
+
+			if (options.warmup < ZERO)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-repeat") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.repeat = atoi(argv[i]);
+
+			if (options.repeat <= ZERO)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-threads") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.threadAmt = atoi(argv[i]);
+
+			// Zero uses every core of the machine
+			if (options.threadAmt == ZERO)
+				options.threadAmt = (int)thread::hardware_concurrency();
+
+			if (options.threadAmt <= ZERO)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-runs") == ZERO)
+			options.method = RUN_LABELING;
+
+		else if (strcmp(argv[i], "-packed") == ZERO)
+			options.storage = PACKED_STORAGE;
+
+		else if (strcmp(argv[i], "-tiled") == ZERO)
+			options.storage = TILED_STORAGE;
+
+		else if (strcmp(argv[i], "-chunked") == ZERO)
+			options.storage = CHUNKED_STORAGE;
+
+		else if (strcmp(argv[i], "-sparse") == ZERO)
+			options.storage = SPARSE_STORAGE;
+
+		else if (strcmp(argv[i], "-out") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.outName = argv[i];
+		}
+
+		else
+			return false;
+	}
+
+	return true;
+}// end ReadBenchArguments
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(P * D * R * N^3) : P palettes, D distributions and R runs of each phase
+//Purpose: To time every phase for every palette and distribution of a single cube size
+//Pre: The options chosen, the edge of the cube, the results file is open
+//Post: Every phase has been timed and reported, PopulateCube once and the others for
+//		every palette and distribution
+void BenchSize(/*IN*/const BenchOptionsRec& options,	// The options chosen
+			   /*IN*/const int& edge,					// The edge of the cube
+			   /*IN/OUT*/ofstream& bout)				// The results file
+{
+	CubeClass colorCube(edge, edge, edge, options.storage, BENCH_MAX_PALETTE);	// The cube being benched
+	ColorArr colorArr;				// The amount of each color
+	LabelerClass labeler;			// Labels every contiguous block of the cube
+	int largLabel;					// The label of the largest contiguous block
+	int secLargLabel;				// The label of the second largest contiguous block
+	int largCol = RED;				// The color of the largest contiguous block
+	PaletteClass palette(BENCH_MAX_PALETTE);	// The name of every color of every palette benched
+	TimingRec timing;				// The times of the current phase
+	DistributionEnum dist;			// The current distribution
+	int floodCells = edge <= FLOOD_MAX_EDGE ? (int)colorCube.GetCellCount() : OFFSET;	// The most cells a flood list holds
+	ListClass floodLargList(floodCells);	// Holds the cells of the largest block of the flood search
+	ListClass floodSecLargList(floodCells);	// Holds the cells of the second largest block of the flood search
+
+	ReportWriterClass scratch(palette.GetNames(), TEXT_REPORT);	// Writes the printing phases to their file
+
+	// ---------------- PopulateCube -----------------
+
+	timing = TimePhase(options, [&] { InitializeColorArray(colorArr, DEFAULT_COLOR_AMT); },
+					   [&] { PopulateCube(colorCube, colorArr, options.threadAmt, SEED); });
+	ReportPhase(edge, DEFAULT_COLOR_AMT, UNIFORM_DIST, POPULATE_PHASE, timing, bout);
+
+	labeler.SetMethod(options.method);
+
+	for (int p = 0; p < BENCH_PALETTE_AMT; p++)
+	{
+		for (int d = 0; d < DIST_AMT; d++)
+		{
+			dist = (DistributionEnum)d;
+			ApplyDistribution(colorCube, BENCH_PALETTES[p], dist, colorArr);
+
+			// Label once untimed to size the lists for the largest blocks
+			labeler.Label(colorCube, options.threadAmt);
+			labeler.FindLargest(largLabel, secLargLabel);
+
+			ListClass largContigList(largLabel == NO_LABEL ? OFFSET : labeler.GetComponent(largLabel).size);
+													// Holds the cells of the largest block
+			ListClass secLargContigList(secLargLabel == NO_LABEL ? OFFSET : labeler.GetComponent(secLargLabel).size);
+													// Holds the cells of the second largest block
+
+			// ---------------- The Label Search -----------------
+
+			timing = TimePhase(options, [] {}, [&]
+			{
+				labeler.Label(colorCube, options.threadAmt);
+				labeler.FindLargest(largLabel, secLargLabel);
+
+				if (largLabel != NO_LABEL)
+					labeler.GetComponentCells(largLabel, largContigList);
+
+				if (secLargLabel != NO_LABEL)
+					labeler.GetComponentCells(secLargLabel, secLargContigList);
+			});
+			ReportPhase(edge, BENCH_PALETTES[p], dist, SEARCH_PHASE, timing, bout);
+
+			// ---------------- The Flood Search -----------------
+
+			// Every run searches the same cube, clearing the status of every cell at once
+			if (edge <= FLOOD_MAX_EDGE)
+			{
+				timing = TimePhase(options, [&]
+				{
+					colorCube.ClearStatus();
+					floodLargList.Clear();
+					floodSecLargList.Clear();
+
+					for (int i = 0; i < colorArr.GetColorAmt(); i++)
+						colorArr[i][OFFSET] = ZERO;
+				}, [&]
+				{
+					FloodSearch(colorCube, colorArr, floodLargList, floodSecLargList);
+				});
+				ReportPhase(edge, BENCH_PALETTES[p], dist, FLOOD_PHASE, timing, bout);
+			}
+
+			if (largLabel != NO_LABEL)
+				largCol = labeler.GetComponent(largLabel).type;
+
+			// ---------------- PrintContig -----------------
+
+			// Each run writes to an empty file, as the client does
+			timing = TimePhase(options, [&]
+			{
+				scratch.Open(BENCH_SCRATCH_NAME);
+			}, [&]
+			{
+				PrintContig(largContigList, largCol, edge, edge, edge, scratch);
+				scratch.Flush();
+			});
+			ReportPhase(edge, BENCH_PALETTES[p], dist, PRINT_PHASE, timing, bout);
+
+			// ---------------- ColorStats -----------------
+
+			timing = TimePhase(options, [&]
+			{
+				scratch.Open(BENCH_SCRATCH_NAME);
+			}, [&]
+			{
+				ColorStats(colorArr, colorCube.GetCellCount(), scratch);
+				scratch.Flush();
+			});
+			ReportPhase(edge, BENCH_PALETTES[p], dist, STATS_PHASE, timing, bout);
+
+			scratch.Close();
+		}
+	}
+}// end BenchSize
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To give every cell of the cube a color of a palette in a distribution
+//Pre: The cube, the amount of colors from MIN_PALETTE_AMT to BENCH_MAX_PALETTE and the distribution
+//Post: Every cell holds one of the first palette colors spread by dist, the color array
+//		holds the amount of each color. The uniform distribution of DEFAULT_COLOR_AMT colors is
+//		the cube PopulateCube gives with SEED
+void ApplyDistribution(/*IN/OUT*/CubeClass& colCube,		// The cube being colored
+					   /*IN*/const int& palette,			// The amount of colors
+					   /*IN*/const DistributionEnum& dist,	// How the colors are spread
+					   /*OUT*/ColorArr& colArr)				// The amount of each color
+{
+	vector<int> blockTypes(POPULATE_BLOCK);	// The colors of the current block
+	size_t planeSize = (size_t)colCube.GetCols() * colCube.GetDeps();	// The cells in a row of the cube
+	size_t cellIndex;		// The linear index of the current cell
+	size_t amount;			// The amount of cells in the block
+	uint64_t random;		// The random number of the current cell
+	size_t tile;			// The tile of the current cell
+	size_t tileCols = (colCube.GetCols() + CLUSTER_EDGE - OFFSET) / CLUSTER_EDGE;	// The tiles along y
+	size_t tileDeps = (colCube.GetDeps() + CLUSTER_EDGE - OFFSET) / CLUSTER_EDGE;	// The tiles along z
+	int type;				// The color of the current cell
+
+	InitializeColorArray(colArr, palette);
+
+	for (size_t first = 0; first < colCube.GetCellCount(); first += POPULATE_BLOCK)
+	{
+		amount = min(POPULATE_BLOCK, colCube.GetCellCount() - first);
+
+		for (size_t i = 0; i < amount; i++)
+		{
+			cellIndex = first + i;
+			random = MixCell(SEED, cellIndex);
+
+			if (dist == SKEWED_DIST)
+			{
+				// Each one bit from the bottom moves on to the next color
+				type = ZERO;
+				while (type < palette - OFFSET && (random >> type) & OFFSET)
+					type++;
+			}
+			else if (dist == CLUSTERED_DIST && (int)((uint32_t)random % PERCENT_CONVERTER) >= CLUSTER_NOISE)
+			{
+				tile = ((cellIndex / planeSize / CLUSTER_EDGE) * tileCols
+						+ (cellIndex / colCube.GetDeps() % colCube.GetCols()) / CLUSTER_EDGE) * tileDeps
+						+ (cellIndex % colCube.GetDeps()) / CLUSTER_EDGE;
+				type = RandomCellType(SEED + OFFSET, tile, palette);
+			}
+			else
+				type = RandomCellType(SEED, cellIndex, palette);
+
+			blockTypes[i] = type;
+			colArr[type][ZERO]++;
+		}
+
+		colCube.SetCellTypes(first, amount, blockTypes.data());
+	}
+}// end ApplyDistribution
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(R * phase)
+//Purpose: To time the runs of a single phase and summarize them
+//Pre: The options holding the amount of warmup and timed runs, what readies a run and the run
+//Post: prepare and phase have each been called warmup + repeat times, only phase is timed.
+//		The median, PERCENTILE percentile, fastest and mean of the timed runs are returned
+TimingRec TimePhase(/*IN*/const BenchOptionsRec& options,		// The options holding the runs
+					/*IN*/const function<void()>& prepare,		// Readies a run, untimed
+					/*IN*/const function<void()>& phase)		// The run being timed
+{
+	vector<double> runTimes;	// The time of each timed run in milliseconds
+	TimingRec timing;			// The summary of the runs
+	chrono::steady_clock::time_point start;	// When the current run started
+	double total = 0.0;			// The time of every run added
+
+	for (int i = 0; i < options.warmup; i++)
+	{
+		prepare();
+		phase();
+	}
+
+	for (int i = 0; i < options.repeat; i++)
+	{
+		prepare();
+
+		start = chrono::steady_clock::now();
+		phase();
+		runTimes.push_back(chrono::duration<double>(chrono::steady_clock::now() - start).count() * MS_PER_SECOND);
+
+		total += runTimes.back();
+	}
+
+	sort(runTimes.begin(), runTimes.end());
+
+	timing.runs = (int)runTimes.size();
+	timing.fastest = runTimes[ZERO];
+	timing.mean = total / runTimes.size();
+
+	// An even amount of runs takes the average of the middle two
+	timing.median = (runTimes[(runTimes.size() - OFFSET) / 2] + runTimes[runTimes.size() / 2]) / 2;
+
+	// The nearest rank, the smallest run no faster than PERCENTILE percent of the runs
+	timing.p95 = runTimes[(runTimes.size() * PERCENTILE + PERCENT_CONVERTER - OFFSET) / PERCENT_CONVERTER - OFFSET];
+
+	return timing;
+}// end TimePhase
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(1)
+//Purpose: To output the times of a single phase to the display and the results file
+//Pre: The case and phase timed, the results file is open
+//Post: A row of the table is displayed and a CSV line is written to the results file
+void ReportPhase(/*IN*/const int& edge,					// The edge of the cube
+				 /*IN*/const int& palette,				// The amount of colors
+				 /*IN*/const DistributionEnum& dist,	// How the colors are spread
+				 /*IN*/const PhaseEnum& phase,			// The phase timed
+				 /*IN*/const TimingRec& timing,			// The times of the phase
+				 /*IN/OUT*/ofstream& bout)				// The results file
+{
+	size_t cellAmt = (size_t)edge * edge * edge;	// The amount of cells in the cube
+
+	bout << fixed << setprecision(4);
+	bout << edge << "," << cellAmt << "," << palette << "," << DistributionName(dist) << ","
+		 << PhaseName(phase) << "," << timing.runs << "," << timing.median << "," << timing.p95
+		 << "," << timing.fastest << "," << timing.mean << "\n";
+
+	cout << fixed << setprecision(3);
+	cout << left << setw(6) << edge << setw(9) << palette << setw(11) << DistributionName(dist)
+		 << setw(10) << PhaseName(phase) << right << setw(12) << timing.median
+		 << setw(12) << timing.p95 << setw(12) << timing.fastest << endl;
+}// end ReportPhase
+
+
+// --------------------------------------------------------------------------------------
+
+//O(1)
+//Purpose: To convert a distribution to its name
+//Pre: The distribution
+//Post: The name of the distribution is returned
+string DistributionName(/*IN*/const DistributionEnum& dist)	// The distribution
+{
+	switch (dist)
+	{
+	case UNIFORM_DIST:
+		return "uniform";
+	case SKEWED_DIST:
+		return "skewed";
+	case CLUSTERED_DIST:
+		return "clustered";
+	}
+
+	return "";
+}// end DistributionName
+
+
+// --------------------------------------------------------------------------------------
+
+//O(1)
+//Purpose: To convert a phase to its name
+//Pre: The phase
+//Post: The name of the phase is returned
+string PhaseName(/*IN*/const PhaseEnum& phase)	// The phase
+{
+	switch (phase)
+	{
+	case POPULATE_PHASE:
+		return "populate";
+	case SEARCH_PHASE:
+		return "search";
+	case FLOOD_PHASE:
+		return "flood";
+	case PRINT_PHASE:
+		return "print";
+	case STATS_PHASE:
+		return "stats";
+	}
+
+	return "";
+}// end PhaseName
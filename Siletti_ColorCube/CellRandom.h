@@ -0,0 +1,81 @@
+#pragma once
+/*
+    FileName : CellRandom.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains a counter based random number generator for populating a cube. Instead
+        of drawing the next number from a sequence, the random number of a cell is a hash
+        of the seed and the linear index of the cell (SplitMix64). Every cell can be
+        colored on its own, in any order and by any thread, and the cube is always the
+        same for the same seed.
+
+        The seed is hashed on its own before the cell is added, otherwise seed + 1 would
+        give the cube of seed shifted by one cell and a batch of seeds would all be alike.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Cells are numbered row major, the linear index of a cell is
+            ((x * cols) + y) * deps + z
+        2 - The amount of types is greater than 0 and small next to 2^32
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - None
+
+                           SUMMARY OF FUNCTIONS:
+        uint64_t MixWord(*IN*uint64_t word) - Scrambles the bits of a word
+        uint64_t MixCell(*IN*const uint64_t& seed,
+                         *IN*const uint64_t& cellIndex) - Gets the random number of a cell
+        int RandomCellType(*IN*const uint64_t& seed,
+                           *IN*const uint64_t& cellIndex,
+                           *IN*const int& typeAmt) - Gets the random type of a cell
+*/
+
+#include <cstdint>      // Gives access to the 64 bit words hashed
+
+
+const uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;   // The SplitMix64 step between counters
+const uint64_t MIX_MULT_1 = 0xBF58476D1CE4E5B9ULL;     // The first SplitMix64 multiplier
+const uint64_t MIX_MULT_2 = 0x94D049BB133111EBULL;     // The second SplitMix64 multiplier
+
+
+
+// O(1)
+// Purpose: Scrambles the bits of a word
+// Pre: The word to scramble
+// Post: The SplitMix64 finalizer of word is returned
+inline uint64_t MixWord(/*IN*/uint64_t word)                // The word to scramble
+{
+    word = (word ^ (word >> 30)) * MIX_MULT_1;
+    word = (word ^ (word >> 27)) * MIX_MULT_2;
+
+    return word ^ (word >> 31);
+}// end MixWord
+
+
+
+// O(1)
+// Purpose: Gets the random number of a cell
+// Pre: The seed of the cube and the linear index of the cell
+// Post: The SplitMix64 output for counter cellIndex of the stream keyed by the hashed seed
+//       is returned
+inline uint64_t MixCell(/*IN*/const uint64_t& seed,         // The seed of the cube
+                        /*IN*/const uint64_t& cellIndex)    // The linear index of the cell
+{
+    return MixWord(MixWord(seed * GOLDEN_GAMMA) + (cellIndex + 1) * GOLDEN_GAMMA);
+}// end MixCell
+
+
+
+// O(1)
+// Purpose: Gets the random type of a cell
+// Pre: The seed of the cube, the linear index of the cell and the amount of types
+// Post: A type from 0 to typeAmt - 1 is returned, the high 32 bits of the random number
+//       are scaled into the range instead of taking a remainder
+inline int RandomCellType(/*IN*/const uint64_t& seed,       // The seed of the cube
+                          /*IN*/const uint64_t& cellIndex,  // The linear index of the cell
+                          /*IN*/const int& typeAmt)         // The amount of types
+{
+    return (int)(((MixCell(seed, cellIndex) >> 32) * (uint64_t)typeAmt) >> 32);
+}// end RandomCellType
@@ -14,18 +14,23 @@
 			component field type used to check what type of cell the cell in the
 			cube is.
 		2 - Struct CubeRec will contain as its second field a component named
-			status which will be a bool. Bool status is to check on the state
-			of the cell, details for what that implies should be commented.
+			status which will be a StatusStamp. The cell is checked while status
+			holds the generation of the cube it is in, NO_STAMP is never a
+			generation, so clearing every status is a new generation.
 		3 - Struct CubeRec will contain as its third field a component named
 			populated which will be a bool. Bool populated is to check on if
 			the cell has been given a specific type yet.
-		4 - Must contain a 3 dimensional array of typedef CellRec, named Cube3DArr
 */
 
+#include <cstdint>		// Gives access to the 16 bit type of a cell
 #include "Constants.h"	// File which contains constant values used
 
 
-typedef ColorEnum CellType;	// Datatype stored in a cube class's cell
+typedef uint16_t CellType;	// Datatype stored in a cube class's cell, the integer index of its color
+typedef uint8_t StatusStamp;	// The generation of a cube in which a cell was checked
+
+const StatusStamp NO_STAMP = 0;		// The stamp of a cell never checked, never a generation
+const StatusStamp FIRST_STAMP = 1;	// The generation a cube starts in, and starts again in once its stamps wrap
 
 // struct to be stored in the cube
 struct CellRec
@@ -33,11 +38,8 @@ struct CellRec
 
 	CellType type;	// The type of cell that particular cell is
 
-	bool status;	// Boolean for whether the cell has been deemed as checked or not
-	// True ~ Checked	/	False ~ Not Checked
+	StatusStamp status;	// The generation in which the cell was deemed as checked
+	// Current Generation ~ Checked	/	Any Other ~ Not Checked
 
 	bool populated;	// Boolean for whether the cell has been given a type or not
-};
-
-
-typedef CellRec Cube3DArr[MAX_ROW][MAX_COL][MAX_DEP];	// The 3D cube itself
\ No newline at end of file
+};
\ No newline at end of file
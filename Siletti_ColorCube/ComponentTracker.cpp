@@ -0,0 +1,455 @@
+#include "ComponentTracker.h"	// Specification file for the Component Tracker class
+#include "Instrument.h"	// Grants Access to the instrumentation counters
+
+
+
+// Pre: The cube to be tracked
+// Post: Every cell has the label of its block, every block is ranked
+ComponentTrackerClass::ComponentTrackerClass(/*IN*/const CubeClass& colCube)    // The cube being tracked
+{
+	LabelerClass labeler;	// Finds every block of the cube once
+	LocationRec currLoc;	// The current cell being copied
+	size_t cellIndex = ZERO;	// The linear index of the current cell
+
+	rows = colCube.GetRows();
+	cols = colCube.GetCols();
+	deps = colCube.GetDeps();
+
+	labeler.Label(colCube);
+
+	// Copy the label of every cell in storage order
+	labels.resize(colCube.GetCellCount());
+	for (currLoc.x = 0; currLoc.x < rows; currLoc.x++)
+		for (currLoc.y = 0; currLoc.y < cols; currLoc.y++)
+			for (currLoc.z = 0; currLoc.z < deps; currLoc.z++, cellIndex++)
+				labels[cellIndex] = labeler.GetLabel(currLoc);
+
+	// Copy every block, the labeler gives the first cell in storage order
+	components.resize(labeler.GetComponentCount());
+	for (int i = 0; i < labeler.GetComponentCount(); i++)
+		components[i] = labeler.GetComponent(i);
+
+	// Find the first cell of every block in scan order
+	for (cellIndex = 0; cellIndex < labels.size(); cellIndex++)
+	{
+		if (labels[cellIndex] != NO_LABEL && ScanOrder(cellIndex, cols, deps) <
+			ScanOrder(components[labels[cellIndex]].firstCell, cols, deps))
+			components[labels[cellIndex]].firstCell = cellIndex;
+	}
+
+	for (int i = 0; i < (int)components.size(); i++)
+		Rank(i);
+}// end Constructor
+
+
+
+// Pre: The linear index of a cell within the cube and the type it was given
+// Post: The cell belongs to a block of newType, the blocks it left and joined are
+//       split or merged as needed. Nothing changes if the cell already had newType
+void ComponentTrackerClass::SetCellType(/*IN*/const size_t& cellIndex,     // The linear index of the cell
+										/*IN*/const int& newType)         // The type the cell was given
+{
+	if (labels[cellIndex] != NO_LABEL)
+	{
+		// The cell is not recolored
+		if (components[labels[cellIndex]].type == newType)
+			return;
+
+		RemoveCell(cellIndex);
+	}
+
+	AddCell(cellIndex, newType);
+}// end SetCellType
+
+
+
+// Pre: The location of a cell
+// Post: The label of the cell's block is returned, NO_LABEL if the cell has no type
+// Exception: OutOfBoundsException is thrown if the cell is not within the cube
+int ComponentTrackerClass::GetLabel(/*IN*/const LocationRec& cell) const   // The desired cell location
+{
+	// Check to see if the cell location is valid
+	if (cell.x >= rows || cell.x < ZERO || cell.y >= cols ||
+		cell.y < ZERO || cell.z >= deps || cell.z < ZERO)
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	return labels[((size_t)cell.x * cols + cell.y) * deps + cell.z];
+}// end GetLabel
+
+
+
+// Pre: None
+// Post: The amount of blocks is returned
+int ComponentTrackerClass::GetComponentCount() const
+{
+	return (int)ranking.size();
+}// end GetComponentCount
+
+
+
+// Pre: label is the label of a cell
+// Post: The type, size and first cell in scan order of the block are returned
+ComponentRec ComponentTrackerClass::GetComponent(/*IN*/const int& label) const    // The label of the block
+{
+	return components[label];
+}// end GetComponent
+
+
+
+// Pre: None
+// Post: largest and secLargest hold the labels of the two largest blocks, ties are broken
+//       by the block whose first cell comes first. NO_LABEL if there are not enough blocks
+void ComponentTrackerClass::FindLargest(/*OUT*/int& largest,               // The label of the largest block
+										/*OUT*/int& secLargest) const     // The label of the second largest block
+{
+	set<RankKey>::const_iterator rank = ranking.begin();	// The block being read
+
+	largest = NO_LABEL;
+	secLargest = NO_LABEL;
+
+	if (rank != ranking.end())
+	{
+		largest = get<2>(*rank);
+		rank++;
+	}
+
+	if (rank != ranking.end())
+		secLargest = get<2>(*rank);
+}// end FindLargest
+
+
+
+// Pre: label is the label of a cell, the list can hold every cell of the block
+// Post: The list is cleared and holds every cell of the block in storage order
+void ComponentTrackerClass::GetComponentCells(/*IN*/const int& label,              // The label of the block
+											  /*OUT*/ListClass& cellList) const    // The cells of the block
+{
+	vector<size_t> floodCells;		// The cells of the block in the order they are flooded
+	set<size_t> blockCells;			// The cells of the block in storage order
+	size_t neighbors[MAX_NUM_DIR];	// The neighbors of the current cell
+	int neighborAmt;				// The amount of neighbors within the cube
+	ItemRec currItem;				// The cell being added to the list
+
+	cellList.Clear();
+
+	// Flood the block from its first cell, the set keeps a cell from being flooded twice
+	floodCells.push_back(components[label].firstCell);
+	blockCells.insert(components[label].firstCell);
+
+	for (size_t i = 0; i < floodCells.size(); i++)
+	{
+		neighborAmt = Neighbors(floodCells[i], neighbors);
+
+		for (int n = 0; n < neighborAmt; n++)
+			if (labels[neighbors[n]] == label && blockCells.insert(neighbors[n]).second)
+				floodCells.push_back(neighbors[n]);
+	}
+
+	// List the cells in storage order
+	for (set<size_t>::const_iterator cell = blockCells.begin(); cell != blockCells.end(); cell++)
+	{
+		CellLocation(*cell, currItem.key);
+		cellList.Insert(currItem);
+	}
+}// end GetComponentCells
+
+
+
+// Pre: k > 0
+// Post: blocks holds at most k blocks from largest to smallest, ties are broken by
+//       the block whose first cell comes first. Only blocks of type are considered
+//       unless type is ANY_TYPE. The id of each block is its first cell
+void ComponentTrackerClass::FindTopK(/*IN*/const int& k,                   // The most blocks to find
+									 /*OUT*/vector<BlockRec>& blocks,      // The largest blocks
+									 /*IN*/const int& type) const          // The color of the blocks
+{
+	BlockRec currBlock;	// The block being kept
+	int label;			// The label of the block being read
+
+	blocks.clear();
+
+	// The ranking is already in order, only the blocks of other colors are skipped
+	for (set<RankKey>::const_iterator rank = ranking.begin();
+		 rank != ranking.end() && (int)blocks.size() < k; rank++)
+	{
+		label = get<2>(*rank);
+
+		if (type != ANY_TYPE && components[label].type != type)
+			continue;
+
+		currBlock.type = components[label].type;
+		currBlock.size = components[label].size;
+		currBlock.id = components[label].firstCell;
+		currBlock.cells = ListClass((int)currBlock.size);
+		GetComponentCells(label, currBlock.cells);
+
+		blocks.push_back(move(currBlock));
+	}
+}// end FindTopK
+
+
+
+// Pre: The linear index of a cell, room for MAX_NUM_DIR neighbors
+// Post: neighbors holds the linear index of every neighbor within the cube,
+//       the amount of neighbors is returned
+int ComponentTrackerClass::Neighbors(/*IN*/const size_t& cellIndex,        // The linear index of the cell
+									 /*OUT*/size_t neighbors[]) const     // The neighbors of the cell
+{
+	size_t planeSize = (size_t)cols * deps;	// The amount of cells with the same x
+	LocationRec cell;						// The location of the cell
+	int neighborAmt = ZERO;					// The amount of neighbors found
+
+	CellLocation(cellIndex, cell);
+
+	if (cell.x > ZERO)
+		neighbors[neighborAmt++] = cellIndex - planeSize;
+	if (cell.x < rows - OFFSET)
+		neighbors[neighborAmt++] = cellIndex + planeSize;
+	if (cell.y > ZERO)
+		neighbors[neighborAmt++] = cellIndex - deps;
+	if (cell.y < cols - OFFSET)
+		neighbors[neighborAmt++] = cellIndex + deps;
+	if (cell.z > ZERO)
+		neighbors[neighborAmt++] = cellIndex - OFFSET;
+	if (cell.z < deps - OFFSET)
+		neighbors[neighborAmt++] = cellIndex + OFFSET;
+
+	return neighborAmt;
+}// end Neighbors
+
+
+
+// Pre: The type of the block
+// Post: The label of a block of type with no cells is returned, a freed label is reused
+int ComponentTrackerClass::NewLabel(/*IN*/const int& type)                // The type of the block
+{
+	int label;	// The label given
+
+	if (freeLabels.empty())
+	{
+		label = (int)components.size();
+		components.push_back(ComponentRec());
+	}
+	else
+	{
+		label = freeLabels.back();
+		freeLabels.pop_back();
+	}
+
+	// No cell is past the end of the cube, so any cell flooded becomes the first
+	components[label].type = type;
+	components[label].size = ZERO;
+	components[label].firstCell = labels.size();
+
+	return label;
+}// end NewLabel
+
+
+
+// Pre: No cell holds the label and it is not ranked
+// Post: The label is empty and will be given by NewLabel
+void ComponentTrackerClass::FreeLabel(/*IN*/const int& label)             // The label being freed
+{
+	components[label].size = ZERO;
+	freeLabels.push_back(label);
+}// end FreeLabel
+
+
+
+// Pre: The block is not ranked
+// Post: The block is ranked by its size and first cell
+void ComponentTrackerClass::Rank(/*IN*/const int& label)                  // The label of the block
+{
+	ranking.insert(RankKey(-components[label].size, ScanOrder(components[label].firstCell, cols, deps), label));
+}// end Rank
+
+
+
+// Pre: The block is ranked with its current size and first cell
+// Post: The block is not ranked, its size and first cell may now change
+void ComponentTrackerClass::Unrank(/*IN*/const int& label)                // The label of the block
+{
+	ranking.erase(RankKey(-components[label].size, ScanOrder(components[label].firstCell, cols, deps), label));
+}// end Unrank
+
+
+
+// Pre: The cell has a label
+// Post: The cell has NO_LABEL, the rest of its block is one block per piece
+void ComponentTrackerClass::RemoveCell(/*IN*/const size_t& cellIndex)     // The linear index of the cell
+{
+	int oldLabel = labels[cellIndex];	// The block the cell leaves
+	int type = components[oldLabel].type;	// The type of the block
+	size_t neighbors[MAX_NUM_DIR];		// The neighbors of the cell
+	int neighborAmt;					// The amount of neighbors within the cube
+	int sameAmt = ZERO;					// The amount of neighbors in the block
+	int pieceLabel;						// The label of a piece of the block
+
+	Unrank(oldLabel);
+	labels[cellIndex] = NO_LABEL;
+
+	// The block is gone with its only cell
+	if (components[oldLabel].size == OFFSET)
+	{
+		FreeLabel(oldLabel);
+		return;
+	}
+
+	neighborAmt = Neighbors(cellIndex, neighbors);
+	for (int n = 0; n < neighborAmt; n++)
+		if (labels[neighbors[n]] == oldLabel)
+			sameAmt++;
+
+	// A cell with one neighbor in the block can not split it, only its first cell must be found again
+	if (sameAmt == OFFSET && components[oldLabel].firstCell != cellIndex)
+	{
+		components[oldLabel].size--;
+		Rank(oldLabel);
+		return;
+	}
+
+	// Every piece left is flooded into a block of its own, the old label is freed once no cell holds it
+	for (int n = 0; n < neighborAmt; n++)
+	{
+		if (labels[neighbors[n]] == oldLabel)
+		{
+			pieceLabel = NewLabel(type);
+			FloodRelabel(neighbors[n], oldLabel, pieceLabel);
+			Rank(pieceLabel);
+		}
+	}
+
+	FreeLabel(oldLabel);
+}// end RemoveCell
+
+
+
+// Pre: The cell has NO_LABEL
+// Post: The cell and every block of type next to it are one block
+void ComponentTrackerClass::AddCell(/*IN*/const size_t& cellIndex,         // The linear index of the cell
+									/*IN*/const int& type)                // The new type of the cell
+{
+	size_t neighbors[MAX_NUM_DIR];		// The neighbors of the cell
+	int neighborAmt;					// The amount of neighbors within the cube
+	int joined[MAX_NUM_DIR];			// The distinct blocks of type next to the cell
+	size_t joinedCell[MAX_NUM_DIR];		// A cell of each joined block
+	int joinedAmt = ZERO;				// The amount of joined blocks
+	int keepLabel;						// The block every joined block merges into
+	int label;							// The label of the current neighbor
+	bool found;							// If the current neighbor's block is already joined
+
+	neighborAmt = Neighbors(cellIndex, neighbors);
+
+	// Find each distinct block of the new type next to the cell
+	for (int n = 0; n < neighborAmt; n++)
+	{
+		label = labels[neighbors[n]];
+
+		if (label == NO_LABEL || components[label].type != type)
+			continue;
+
+		found = false;
+		for (int j = 0; j < joinedAmt; j++)
+			if (joined[j] == label)
+				found = true;
+
+		if (!found)
+		{
+			joined[joinedAmt] = label;
+			joinedCell[joinedAmt] = neighbors[n];
+			joinedAmt++;
+		}
+	}
+
+	// A cell with no neighbor of its type is a block of its own
+	if (joinedAmt == ZERO)
+	{
+		keepLabel = NewLabel(type);
+		components[keepLabel].size = OFFSET;
+		components[keepLabel].firstCell = cellIndex;
+		labels[cellIndex] = keepLabel;
+		Rank(keepLabel);
+		return;
+	}
+
+	// The largest joined block keeps its label, only the smaller ones are relabeled
+	keepLabel = joined[ZERO];
+	for (int j = 0; j < joinedAmt; j++)
+	{
+		Unrank(joined[j]);
+
+		if (components[joined[j]].size > components[keepLabel].size)
+			keepLabel = joined[j];
+	}
+
+	for (int j = 0; j < joinedAmt; j++)
+	{
+		if (joined[j] != keepLabel)
+		{
+			FloodRelabel(joinedCell[j], joined[j], keepLabel);
+			FreeLabel(joined[j]);
+		}
+	}
+
+	labels[cellIndex] = keepLabel;
+	components[keepLabel].size++;
+	if (ScanOrder(cellIndex, cols, deps) < ScanOrder(components[keepLabel].firstCell, cols, deps))
+		components[keepLabel].firstCell = cellIndex;
+
+	Rank(keepLabel);
+}// end AddCell
+
+
+
+// Pre: start holds fromLabel, toLabel is not ranked
+// Post: Every cell of fromLabel contiguous with start holds toLabel, the size and
+//       first cell of toLabel include them
+void ComponentTrackerClass::FloodRelabel(/*IN*/const size_t& start,        // A cell of the piece
+										 /*IN*/const int& fromLabel,       // The label the piece holds
+										 /*IN*/const int& toLabel)         // The label the piece is given
+{
+	size_t neighbors[MAX_NUM_DIR];	// The neighbors of the current cell
+	int neighborAmt;				// The amount of neighbors within the cube
+	size_t currCell;				// The cell being flooded
+	ComponentRec& block = components[toLabel];	// The block the piece joins
+
+	// A cell is relabeled as it is pushed, so it is never pushed twice
+	labels[start] = toLabel;
+	floodStack.push_back(start);
+
+	while (!floodStack.empty())
+	{
+		currCell = floodStack.back();
+		floodStack.pop_back();
+
+		block.size++;
+		if (ScanOrder(currCell, cols, deps) < ScanOrder(block.firstCell, cols, deps))
+			block.firstCell = currCell;
+
+		neighborAmt = Neighbors(currCell, neighbors);
+
+		for (int n = 0; n < neighborAmt; n++)
+		{
+			if (labels[neighbors[n]] == fromLabel)
+			{
+				labels[neighbors[n]] = toLabel;
+				floodStack.push_back(neighbors[n]);
+			}
+		}
+	}
+}// end FloodRelabel
+
+
+
+// Pre: The linear index of a cell
+// Post: cell holds the x, y and z of the cell
+void ComponentTrackerClass::CellLocation(/*IN*/const size_t& cellIndex,    // The linear index of the cell
+										 /*OUT*/LocationRec& cell) const  // The location of the cell
+{
+	cell.x = (int)(cellIndex / ((size_t)cols * deps));
+	cell.y = (int)(cellIndex / deps % cols);
+	cell.z = (int)(cellIndex % deps);
+}// end CellLocation
@@ -0,0 +1,251 @@
+#pragma once
+/*
+    FileName : ComponentTracker.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Component Tracker Class. The tracker keeps the
+        label of every cell and the color, size and first cell of every contiguous block
+        of a cube current while cells are recolored, so the blocks never have to be
+        searched for again. A CubeClass owns a tracker once EnableComponents is called
+        and hands it every type it sets.
+
+        When a cell is recolored:
+            Old color - The cell leaves its block. If the cell had a single neighbor in
+                        the block and was not its first cell the block is still whole and
+                        only shrinks. Otherwise the rest of the block is flooded from each
+                        of the cell's old neighbors, and every piece it split into gets
+                        its own label.
+            New color - The blocks of the new color next to the cell are merged into the
+                        largest of them, only the cells of the smaller blocks are relabeled.
+                        With no such neighbor the cell starts a block of its own.
+        The work is the size of the blocks touched, not the size of the cube.
+
+        The blocks are also kept in a set ordered from largest to smallest, ties broken by
+        the block whose first cell comes first, so the largest blocks are known at once.
+        The first cell of a block is the first in scan order (see ScanOrder in Labeler.h),
+        the cell the original flood fill would start the block from.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Cells are contiguous when they share a face and have the same type
+        2 - Cells with no type are given NO_LABEL and belong to no block
+        3 - Labels are not numbered in storage order and are reused once a block is gone,
+            a label only names the same block until the next recolor
+        4 - The tracker is told of every type set in the cube, CubeClass does this
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - OutOfBoundsException thrown when a cell outside of the cube is asked for
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        ComponentTrackerClass(*IN*const CubeClass& colCube) - Labels every block of a cube
+        void SetCellType(*IN*const size_t& cellIndex,
+                         *IN*const int& newType) - Updates the blocks for a recolored cell
+        int GetLabel(*IN*const LocationRec& cell) const - Gets the label of a cell
+        int GetComponentCount() const - Gets the amount of contiguous blocks
+        ComponentRec GetComponent(*IN*const int& label) const - Gets the details of a block
+        void FindLargest(*OUT*int& largest,
+                         *OUT*int& secLargest) const - Finds the two largest blocks
+        void GetComponentCells(*IN*const int& label,
+                               *OUT*ListClass& cellList) const
+                  -  Fills a list with the location of every cell of a block
+        void FindTopK(*IN*const int& k,
+                      *OUT*vector<BlockRec>& blocks,
+                      *IN*const int& type = ANY_TYPE) const
+                  -  Finds the k largest blocks, optionally of one color, with their cells
+
+    PRIVATE MEMBERS:
+        int rows;                           // The amount of rows in the cube
+        int cols;                           // The amount of columns in the cube
+        int deps;                           // The amount of faces in the cube
+        vector<int> labels;                 // The label of every cell, in storage order
+        vector<ComponentRec> components;    // The details of every block, by label
+        vector<int> freeLabels;             // Labels no block holds
+        set<RankKey> ranking;               // Every block from largest to smallest
+        vector<size_t> floodStack;          // The cells waiting to be flooded
+
+        int Neighbors(*IN*const size_t& cellIndex,
+                      *OUT*size_t neighbors[]) const - Gets the cells sharing a face with a cell
+        int NewLabel(*IN*const int& type) - Gives a label to a new empty block
+        void FreeLabel(*IN*const int& label) - Lets a label be given again
+        void Rank(*IN*const int& label) - Adds a block to the ranking
+        void Unrank(*IN*const int& label) - Removes a block from the ranking
+        void RemoveCell(*IN*const size_t& cellIndex) - Takes a cell out of its block
+        void AddCell(*IN*const size_t& cellIndex,
+                     *IN*const int& type) - Puts a cell in the block of its new type
+        void FloodRelabel(*IN*const size_t& start,
+                          *IN*const int& fromLabel,
+                          *IN*const int& toLabel) - Moves the cells of a piece to another label
+        void CellLocation(*IN*const size_t& cellIndex,
+                          *OUT*LocationRec& cell) const - Gets the location of a cell
+*/
+
+#include <vector>       // Gives access to the vectors holding the labels
+#include <set>          // Gives access to the set ranking the blocks
+#include <tuple>        // Gives access to the keys of the ranking
+#include "Labeler.h"    // Grants Access to Labeler Class and ComponentRec
+#include "TopBlocks.h"  // Grants Access to BlockRec
+
+using namespace std;
+
+
+typedef tuple<long long, size_t, int> RankKey;  // (-size, ScanOrder of the first cell, label) of a block,
+                                                // the largest block with the earliest first cell sorts first
+
+
+
+class ComponentTrackerClass
+{
+public:
+
+    // O(N^3) : Constructor
+    // Purpose: Labels every block of a cube
+    // Pre: The cube to be tracked
+    // Post: Every cell has the label of its block, every block is ranked
+    ComponentTrackerClass(/*IN*/const CubeClass& colCube);    // The cube being tracked
+
+
+    // O(size of the blocks touched) : Mutator
+    // Purpose: Updates the blocks for a recolored cell
+    // Pre: The linear index of a cell within the cube and the type it was given
+    // Post: The cell belongs to a block of newType, the blocks it left and joined are
+    //       split or merged as needed. Nothing changes if the cell already had newType
+    void SetCellType(/*IN*/const size_t& cellIndex,     // The linear index of the cell
+                     /*IN*/const int& newType);         // The type the cell was given
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the label of a cell
+    // Pre: The location of a cell
+    // Post: The label of the cell's block is returned, NO_LABEL if the cell has no type
+    // Exception: OutOfBoundsException is thrown if the cell is not within the cube
+    int GetLabel(/*IN*/const LocationRec& cell) const;   // The desired cell location
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of contiguous blocks
+    // Pre: None
+    // Post: The amount of blocks is returned
+    int GetComponentCount() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the details of a block
+    // Pre: label is the label of a cell
+    // Post: The type, size and first cell in scan order of the block are returned
+    ComponentRec GetComponent(/*IN*/const int& label) const;    // The label of the block
+
+
+    // O(1) : Observer Summarizer
+    // Purpose: Finds the two largest blocks
+    // Pre: None
+    // Post: largest and secLargest hold the labels of the two largest blocks, ties are broken
+    //       by the block whose first cell comes first. NO_LABEL if there are not enough blocks
+    void FindLargest(/*OUT*/int& largest,               // The label of the largest block
+                     /*OUT*/int& secLargest) const;     // The label of the second largest block
+
+
+    // O(S log S) : Observer Accessor, S is the size of the block
+    // Purpose: Fills a list with the location of every cell of a block
+    // Pre: label is the label of a cell, the list can hold every cell of the block
+    // Post: The list is cleared and holds every cell of the block in storage order
+    void GetComponentCells(/*IN*/const int& label,              // The label of the block
+                           /*OUT*/ListClass& cellList) const;   // The cells of the block
+
+
+    // O(K + S log S) : Observer Summarizer, S is the size of the blocks kept
+    // Purpose: Finds the k largest blocks, optionally of one color, with their cells
+    // Pre: k > 0
+    // Post: blocks holds at most k blocks from largest to smallest, ties are broken by
+    //       the block whose first cell comes first. Only blocks of type are considered
+    //       unless type is ANY_TYPE. The id of each block is its first cell
+    void FindTopK(/*IN*/const int& k,                   // The most blocks to find
+                  /*OUT*/vector<BlockRec>& blocks,      // The largest blocks
+                  /*IN*/const int& type = ANY_TYPE) const;     // The color of the blocks
+
+
+private:
+
+    // PDMs
+    int rows;                           // The amount of rows in the cube
+    int cols;                           // The amount of columns in the cube
+    int deps;                           // The amount of faces in the cube
+    vector<int> labels;                 // The label of every cell, in storage order
+    vector<ComponentRec> components;    // The details of every block, by label
+    vector<int> freeLabels;             // Labels no block holds
+    set<RankKey> ranking;               // Every block from largest to smallest
+    vector<size_t> floodStack;          // The cells waiting to be flooded
+
+
+    // O(1)
+    // Purpose: Gets the cells sharing a face with a cell
+    // Pre: The linear index of a cell, room for MAX_NUM_DIR neighbors
+    // Post: neighbors holds the linear index of every neighbor within the cube,
+    //       the amount of neighbors is returned
+    int Neighbors(/*IN*/const size_t& cellIndex,        // The linear index of the cell
+                  /*OUT*/size_t neighbors[]) const;     // The neighbors of the cell
+
+
+    // O(1)
+    // Purpose: Gives a label to a new empty block
+    // Pre: The type of the block
+    // Post: The label of a block of type with no cells is returned, a freed label is reused
+    int NewLabel(/*IN*/const int& type);                // The type of the block
+
+
+    // O(1)
+    // Purpose: Lets a label be given again
+    // Pre: No cell holds the label and it is not ranked
+    // Post: The label is empty and will be given by NewLabel
+    void FreeLabel(/*IN*/const int& label);             // The label being freed
+
+
+    // O(log C) : C is the amount of blocks
+    // Purpose: Adds a block to the ranking
+    // Pre: The block is not ranked
+    // Post: The block is ranked by its size and first cell
+    void Rank(/*IN*/const int& label);                  // The label of the block
+
+
+    // O(log C) : C is the amount of blocks
+    // Purpose: Removes a block from the ranking
+    // Pre: The block is ranked with its current size and first cell
+    // Post: The block is not ranked, its size and first cell may now change
+    void Unrank(/*IN*/const int& label);                // The label of the block
+
+
+    // O(size of the block) : Mutator
+    // Purpose: Takes a cell out of its block
+    // Pre: The cell has a label
+    // Post: The cell has NO_LABEL, the rest of its block is one block per piece
+    void RemoveCell(/*IN*/const size_t& cellIndex);     // The linear index of the cell
+
+
+    // O(size of the smaller blocks merged) : Mutator
+    // Purpose: Puts a cell in the block of its new type
+    // Pre: The cell has NO_LABEL
+    // Post: The cell and every block of type next to it are one block
+    void AddCell(/*IN*/const size_t& cellIndex,         // The linear index of the cell
+                 /*IN*/const int& type);                // The new type of the cell
+
+
+    // O(size of the piece) : Mutator
+    // Purpose: Moves the cells of a piece to another label
+    // Pre: start holds fromLabel, toLabel is not ranked
+    // Post: Every cell of fromLabel contiguous with start holds toLabel, the size and
+    //       first cell of toLabel include them
+    void FloodRelabel(/*IN*/const size_t& start,        // A cell of the piece
+                      /*IN*/const int& fromLabel,       // The label the piece holds
+                      /*IN*/const int& toLabel);        // The label the piece is given
+
+
+    // O(1)
+    // Purpose: Gets the location of a cell
+    // Pre: The linear index of a cell
+    // Post: cell holds the x, y and z of the cell
+    void CellLocation(/*IN*/const size_t& cellIndex,    // The linear index of the cell
+                      /*OUT*/LocationRec& cell) const;  // The location of the cell
+
+}; // end ComponentTrackerClass
@@ -0,0 +1,201 @@
+#pragma once
+/*
+    FileName : Connectivity.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the connectivity policies of the labeler. A policy says which cells of
+        the same type touch:
+            FaceConnectivity - 6 neighbors, the cells sharing a face
+            EdgeConnectivity - 18 neighbors, the cells sharing a face or an edge
+            CornerConnectivity - 26 neighbors, the cells sharing a face, an edge or a corner
+
+        The labeler only compares a cell with the neighbors it has already visited in
+        storage order, the backward half of the neighborhood. The other half is reached
+        when the later cell looks back. Each policy holds its backward neighbors in a
+        constexpr table of steps (dx, dy, dz), so every step is a compile time constant.
+        The labeler is a template on the policy and ForEachStep unrolls its loop over the
+        table, so each connectivity gets its own inner loop with no switch per neighbor.
+
+        Run labeling compares whole columns. Each policy also lists the columns before a
+        column (dx, dy) that hold neighbors, and the reach of each along the depth. A run
+        touches a run of a neighboring column when they overlap once widened by the reach,
+        0 when only the cells level with it are neighbors, 1 when the diagonals are too.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Storage order runs z fastest, then y, then x, so a backward step has dx < 0, or
+            dx == 0 and dy < 0, or dx == dy == 0 and dz < 0
+        2 - A policy's tables list every backward neighbor exactly once
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - None, a step is only taken once the caller has checked it stays in the cube
+
+                           SUMMARY OF POLICIES:
+        static const int NEIGHBOR_AMT - The amount of neighbors of a cell
+        static const int BACK_AMT - The amount of neighbors visited before a cell
+        static const int COLUMN_AMT - The amount of columns before a column holding neighbors
+        static const int AHEAD_REACH - How far a backward neighbor lies ahead in column or face
+        static constexpr NeighborStepRec BackStep(*IN*const int n) - Gets a backward neighbor
+        static constexpr ColumnStepRec BackColumn(*IN*const int n) - Gets a backward column
+
+                           SUMMARY OF FUNCTIONS:
+        void ForEachStep<amt>(*IN*Function&& step) - Calls step once per index, unrolled
+        int ColumnProbes<Connectivity>(*IN*const bool& hasPrevRow,
+                                       *IN*const int& j,
+                                       *IN*const int& cols,
+                                       *IN*const int& deps) - Counts the neighbors a column compares
+*/
+
+#include <utility>      // Gives access to the index sequences of the unrolled loops
+#include <type_traits>  // Gives access to integral_constant
+#include "Constants.h"  // Gives access to ZERO and OFFSET
+
+using namespace std;
+
+
+// Enumerated type to choose which cells touch, valued by the amount of neighbors
+enum ConnectivityEnum { FACE_CONNECTIVITY = 6, EDGE_CONNECTIVITY = 18, CORNER_CONNECTIVITY = 26 };
+
+
+// Struct to contain a step from a cell to one of its neighbors
+struct NeighborStepRec
+{
+    int dx;     // The change in row
+    int dy;     // The change in column
+    int dz;     // The change in face
+};
+
+
+// Struct to contain a step from a column to a neighboring column
+struct ColumnStepRec
+{
+    int dx;     // The change in row
+    int dy;     // The change in column
+    int reach;  // How far along the depth a cell of the column touches
+};
+
+
+// The backward neighbors of each policy, in the order they are compared
+constexpr NeighborStepRec FACE_BACK_STEPS[] = {
+    { 0, 0, -1 }, { 0, -1, 0 }, { -1, 0, 0 } };
+
+constexpr NeighborStepRec EDGE_BACK_STEPS[] = {
+    { 0, 0, -1 }, { 0, -1, -1 }, { 0, -1, 0 }, { 0, -1, 1 },
+    { -1, -1, 0 }, { -1, 0, -1 }, { -1, 0, 0 }, { -1, 0, 1 }, { -1, 1, 0 } };
+
+constexpr NeighborStepRec CORNER_BACK_STEPS[] = {
+    { 0, 0, -1 }, { 0, -1, -1 }, { 0, -1, 0 }, { 0, -1, 1 },
+    { -1, -1, -1 }, { -1, -1, 0 }, { -1, -1, 1 }, { -1, 0, -1 }, { -1, 0, 0 },
+    { -1, 0, 1 }, { -1, 1, -1 }, { -1, 1, 0 }, { -1, 1, 1 } };
+
+
+// The backward columns of each policy
+constexpr ColumnStepRec FACE_BACK_COLUMNS[] = {
+    { 0, -1, 0 }, { -1, 0, 0 } };
+
+constexpr ColumnStepRec EDGE_BACK_COLUMNS[] = {
+    { 0, -1, 1 }, { -1, -1, 0 }, { -1, 0, 1 }, { -1, 1, 0 } };
+
+constexpr ColumnStepRec CORNER_BACK_COLUMNS[] = {
+    { 0, -1, 1 }, { -1, -1, 1 }, { -1, 0, 1 }, { -1, 1, 1 } };
+
+
+
+// Cells sharing a face are contiguous
+struct FaceConnectivity
+{
+    static const int NEIGHBOR_AMT = 6;
+    static const int BACK_AMT = 3;
+    static const int COLUMN_AMT = 2;
+    static const int AHEAD_REACH = 0;
+
+    static constexpr NeighborStepRec BackStep(/*IN*/const int n) { return FACE_BACK_STEPS[n]; }
+    static constexpr ColumnStepRec BackColumn(/*IN*/const int n) { return FACE_BACK_COLUMNS[n]; }
+};
+
+
+// Cells sharing a face or an edge are contiguous
+struct EdgeConnectivity
+{
+    static const int NEIGHBOR_AMT = 18;
+    static const int BACK_AMT = 9;
+    static const int COLUMN_AMT = 4;
+    static const int AHEAD_REACH = 1;
+
+    static constexpr NeighborStepRec BackStep(/*IN*/const int n) { return EDGE_BACK_STEPS[n]; }
+    static constexpr ColumnStepRec BackColumn(/*IN*/const int n) { return EDGE_BACK_COLUMNS[n]; }
+};
+
+
+// Cells sharing a face, an edge or a corner are contiguous
+struct CornerConnectivity
+{
+    static const int NEIGHBOR_AMT = 26;
+    static const int BACK_AMT = 13;
+    static const int COLUMN_AMT = 4;
+    static const int AHEAD_REACH = 1;
+
+    static constexpr NeighborStepRec BackStep(/*IN*/const int n) { return CORNER_BACK_STEPS[n]; }
+    static constexpr ColumnStepRec BackColumn(/*IN*/const int n) { return CORNER_BACK_COLUMNS[n]; }
+};
+
+
+static_assert(sizeof(FACE_BACK_STEPS) / sizeof(NeighborStepRec) == FaceConnectivity::BACK_AMT &&
+              sizeof(EDGE_BACK_STEPS) / sizeof(NeighborStepRec) == EdgeConnectivity::BACK_AMT &&
+              sizeof(CORNER_BACK_STEPS) / sizeof(NeighborStepRec) == CornerConnectivity::BACK_AMT,
+              "Every backward neighbor is listed once");
+
+
+
+// O(amt)
+// Purpose: Calls step once per index of a sequence
+// Pre: step takes an integral_constant<int, n>
+// Post: step has been called with 0 to amt - 1 in order
+template <class Function, int... n>
+inline void UnrollSteps(/*IN*/Function& step,                   // The body of the loop
+                        /*IN*/integer_sequence<int, n...>)      // The indices to call it with
+{
+    int expand[] = { ZERO, (step(integral_constant<int, n>()), ZERO)... };  // Forces the calls in order
+
+    (void)expand;
+}// end UnrollSteps
+
+
+
+// O(amt)
+// Purpose: Calls step once per index from 0 to amt - 1, unrolled so each index is a constant
+// Pre: step takes an integral_constant<int, n>
+// Post: step has been called with 0 to amt - 1 in order
+template <int amt, class Function>
+inline void ForEachStep(/*IN*/Function&& step)      // The body of the loop
+{
+    UnrollSteps(step, make_integer_sequence<int, amt>());
+}// end ForEachStep
+
+
+
+// O(1)
+// Purpose: Counts the neighbor compares of a column of cells, for the instrumentation counters
+// Pre: Whether the row before is in the slab, the column and the dimensions of the cube
+// Post: The amount of backward neighbors of the column's cells that lie in the slab is returned
+template <class Connectivity>
+int ColumnProbes(/*IN*/const bool& hasPrevRow,      // True if the row before is in the slab
+                 /*IN*/const int& j,                // The column
+                 /*IN*/const int& cols,             // The amount of columns in the cube
+                 /*IN*/const int& deps)             // The amount of faces in the cube
+{
+    int probes = ZERO;  // The compares counted so far
+
+    ForEachStep<Connectivity::BACK_AMT>([&](auto n)
+    {
+        constexpr NeighborStepRec step = Connectivity::BackStep(decltype(n)::value);
+
+        if ((step.dx == ZERO || hasPrevRow) && (step.dy >= ZERO || j > ZERO) &&
+            (step.dy <= ZERO || j < cols - OFFSET))
+            probes += deps - (step.dz == ZERO ? ZERO : OFFSET);
+    });
+
+    return probes;
+}// end ColumnProbes
@@ -8,17 +8,17 @@
     Purpose: This file contains the constants and enums used in color cuberator
 
     Assumptions:
-        The MAX ROW, COL, and DEP should be greater than 0 each
+        The DEFAULT ROW, COL, and DEP should be greater than 0 each
 */
 
 #include <string>   // Gives access to string datatype
 using namespace std;
 
 
-// Enumerated type to keep track of cell color
+// Enumerated type naming the colors of the default palette
 enum ColorEnum { RED, ORG, YEL, GRN, BLU };
-const int MAX_COLOR_AMT = 5;	// The maximum number of colors
-// A case must be added to the ColorEnumIndexToString function in ContigClient
+const int DEFAULT_COLOR_AMT = 5;	// The number of colors when no -palette or -colors is given
+// Other palettes are chosen when the program is run, see Palette.h
 
 
 // Enumerated type to determine direction of travel
@@ -36,15 +36,22 @@ struct LocationRec
 
 
 // Constants
-const int MAX_ROW = 5;              // Maximum amount of rows
-const int MAX_COL = 5;              // Maximum amount of columns
-const int MAX_DEP = 5;              // Maximum amount of faces
+const int DEFAULT_ROW = 5;          // Amount of rows used when none are specified
+const int DEFAULT_COL = 5;          // Amount of columns used when none are specified
+const int DEFAULT_DEP = 5;          // Amount of faces used when none are specified
 const int COLOR_TRACKER = 2;	    // The number of specific details needed to track for each color
 const int ZERO = 0;                 // A lower index bound
 const int OFFSET = 1;               // Amount to offset a number by one
-const int SEED = 1234567;           // The random seed used
+const int SEED = 1234567;           // The random seed used when no -seed is given
 const int PERCENT_CONVERTER = 100;  // The number used to convert a number to a percentage
 
+const int EMPTY_CELL = -1;          // Marks a cell with no type when reading a row of the cube
+
 const bool CHECKED = true;          // Used to set cells to being checked
 
 const string OUTPUT_FILE_NAME = "Cube.out";	// The output file name
+const string STREAM_FILE_NAME = "Cube.bin";	// The cube file written and read back by the streaming search
+const string BATCH_FILE_NAME = "Batch.out";	// The output file of a batch of cubes
+const string CSV_FILE_NAME = "Cube.csv";	// The output file name of -report csv
+const string JSON_FILE_NAME = "CubeReport.json";	// The output file name of -report json
+const string BINARY_FILE_NAME = "Cube.rpt";	// The output file name of -report binary
@@ -9,462 +9,2639 @@
 		3 dimensional cube, and to display it to an output file, along with other cube statistics.
 
 	INPUT:
-		NO INPUT FROM USER ALL NEEDED DATA WITHIN Constants.h
+		The dimensions of the cube and the search may be given on the command line:
+			Siletti_ColorCube [rows cols deps] [-flood] [-halo] [-stream] [-runs] [-packed] [-tiled]
+				[-chunked] [-sparse] [-connect 6|18|26] [-threads amount] [-top amount] [-color name]
+				[-geometry] [-save file] [-load file] [-recolor amount] [-seed number] [-seeds first last] [-batch file]
+				[-report text|csv|json|binary] [-palette file] [-colors amount]
+		When no dimensions are given DEFAULT_ROW, DEFAULT_COL and DEFAULT_DEP
+		from Constants.h are used. All other needed data is within Constants.h
+			-flood	Search with the original block by block flood fill instead of the labeler
+			-halo	Search with the flood fill over a halo padded copy of the cube, no bounds are checked
+			-stream	Write the cube to STREAM_FILE_NAME and label it a plane at a time, the whole
+					cube is never held in memory
+			-runs	Label the cube by runs of cells instead of cell by cell
+			-packed	Store the cube as packed planes instead of a CellRec per cell
+			-tiled	Store the cube as bricks of BRICK_EDGE^3 cells in Morton order, so the
+					neighbors of a cell along every direction are usually near it in memory
+			-chunked	Store the cube as chunks of CHUNK_EDGE^3 cells, a chunk whose cells hold
+						one color is kept as that color alone
+			-sparse	Store only the chunks of CHUNK_EDGE^3 cells that hold a type, in a hash
+					table, for a loaded cube whose cells mostly have no type. The labeler skips
+					every row of such a cube that holds no type
+			-connect	Cells touch across a face (6), also an edge (18) or also a corner (26),
+						faces by default. Only the labeler searches with 18 or 26, so they are
+						not used with -flood, -halo, -stream or -recolor
+			-threads	Populate and label the cube with the given amount of threads, 0 uses every core
+			-top	Also report the given amount of largest blocks, at most one per cell of the cube
+			-color	Only report blocks of the named color (RED, ORG, ...) in the -top report
+			-geometry	Also report the bounding box, centroid, exposed faces and the faces of the
+						cube touched of each -top block, and how many blocks fall in each range of
+						sizes. The shapes are measured while labeling, so only the labeler searches
+						with it, it is not used with -flood, -halo or -stream
+			-save	Save the populated cube to the named cube file, with -stream the cube file
+					is written there instead of STREAM_FILE_NAME
+			-load	Search the cube in the named cube file instead of populating one, its
+					dimensions replace any given. The file is mapped, not read, unless -packed,
+					-tiled, -chunked or -sparse is given, then its cells are read into that storage
+			-recolor	After the search recolor the given amount of random cells, keeping the
+						blocks current as each cell changes, and report the largest blocks after.
+						The stream search never holds the cube, so it is not used with -stream
+			-seed	Populate the cube with the given seed instead of SEED
+			-seeds	Run a batch of cubes, one for each seed from first to last, with the given
+					dimensions
+			-batch	Run a batch of cubes, one for each line of the named job file. A line holds a
+					seed and may be followed by rows cols deps, otherwise the given dimensions are used
+			-report	Write the output as text to OUTPUT_FILE_NAME (the default), as CSV to
+					CSV_FILE_NAME, as JSON to JSON_FILE_NAME or as binary to BINARY_FILE_NAME
+			-palette	Populate the cube with the colors named in the palette file, one name per
+						line, instead of the DEFAULT_COLOR_AMT colors of ColorEnum (see Palette.h)
+			-colors	Populate the cube with the given amount of colors, named RED, ORG, YEL, GRN,
+					BLU, then C5, C6 and on
+		A batch populates and labels its cubes on a pool of -threads threads, a cube on each
+		thread at a time, with -runs, -packed, -tiled, -chunked, -sparse, -connect, -palette and
+		-colors used for every cube.
+		-flood, -halo, -stream, -top, -color, -geometry, -save, -load, -recolor and -report are not
+		used with a batch
 
 	PROCESSING:
-		A color cube is populated with random colors
-		Those colors are kept track of in the colorArray
+		A color cube is populated with random colors, the color of each cell is a hash of the seed
+		and the cell's index (see CellRandom.h) so the cube is the same for any amount of threads
+		Those colors are kept track of in the colorArray, each thread counts its own cells
+		Every contiguous block of colors is labeled in a single sweep of the cube
 		The largest contiguous color and second largest contiguous color are found
 		The most populous color and second most populous color are found
+		With -stream the cube is populated straight to STREAM_FILE_NAME and labeled from there
+		With -load the cube is opened from a cube file and its colors are counted instead
+		With -chunked every chunk whose cells came to hold one color is collapsed once the
+		cube is populated or loaded
+		With -sparse a chunk is only allocated once a cell of it is given a type, the rows
+		of a sparse cube with no type are skipped when its colors are counted and labeled
+		The colors are a palette chosen when run, a packed cube or a cube file holds a byte per
+		cell while the palette has at most BYTE_TYPE_AMT colors, otherwise 16 bits
+		With -recolor the cube keeps its blocks current while cells are recolored
+		With -seeds or -batch every cube is populated from its own seed and labeled on a thread
+		of the pool, each thread keeps its cube and labeler from one cube to the next
+		A cube of the default dimensions held as records is a DefaultCubeClass, fixed when
+		compiled (see FixedCube.h), any other cube is a CubeClass. Both are searched by the
+		same templates
 
 	OUTPUT:
-		All outputs go to OUTPUT_FILE_NAME
+		All outputs go to OUTPUT_FILE_NAME, or to the file of the -report format. The report is
+		formatted into a large buffer and written in a few large writes, see ReportWriter.h
 		Outputs the largest contiguous block of cells within the cube,
 		and the second largest if it is of same length.
 		The amount of cells within these contiguous blocks are printed.
 		A Color summary is printed containing the amount of each color,
 		and the two most populous colors, along with the percent of the cube they take up
+		When -top is given the largest blocks are listed last with their color, size and first cell
+		When -geometry is given the shape of each -top block and the amount of blocks of each
+		range of sizes are listed after them
+		When -recolor is given the two largest blocks after recoloring are listed after that
+		With -report csv, json or binary the same results are written in that format instead,
+		with every cell of the two largest blocks in place of the printed cube
+		A batch writes BATCH_FILE_NAME instead, one line per cube in the order of the seeds
+		with its dimensions, amount of blocks, two largest blocks and most populous color,
+		then a summary of the whole batch
+		When built with CUBE_INSTRUMENT the hot path counters and the time of each phase are also
+		written to INSTRUMENT_FILE_NAME as JSON, see Instrument.h
 
 	ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
-		1 - For added colors, their cases must be added in the ColorEnumIndexToString function
+		1 - The colors are those of -palette or -colors, or the DEFAULT_COLOR_AMT colors of ColorEnum
+			when neither is given. A cube file must be loaded with the palette it was saved with
 		2 - The color array will be initialized before the cube is populated
 		3 - If a third contiguous block is found to be the same size as the second largest contiguous
-			block, just ignore it, first found stays
+			block, just ignore it, first found stays. Every search keeps the first block found in
+			the flood fill's scan order (x, z, y), so all of them pick the same block of a tied size
+		4 - The options, records and prototypes are in ContigClient.h. With CUBE_BENCHMARK defined
+			main is left out and the benchmark calls these functions with its own main
 
 
 	EXCEPTION HANDLING/ERROR CHECKING:
 		1 - If an invalid location is sent into the CubeClass the program will move on
-		2 - If the cube is too small (1x1x1) the contiguous block will not be outputted, there
-			is no point.
+		2 - Every search reports a block of a single cell, so a 1x1x1 cube has a largest block of
+			one cell. A cube of a single block has no second largest block and the report says so.
+			If no cell of a loaded cube has a color there is no block, and the report says so
+		3 - If the command line dimensions are not three integers greater than 0 a usage
+			message is displayed and the program ends
+		4 - If a cube file for -stream, -save or -load can not be written or read a message
+			is displayed and the program ends
+		5 - If a loaded cube file names colors other than the palette's, or holds a cell of
+			an unknown color, a message is displayed and the program ends
+		6 - If a batch job file can not be read, holds a line that is not a seed with optional
+			dimensions, or BATCH_FILE_NAME can not be written a message is displayed and the
+			program ends
+		7 - If the palette file can not be read, holds a name that is invalid or repeated, or
+			the palette holds fewer than MIN_PALETTE_AMT or more than MAX_PALETTE_AMT colors, a
+			usage message is displayed and the program ends. So is a -color not in the palette
+		8 - If a cube of more than MAX_LABEL_CELLS cells is labeled in memory a message is
+			displayed and the program ends, the flood fills and -stream have no such limit
 
 						   SUMMARY OF FUNCTIONS:
-PopulateCube(*OUT*CubeClass& colCube,
-			 *IN/OUT*ColorArr colArr)
+ReadArguments(*IN*int argc,
+			  *IN*char* argv[],
+			  *OUT*RunOptionsRec& options)
+		- To read the dimensions of the cube and the search to use from the command line
+ReadCubeHeader(*IN/OUT*RunOptionsRec& options)
+		- To read the dimensions of a cube file to be loaded and check its colors
+MemorySearch(*IN*const RunOptionsRec& options,
+			 *IN/OUT*ColorArr& colorArr,
+			 *OUT*ListClass& largContigList,
+			 *OUT*ListClass& secLargContigList,
+			 *OUT*int& largCol,
+			 *OUT*int& secLargCol,
+			 *OUT*vector<BlockRec>& topBlocks,
+			 *OUT*vector<BlockRec>& recolorBlocks,
+			 *OUT*BlockShapesRec& shapes)
+		- To populate a cube in memory and find its largest contiguous blocks
+SearchCube<Cube>(*IN*const RunOptionsRec& options,
+				 *IN/OUT*Cube& colorCube,
+				 *IN/OUT*ColorArr& colorArr,
+				 *OUT*ListClass& largContigList,
+				 *OUT*ListClass& secLargContigList,
+				 *OUT*int& largCol,
+				 *OUT*int& secLargCol,
+				 *OUT*vector<BlockRec>& topBlocks,
+				 *OUT*BlockShapesRec& shapes)
+		- To populate or count a cube of either form and find its largest contiguous blocks
+StreamSearch(*IN*const RunOptionsRec& options,
+			 *IN/OUT*ColorArr& colorArr,
+			 *OUT*ListClass& largContigList,
+			 *OUT*ListClass& secLargContigList,
+			 *OUT*int& largCol,
+			 *OUT*int& secLargCol,
+			 *OUT*long long& largSize,
+			 *OUT*long long& secLargSize,
+			 *OUT*vector<BlockRec>& topBlocks)
+		- To populate a cube file and find its largest contiguous blocks a plane at a time
+FloodSearch<Cube>(*IN/OUT*Cube& colorCube,
+			*IN/OUT*ColorArr& colorArr,
+			*OUT*ListClass& largContigList,
+			*OUT*ListClass& secLargContigList)
+		- To find the largest and second largest contiguous blocks by flood filling
+HaloFloodSearch<Cube>(*IN*const Cube& colorCube,
+				*IN/OUT*ColorArr& colorArr,
+				*OUT*ListClass& largContigList,
+				*OUT*ListClass& secLargContigList)
+		- To find the largest and second largest contiguous blocks by flood filling a halo padded cube
+HaloFloodTopK<Cube>(*IN*const Cube& colorCube,
+			  *IN/OUT*ColorArr& colorArr,
+			  *IN*const int& k,
+			  *IN*const int& type,
+			  *OUT*vector<BlockRec>& blocks)
+		- To find the k largest contiguous blocks, optionally of one color, by flood filling a halo padded cube
+PrintTopBlocks(*IN*const vector<BlockRec>& blocks,
+			   *IN*const string& heading,
+			   *IN/OUT*ReportWriterClass& writer)
+		- To output the color, size and first cell of each of the largest blocks
+PrintGeometry(*IN*const vector<BlockRec>& blocks,
+			  *IN*const BlockShapesRec& shapes,
+			  *IN/OUT*ReportWriterClass& writer)
+		- To output the shape of each of the largest blocks and the amount of blocks of each size
+RecolorCube(*IN/OUT*CubeClass& colCube,
+			*IN*const int& amount,
+			*IN*const int& colorAmt,
+			*OUT*vector<BlockRec>& blocks)
+		- To recolor random cells of the cube and find the two largest blocks after
+RunBatch(*IN*const RunOptionsRec& options)
+		- To populate and search a batch of cubes on a pool of threads and output a line for each
+ReadBatchJobs(*IN*const RunOptionsRec& options,
+			  *OUT*vector<BatchJobRec>& jobs)
+		- To list the seed and dimensions of every cube of a batch
+AnalyzeCube(*IN*const BatchJobRec& job,
+			*IN*const RunOptionsRec& options,
+			*IN/OUT*BatchWorkerRec& worker,
+			*OUT*BatchResultRec& result)
+		- To populate and label a single cube of a batch with the state of its thread
+LabelBatchCube<Cube>(*IN*const BatchJobRec& job,
+					 *IN*const RunOptionsRec& options,
+					 *IN/OUT*Cube& colorCube,
+					 *IN/OUT*BatchWorkerRec& worker)
+		- To populate and label a single cube of a batch, for either form of the cube
+PrintBatch(*IN*const vector<BatchJobRec>& jobs,
+		   *IN*const vector<BatchResultRec>& results,
+		   *IN*const PaletteClass& palette,
+		   *IN/OUT*ofstream& bout)
+		- To output the line of every cube of a batch and a summary of the batch
+PopulateCube<Cube>(*OUT*Cube& colCube,
+			 *IN/OUT*ColorArr& colArr,
+			 *IN*const int& threadAmt,
+			 *IN*const int& seed)
 		- To populate the color cube with random colors and to collect data on the amount of each color
-InitializeColorArray(*OUT*ColorArr colArr)
-		- To set all indexes in a ColorArr to 0
+PopulateBlocks<Cube>(*IN/OUT*Cube& colCube,
+			   *IN*const size_t& firstBlock,
+			   *IN*const size_t& endBlock,
+			   *OUT*vector<int>& histogram,
+			   *IN*const int& seed)
+		- To populate a range of blocks of cells with random colors and count them
+PopulateCubeFile(*IN*const string& fileName,
+				 *IN*const RunOptionsRec& options,
+				 *IN/OUT*ColorArr& colArr)
+		- To populate a cube file with random colors a plane at a time
+CountColors<Cube>(*IN*const Cube& colCube,
+			*IN/OUT*ColorArr& colArr)
+		- To collect data on the amount of each color of a loaded cube
+InitializeColorArray(*OUT*ColorArr& colArr,
+					 *IN*const int& colorAmt)
+		- To size a ColorArr for every color of the palette and set all indexes to 0
+ReportFileName(*IN*const ReportFormatEnum& format)
+		- To name the output file of a report format
+PrintReport(*IN/OUT*CubeReportRec& report,
+			*IN/OUT*ReportWriterClass& writer)
+		- To write the report of a cube in the format of the writer
+PrintTextReport(*IN/OUT*CubeReportRec& report,
+				*IN/OUT*ReportWriterClass& writer)
+		- To write the text report, the blocks over the cube and the color statistics
+PrintCsvReport(*IN/OUT*CubeReportRec& report,
+			   *IN/OUT*ReportWriterClass& writer)
+		- To write the report as CSV, a row for every value
+PrintJsonReport(*IN/OUT*CubeReportRec& report,
+				*IN/OUT*ReportWriterClass& writer)
+		- To write the report as a single JSON object
+PrintBinaryReport(*IN/OUT*CubeReportRec& report,
+				  *IN/OUT*ReportWriterClass& writer)
+		- To write the report as 32 and 64 bit integers
 PrintContig(*IN* ListClass& colLocList,
-			*IN* const ColorEnum& cellCol,
-			*IN/OUT*ofstream& dout)
+			*IN* const int& cellCol,
+			*IN* const int& rows,
+			*IN* const int& cols,
+			*IN* const int& deps,
+			*IN/OUT*ReportWriterClass& writer)
 		- To print the cube highlighting a series of cells whose colors are contiguous
 Move(*IN*const DirectionEnum& dir,
 	 *IN/OUT*LocationRec& currPos) 
 		- Increment a LocationRec in a single direction
-ColorStats(*IN*const ColorArr colArr,
-		   *IN/OUT*ofstream& dout)
+ColorStats(*IN*const ColorArr& colArr,
+		   *IN*const size_t& cellAmt,
+		   *IN/OUT*ReportWriterClass& writer)
 		- Output color statistics to an output file
-CoveragePercentage(*IN*const int& colAmt)
+CoveragePercentage(*IN*const long long& colAmt,
+				   *IN*const size_t& cellAmt)
 		- To determine and return the percentage that a color takes up of the cube
-FindPopulousColors(*IN*const ColorArr colArr,
+FindPopulousColors(*IN*const ColorArr& colArr,
 				   *OUT*int& popIndex,
 				   *OUT*int& secPopIndex)
 		- Determine the two most populous colors
-ColorEnumIndexToString(*IN*const int& index)
-		- To convert the integer index of a ColorEnum to a string
+FindTopColors(*IN*const ColorArr& colArr,
+			  *IN*const int& amount,
+			  *OUT*vector<int>& topColors)
+		- To find the most populous colors by a partial selection
 */
-#include<fstream>	// Used to create output files
-#include<iomanip>	// Used for output manipulation
-#include "Cube.h"	// Grants Access to Cube Class
-#include "list.h"	// Grants Access to List Class
-#include <iostream>	// For Testing Purposes
-using namespace std;	// Standard namespace
+#include "ContigClient.h"	// Grants Access to the options and functions of the client
 
 
 
-// Constants
-typedef int ColorArr[MAX_COLOR_AMT][COLOR_TRACKER];	// Array used to store color amount information
 
+// The benchmark reuses the functions below with a main of its own
+#ifndef CUBE_BENCHMARK
 
+int main(int argc, char* argv[])
+{
+	RunOptionsRec options;				// The options chosen on the command line
+
+	// Get the dimensions of the cube and the search to use
+	if (!ReadArguments(argc, argv, options))
+	{
+		cerr << "Usage: " << argv[ZERO] << " [rows cols deps] [-flood] [-halo] [-stream] [-runs] [-packed] [-tiled]"
+			 << " [-chunked] [-sparse] [-connect 6|18|26] [-threads amount] [-top amount] [-color name]"
+			 << " [-geometry] [-save file] [-load file] [-recolor amount] [-seed number] [-seeds first last] [-batch file]"
+			 << " [-report text|csv|json|binary] [-palette file] [-colors amount]" << endl;
+		return 1;
+	}
+
+	// A batch writes its own output file
+	if (options.batch)
+	{
+		if (!RunBatch(options))
+		{
+			cerr << "Unable to read the jobs of " << options.batchName << " or write " << BATCH_FILE_NAME << endl;
+			return 1;
+		}
+
+		INSTRUMENT_REPORT(INSTRUMENT_FILE_NAME);
+		return 0;
+	}
+
+	// A loaded cube brings its own dimensions
+	if (!options.loadName.empty())
+	{
+		try
+		{
+			if (!ReadCubeHeader(options))
+			{
+				cerr << options.loadName << " does not use the colors of the palette" << endl;
+				return 1;
+			}
+		}
+		catch (CubeFileException)
+		{
+			cerr << "Unable to load " << options.loadName << endl;
+			return 1;
+		}
+	}
+
+	size_t cellAmt = (size_t)options.rows * options.cols * options.deps;	// The amount of cells in the cube
+	ListClass largContigList((int)min(cellAmt, (size_t)MAX_LIST_LENGTH));	// Holds all positions of the largest 
+												// contiguous block of colors
+	ListClass secLargContigList((int)min(cellAmt, (size_t)MAX_LIST_LENGTH));	// Holds all positions of the second largest 
+												// contiguous block of colors
+	ColorArr colorArr;					// Keeps track of the amount of colors, and the amount checked
+	int largCol = RED;					// The color of the largest contiguous block
+	int secLargCol = RED;				// The color of the second largest contiguous block
+	long long largSize = ZERO;			// The amount of cells in the largest contiguous block
+	long long secLargSize = ZERO;		// The amount of cells in the second largest contiguous block
+	vector<BlockRec> topBlocks;			// The largest blocks asked for with -top
+	vector<BlockRec> recolorBlocks;		// The largest blocks after -recolor
+	BlockShapesRec shapes;				// The shapes measured with -geometry
+	CubeReportRec report;				// Everything the output file is written from
+
+
+	// Set all elements in the color array to zero
+	InitializeColorArray(colorArr, options.palette.GetColorAmt());
+
+
+	// ---------------- Find Largest and Second Largest Contiguous Blocks -----------------
+
+
+	try
+	{
+		// With -stream the cube only ever exists on disk
+		if (options.search == STREAM_SEARCH)
+			StreamSearch(options, colorArr, largContigList, secLargContigList, largCol, secLargCol,
+						 largSize, secLargSize, topBlocks);
+		else
+		{
+			MemorySearch(options, colorArr, largContigList, secLargContigList, largCol, secLargCol,
+						 topBlocks, recolorBlocks, shapes);
+			largSize = largContigList.GetLength();
+			secLargSize = secLargContigList.GetLength();
+		}
+	}
+	catch (CubeFileException)
+	{
+		cerr << "Unable to write or read a cube file, or it holds an unknown color" << endl;
+		return 1;
+	}
+	catch (InvalidDimensionException)
+	{
+		cerr << "Only a cube of at most " << MAX_LABEL_CELLS << " cells can be labeled in memory, use -stream, -flood or -halo" << endl;
+		return 1;
+	}
+
+
+
+
+	// ---------------- The Search Ends -----------------
+
+
+	// Gather what the report is written from
+	INSTRUMENT_TIMER(OUTPUT_TIMER);
+	report.rows = options.rows;
+	report.cols = options.cols;
+	report.deps = options.deps;
+	report.cellAmt = cellAmt;
+	report.largest.type = largCol;
+	report.largest.size = largSize;
+	report.largest.cells = move(largContigList);
+	report.secLargest.type = secLargCol;
+	report.secLargest.size = secLargSize;
+	report.secLargest.cells = move(secLargContigList);
+	report.topAmt = options.topAmt;
+	report.topBlocks = move(topBlocks);
+	report.recolorAmt = options.recolorAmt;
+	report.recolorBlocks = move(recolorBlocks);
+	report.geometry = options.geometry;
+	report.shapes = move(shapes);
+	report.colorArr = move(colorArr);
+
+	// Write the report in the format chosen
+	{
+		ReportWriterClass writer(options.palette.GetNames(), options.report);	// Formats and writes the report
+
+		writer.Open(ReportFileName(options.report));
+		PrintReport(report, writer);
+		writer.Close();
+	}
+	INSTRUMENT_TIMER_STOP(OUTPUT_TIMER);
+
+	// Write the counters and timers next to the output file
+	INSTRUMENT_REPORT(INSTRUMENT_FILE_NAME);
+
+}// end main
+
+#endif // CUBE_BENCHMARK
+
+
+
+
+
+// --------------------------------- FUNCTIONS ------------------------------------------
+
+
+//O(N)
+//Purpose: To read the dimensions of the cube and the search to use from the command line
+//Pre: The command line arguments
+//Post: options holds the desired dimensions, search, labeling, connectivity, storage, threads, report format, palette
+//		and whether the shapes are measured, the defaults
+//		from Constants.h are used when no dimensions are given. Returns false if the arguments are invalid, the palette
+//		can not be made or the color of -color is not in it
+bool ReadArguments(/*IN*/int argc,					// The amount of command line arguments
+				   /*IN*/char* argv[],				// The command line arguments
+				   /*OUT*/RunOptionsRec& options)	// The options chosen
+{
+	int dimensions[DIMENSION_AMT];	// The dimensions given on the command line
+	int dimAmt = ZERO;				// The amount of dimensions given
+
+	// Use the default dimensions and search when none are given
+	options.rows = DEFAULT_ROW;
+	options.cols = DEFAULT_COL;
+	options.deps = DEFAULT_DEP;
+	options.search = LABEL_SEARCH;
+	options.method = CELL_LABELING;
+	options.connectivity = FACE_CONNECTIVITY;
+	options.storage = RECORD_STORAGE;
+	options.threadAmt = OFFSET;
+	options.topAmt = ZERO;
+	options.topType = ANY_TYPE;
+	options.recolorAmt = ZERO;
+	options.seed = SEED;
+	options.lastSeed = SEED;
+	options.batch = false;
+	options.report = TEXT_REPORT;
+	options.palette = PaletteClass();
+	options.topName.clear();
+	options.geometry = false;
+
+	// Cycle through each argument after the program name
+	for (int i = OFFSET; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-flood") == ZERO)
+			options.search = FLOOD_SEARCH;
+
+		else if (strcmp(argv[i], "-halo") == ZERO)
+			options.search = HALO_SEARCH;
+
+		else if (strcmp(argv[i], "-stream") == ZERO)
+			options.search = STREAM_SEARCH;
+
+		else if (strcmp(argv[i], "-runs") == ZERO)
+			options.method = RUN_LABELING;
+
+		else if (strcmp(argv[i], "-packed") == ZERO)
+			options.storage = PACKED_STORAGE;
+
+		else if (strcmp(argv[i], "-tiled") == ZERO)
+			options.storage = TILED_STORAGE;
+
+		else if (strcmp(argv[i], "-chunked") == ZERO)
+			options.storage = CHUNKED_STORAGE;
+
+		else if (strcmp(argv[i], "-sparse") == ZERO)
+			options.storage = SPARSE_STORAGE;
+
+		else if (strcmp(argv[i], "-connect") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.connectivity = (ConnectivityEnum)atoi(argv[i]);
+
+			if (options.connectivity != FACE_CONNECTIVITY && options.connectivity != EDGE_CONNECTIVITY &&
+				options.connectivity != CORNER_CONNECTIVITY)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-threads") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.threadAmt = atoi(argv[i]);
+
+			// Zero uses every core of the machine
+			if (options.threadAmt == ZERO)
+				options.threadAmt = (int)thread::hardware_concurrency();
+
+			if (options.threadAmt <= ZERO)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-top") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.topAmt = atoi(argv[i]);
+
+			if (options.topAmt <= ZERO)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-geometry") == ZERO)
+			options.geometry = true;
+
+		else if (strcmp(argv[i], "-color") == ZERO && i + OFFSET < argc)
+		{
+			// The color is found once the palette is known
+			i++;
+			options.topName = argv[i];
+		}
+
+		else if (strcmp(argv[i], "-recolor") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.recolorAmt = atoi(argv[i]);
+
+			if (options.recolorAmt <= ZERO)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-seed") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.seed = atoi(argv[i]);
+			options.lastSeed = options.seed;
+		}
+
+		else if (strcmp(argv[i], "-seeds") == ZERO && i + 2 < argc)
+		{
+			options.seed = atoi(argv[i + OFFSET]);
+			options.lastSeed = atoi(argv[i + 2]);
+			options.batch = true;
+			i += 2;
+
+			// The seeds run upward
+			if (options.lastSeed < options.seed)
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-batch") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.batchName = argv[i];
+			options.batch = true;
+		}
+
+		else if (strcmp(argv[i], "-report") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+
+			if (strcmp(argv[i], "text") == ZERO)
+				options.report = TEXT_REPORT;
+			else if (strcmp(argv[i], "csv") == ZERO)
+				options.report = CSV_REPORT;
+			else if (strcmp(argv[i], "json") == ZERO)
+				options.report = JSON_REPORT;
+			else if (strcmp(argv[i], "binary") == ZERO)
+				options.report = BINARY_REPORT;
+			else
+				return false;
+		}
+
+		else if (strcmp(argv[i], "-palette") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+
+			try
+			{
+				options.palette = PaletteClass(string(argv[i]));
+			}
+			catch (PaletteException)
+			{
+				return false;
+			}
+		}
+
+		else if (strcmp(argv[i], "-colors") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+
+			try
+			{
+				options.palette = PaletteClass(atoi(argv[i]));
+			}
+			catch (PaletteException)
+			{
+				return false;
+			}
+		}
+
+		else if (strcmp(argv[i], "-save") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.saveName = argv[i];
+		}
+
+		else if (strcmp(argv[i], "-load") == ZERO && i + OFFSET < argc)
+		{
+			i++;
+			options.loadName = argv[i];
+		}
+
+		// Anything else must be a dimension
+		else if (dimAmt < DIMENSION_AMT)
+		{
+			dimensions[dimAmt] = atoi(argv[i]);
+
+			// Every dimension must hold at least one cell
+			if (dimensions[dimAmt] <= ZERO)
+				return false;
+
+			dimAmt++;
+		}
+		else
+			return false;
+	}
+
+	// Either all three dimensions are given or none are
+	if (dimAmt == DIMENSION_AMT)
+	{
+		options.rows = dimensions[0];
+		options.cols = dimensions[1];
+		options.deps = dimensions[2];
+	}
+	else if (dimAmt != ZERO)
+		return false;
+
+	// No more blocks than cells can ever be kept, a loaded cube is checked once its size is known
+	if ((size_t)options.topAmt > (size_t)options.rows * options.cols * options.deps && options.loadName.empty())
+		options.topAmt = (int)((size_t)options.rows * options.cols * options.deps);
+
+	// Only a color of the palette can be reported on its own
+	if (!options.topName.empty())
+	{
+		options.topType = options.palette.FindName(options.topName);
+
+		if (options.topType == NO_COLOR)
+			return false;
+	}
+
+	// The flood fills, the stream labeler and the recoloring only know faces
+	if (options.connectivity != FACE_CONNECTIVITY &&
+		(options.search != LABEL_SEARCH || options.recolorAmt > ZERO))
+		return false;
+
+	// Only the labeler measures the shapes of the blocks
+	if (options.geometry && options.search != LABEL_SEARCH)
+		return false;
+
+	// The stream search never holds the cube in memory, there are no cells to recolor
+	if (options.recolorAmt > ZERO && options.search == STREAM_SEARCH)
+		return false;
+
+	return true;
+}// end ReadArguments
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(C)
+//Purpose: To read the dimensions of a cube file to be loaded and check that it names the
+//		   same colors as the palette, in the same order
+//Pre: options.loadName names a cube file
+//Post: The dimensions in options are those of the file and -top asks for no more blocks than
+//		it has cells. Return true if the palette of the file matches the palette of options,
+//		otherwise false
+//Exception: CubeFileException is thrown if the file can not be opened or is not a cube file
+bool ReadCubeHeader(/*IN/OUT*/RunOptionsRec& options)	// The options naming the cube file
+{
+	CubeFileReaderClass header(options.loadName);	// Reads the header of the file
+
+	options.rows = header.GetRows();
+	options.cols = header.GetCols();
+	options.deps = header.GetDeps();
+
+	// No more blocks than cells can ever be kept
+	if ((size_t)options.topAmt > (size_t)options.rows * options.cols * options.deps)
+		options.topAmt = (int)((size_t)options.rows * options.cols * options.deps);
+
+	return header.GetPalette() == options.palette.GetNames();
+}// end ReadCubeHeader
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate or load a cube in memory and find its largest contiguous blocks with
+//		   the search chosen on the command line
+//Pre: The options chosen, the color array set to its default values
+//Post: The color array holds the amount of each color, the lists hold the cells of the largest
+//		and second largest contiguous blocks and the colors hold their colors. When -top is
+//		given topBlocks holds the largest blocks asked for. When -save is given the cube is saved.
+//		When -recolor is given recolorBlocks holds the two largest blocks after recoloring.
+//		When -geometry is given shapes holds the shape of each -top block and the sizes of every block
+//Exception: CubeFileException is thrown if a cube file can not be written or read, or holds
+//			 an unknown color
+void MemorySearch(/*IN*/const RunOptionsRec& options,		// The options chosen
+				  /*IN/OUT*/ColorArr& colorArr,				// The amount of each color, and the amount checked
+				  /*OUT*/ListClass& largContigList,			// The cells of the largest contiguous block
+				  /*OUT*/ListClass& secLargContigList,		// The cells of the second largest contiguous block
+				  /*OUT*/int& largCol,						// The color of the largest contiguous block
+				  /*OUT*/int& secLargCol,					// The color of the second largest contiguous block
+				  /*OUT*/vector<BlockRec>& topBlocks,		// The largest blocks asked for with -top
+				  /*OUT*/vector<BlockRec>& recolorBlocks,	// The largest blocks after -recolor
+				  /*OUT*/BlockShapesRec& shapes)			// The shapes measured with -geometry
+{
+	// A populated cube of the default dimensions is fixed when compiled, so its indexing and
+	// bounds checks fold to constants. A loaded or recolored cube is only known when run
+	if (options.rows == DEFAULT_ROW && options.cols == DEFAULT_COL && options.deps == DEFAULT_DEP &&
+		options.storage == RECORD_STORAGE && options.loadName.empty() && options.recolorAmt == ZERO)
+	{
+		DefaultCubeClass colorCube;		// Simulates and holds data on ColorCube
+
+		SearchCube(options, colorCube, colorArr, largContigList, secLargContigList, largCol,
+				   secLargCol, topBlocks, shapes);
+	}
+	else
+	{
+		CubeClass colorCube = options.loadName.empty() || options.storage != RECORD_STORAGE
+			? CubeClass(options.rows, options.cols, options.deps, options.storage, options.palette.GetColorAmt())
+			: CubeClass(options.loadName);	// Simulates and holds data on ColorCube
+
+		// A cube file is only mapped when no storage is asked for, otherwise it is read in
+		if (!options.loadName.empty() && options.storage != RECORD_STORAGE)
+		{
+			INSTRUMENT_TIMER(POPULATE_TIMER);
+
+			LoadCube(colorCube, options.loadName);
+		}
+
+		SearchCube(options, colorCube, colorArr, largContigList, secLargContigList, largCol,
+				   secLargCol, topBlocks, shapes);
+
+		// Recolor cells once every other search is done
+		if (options.recolorAmt > ZERO)
+		{
+			INSTRUMENT_TIMER(RECOLOR_TIMER);
+
+			RecolorCube(colorCube, options.recolorAmt, options.palette.GetColorAmt(), recolorBlocks);
+		}
+	}
+
+}// end MemorySearch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate or count a cube in memory and find its largest contiguous blocks with
+//		   the search chosen on the command line, for either form of the cube
+//Pre: The options chosen, the cube is empty unless it was loaded, the color array set to its
+//	   default values
+//Post: The color array holds the amount of each color, the lists hold the cells of the largest
+//		and second largest contiguous blocks and the colors hold their colors. When -top is
+//		given topBlocks holds the largest blocks asked for. When -save is given the cube is saved.
+//		When -geometry is given shapes holds the shape of each -top block and the sizes of every block
+//Exception: CubeFileException is thrown if the cube file can not be written
+template <class Cube>
+void SearchCube(/*IN*/const RunOptionsRec& options,			// The options chosen
+				/*IN/OUT*/Cube& colorCube,					// The cube being searched
+				/*IN/OUT*/ColorArr& colorArr,				// The amount of each color, and the amount checked
+				/*OUT*/ListClass& largContigList,			// The cells of the largest contiguous block
+				/*OUT*/ListClass& secLargContigList,		// The cells of the second largest contiguous block
+				/*OUT*/int& largCol,						// The color of the largest contiguous block
+				/*OUT*/int& secLargCol,						// The color of the second largest contiguous block
+				/*OUT*/vector<BlockRec>& topBlocks,			// The largest blocks asked for with -top
+				/*OUT*/BlockShapesRec& shapes)				// The shapes measured with -geometry
+{
+	LabelerClass labeler;				// Labels every contiguous block of the cube
+	int largLabel;						// The label of the largest contiguous block
+	int secLargLabel;					// The label of the second largest contiguous block
+
+	// Populate the cube with random colors, or count the colors of the loaded cube
+	{
+		INSTRUMENT_TIMER(POPULATE_TIMER);
+
+		if (options.loadName.empty())
+			PopulateCube(colorCube, colorArr, options.threadAmt, options.seed);
+		else
+			CountColors(colorCube, colorArr);
+
+		// A chunked or sparse cube keeps every chunk of one color as a single value
+		colorCube.Compact();
+	}
+
+	// Save the cube to be loaded again
+	if (!options.saveName.empty())
+	{
+		INSTRUMENT_TIMER(SAVE_TIMER);
+
+		SaveCube(colorCube, options.saveName, options.palette.GetNames());
+	}
+
+	{
+		INSTRUMENT_TIMER(SEARCH_TIMER);
+
+		if (options.search == FLOOD_SEARCH)
+		{
+			// Search block by block with the original flood fill
+			FloodSearch(colorCube, colorArr, largContigList, secLargContigList);
+		}
+		else if (options.search == HALO_SEARCH)
+		{
+			// Search block by block without checking bounds
+			HaloFloodSearch(colorCube, colorArr, largContigList, secLargContigList);
+		}
+		else
+		{
+			// Label every block of the cube in one sweep
+			labeler.SetMethod(options.method);
+			labeler.SetConnectivity(options.connectivity);
+			labeler.SetGeometry(options.geometry);
+			labeler.Label(colorCube, options.threadAmt);
+
+			// Only the cells of the two largest blocks are gathered
+			labeler.FindLargest(largLabel, secLargLabel);
+
+			if (largLabel != NO_LABEL)
+				labeler.GetComponentCells(largLabel, largContigList);
+
+			if (secLargLabel != NO_LABEL)
+				labeler.GetComponentCells(secLargLabel, secLargContigList);
+		}
+	}
+
+	// Get the color of each block while the cube is in memory
+	largContigList.FirstPosition();
+	if (!largContigList.IsEmpty())
+		largCol = colorCube.GetType(largContigList.Retrieve().key);
+
+	secLargContigList.FirstPosition();
+	if (!secLargContigList.IsEmpty())
+		secLargCol = colorCube.GetType(secLargContigList.Retrieve().key);
+
+	// Find the largest blocks when asked for
+	if (options.topAmt > ZERO)
+	{
+		INSTRUMENT_TIMER(TOP_TIMER);
+
+		if (options.search == LABEL_SEARCH)
+		{
+			labeler.FindTopK(options.topAmt, topBlocks, options.topType);
+
+			// The labeler measured each block while labeling, the id of a block is its label
+			if (options.geometry)
+				for (size_t i = 0; i < topBlocks.size(); i++)
+					shapes.topShapes.push_back(labeler.GetGeometry((int)topBlocks[i].id));
+		}
+		else
+		{
+			// The flood search needs the checked counts back at zero
+			for (int i = 0; i < colorArr.GetColorAmt(); i++)
+				colorArr[i][OFFSET] = ZERO;
+
+			HaloFloodTopK(colorCube, colorArr, options.topAmt, options.topType, topBlocks);
+		}
+	}
+
+	// The sizes of every block are known from the labeling
+	if (options.geometry)
+		labeler.GetSizeHistogram(shapes.sizeHistogram);
+
+}// end SearchCube
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate a cube file and find its largest contiguous blocks a plane at a time,
+//		   the whole cube is never held in memory
+//Pre: The options chosen, the color array set to its default values
+//Post: The cube file holds the cube, the color array holds the amount of each color, the
+//		lists hold the cells of the largest and second largest contiguous blocks and the colors
+//		and sizes hold their colors and sizes. A block of more than MAX_LIST_LENGTH cells only
+//		lists its first cell. When -top is given topBlocks holds the largest blocks asked for.
+//		The cube file is the -load file, else the -save file, else STREAM_FILE_NAME
+//Exception: CubeFileException is thrown if the cube file can not be written or read, or holds
+//			 an unknown color
+void StreamSearch(/*IN*/const RunOptionsRec& options,		// The options chosen
+				  /*IN/OUT*/ColorArr& colorArr,				// The amount of each color, and the amount checked
+				  /*OUT*/ListClass& largContigList,			// The cells of the largest contiguous block
+				  /*OUT*/ListClass& secLargContigList,		// The cells of the second largest contiguous block
+				  /*OUT*/int& largCol,						// The color of the largest contiguous block
+				  /*OUT*/int& secLargCol,					// The color of the second largest contiguous block
+				  /*OUT*/long long& largSize,				// The amount of cells in the largest contiguous block
+				  /*OUT*/long long& secLargSize,			// The amount of cells in the second largest contiguous block
+				  /*OUT*/vector<BlockRec>& topBlocks)		// The largest blocks asked for with -top
+{
+	StreamLabelerClass streamLabeler;		// Labels the cube file a plane at a time
+	TopBlocksClass largest(COLOR_TRACKER);	// The two largest blocks closed so far
+	TopBlocksClass asked(options.topAmt > ZERO ? options.topAmt : OFFSET);	// The blocks asked for with -top
+	vector<BlockRec> blocks;				// The two largest blocks
+	string fileName = STREAM_FILE_NAME;		// The cube file labeled
+
+	if (!options.loadName.empty())
+		fileName = options.loadName;
+	else
+	{
+		if (!options.saveName.empty())
+			fileName = options.saveName;
+
+		// Populate the cube straight to disk
+		INSTRUMENT_TIMER(POPULATE_TIMER);
+		PopulateCubeFile(fileName, options, colorArr);
+	}
+
+	// The rest of the search is timed
+	INSTRUMENT_TIMER(SEARCH_TIMER);
+
+	// Keep only the largest blocks as they close, ties go to the block whose first cell comes first in scan order
+	streamLabeler.Label(fileName, [&](const ComponentRec& closed)
+	{
+		BlockRec closedBlock;	// The block that closed
+
+		// The colors of a loaded cube are counted a block at a time
+		if (!options.loadName.empty())
+		{
+			if (closed.type < ZERO || closed.type >= colorArr.GetColorAmt())
+				throw CubeFileException();
+
+			colorArr[closed.type][ZERO] += closed.size;
+		}
+
+		closedBlock.type = closed.type;
+		closedBlock.size = closed.size;
+		closedBlock.id = ScanOrder(closed.firstCell, streamLabeler.GetCols(), streamLabeler.GetDeps());
+
+		if (options.topAmt > ZERO && (options.topType == ANY_TYPE || closed.type == options.topType))
+		{
+			BlockRec askedBlock = closedBlock;	// A copy for the blocks asked for
+			asked.Offer(askedBlock);
+		}
+
+		largest.Offer(closedBlock);
+	});
+
+	// Only the cells of the kept blocks are gathered
+	largest.TakeSorted(blocks);
+	streamLabeler.GatherCells(blocks);
+
+	largSize = ZERO;
+	secLargSize = ZERO;
+
+	if (blocks.size() > ZERO)
+	{
+		largCol = blocks[ZERO].type;
+		largSize = blocks[ZERO].size;
+		largContigList = move(blocks[ZERO].cells);
+	}
+
+	if (blocks.size() > OFFSET)
+	{
+		secLargCol = blocks[OFFSET].type;
+		secLargSize = blocks[OFFSET].size;
+		secLargContigList = move(blocks[OFFSET].cells);
+	}
+
+	if (options.topAmt > ZERO)
+	{
+		asked.TakeSorted(topBlocks);
+		streamLabeler.GatherCells(topBlocks);
+	}
+
+}// end StreamSearch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To find the largest and second largest contiguous blocks by flood filling
+//		   the cube one block at a time
+//Pre: The cube must be populated with every cell unchecked, and the color array must hold
+//	   the amount of each color with none checked
+//Post: Every cell of the cube is checked, and the lists hold the cells of the largest and
+//		second largest contiguous blocks. A cell of a loaded cube with no color is skipped
+template <class Cube>
+void FloodSearch(/*IN/OUT*/Cube& colorCube,					// The cube being searched
+				 /*IN/OUT*/ColorArr& colorArr,					// The amount of each color, and the amount checked
+				 /*OUT*/ListClass& largContigList,				// The cells of the largest contiguous block
+				 /*OUT*/ListClass& secLargContigList)			// The cells of the second largest contiguous block
+{
+	ListClass currList((int)min(colorCube.GetCellCount(), (size_t)MAX_LIST_LENGTH));	// The current contiguous block being checked
+	ItemRec currItem;					// The current item / position being viewed
+	LocationRec startLoc;				// The cell the current block was started from
+	int currCol = EMPTY_CELL;			// The current color being viewed
+
+
+	// Set the initial position to zero
+	currItem.key.x = 0;
+	currItem.key.y = 0;
+	currItem.key.z = 0;
+	
+
+	// Repeats until the whole cube is checked, the last cell included
+	while (currItem.key.x < colorCube.GetRows())
+	{
+		try
+		{
+			// Get the color of the cell
+			currCol = colorCube.GetType(currItem.key);
+		}
+		catch (EmptyTypeException)
+		{
+			// A cell of a loaded cube may have no color, it belongs to no block
+			colorCube.SetStatus(currItem.key, CHECKED);
+		}
+		INSTRUMENT_COUNT(CELLS_VISITED);
+
+		// Check if the status of the cell is not checked
+		if (!colorCube.GetStatus(currItem.key))
+		{
+			// The cell hasn't been checked yet!
+
+			// Remember where the search left off
+			startLoc = currItem.key;
+			 
+			// Check if the color has no chance at being one of the 
+			// top two largest contiguous colors
+			if (colorArr[(int)currCol][ZERO] - colorArr[(int)currCol][OFFSET] <= 
+				secLargContigList.GetLength())
+			{
+				// This cell has no chance, set it to checked and move on
+				colorCube.SetStatus(currItem.key, CHECKED);
+				INSTRUMENT_COUNT(BLOCKS_PRUNED);
+			}
+			else
+			{
+				// Reset the current list
+				currList.Clear();
+
+				// Insert the first spot in the list
+				currList.Insert(currItem);
+
+				// Set the status of the cell to checked
+				colorCube.SetStatus(currItem.key, CHECKED);
+				
+				// Increment the amount of colors checked in the color array
+				colorArr[(int)currCol][OFFSET]++;
+
+				do
+				{
+					// Chech each adjacent cell to see if it is the same color
+					// and that it has not yet been checked
+					for (int i = 0; i < MAX_NUM_DIR; i++)
+					{
+						// Update the location
+						Move((DirectionEnum)i, currItem.key);
+						INSTRUMENT_COUNT(NEIGHBOR_PROBES);
+
+						try
+						{
+							// Check if the cell is the same color and hasn't yet been checked
+							if (colorCube.GetType(currItem.key) == currCol && 
+								colorCube.GetStatus(currItem.key) != CHECKED)
+							{
+								// Insert the location if it is contiguous with the starting block
+								currList.Insert(currItem);
+
+								// Set the cell to checked
+								colorCube.SetStatus(currItem.key, CHECKED);
+
+								// Increment the amount of colors checked in the color array
+								colorArr[(int)currCol][OFFSET]++;
+							}
+						}
+						catch (OutOfBoundsException)
+						{
+							// Do nothing just move on
+						}
+						catch (EmptyTypeException)
+						{
+							// A cell with no color is never contiguous, move on
+						}
+
+						// Move the location back to the starting location
+						if (i % 2 == ZERO)	// If the index is even offset by positive one
+							Move((DirectionEnum)(i + OFFSET), currItem.key);
+
+						else				// Else offset by negative one
+							Move((DirectionEnum)(i - OFFSET), currItem.key);
+
+					}// end for
+
+					// Go to the oldest cell addition and check repeat the contiguous check on it
+					currList.NextPosition();
+
+					// Update the location to the new position to be checked, the list
+					// only holds its entries so the end is never retrieved
+					if (!currList.EndOfList())
+					{
+						currItem = currList.Retrieve();
+						INSTRUMENT_COUNT(CELLS_VISITED);
+					}
+
+					// Repeat until all of currlist has been checked
+				} while (currList.EndOfList() == false);
+				
+				// Check to see if the current list is will become either the 
+				// largest contiguous block of colors or the second largest
+				// The lists are swapped rather than copied, currList is cleared before its next use
+				if (currList.GetLength() > largContigList.GetLength())	// Current is the largest
+				{
+					// Largest becomes the second largest
+					secLargContigList.Swap(largContigList);
+
+					// Current list becomes the largest
+					largContigList.Swap(currList);
+				}
+				// Current is the second largest
+				else if (currList.GetLength() > secLargContigList.GetLength())	
+				{
+					// Current list becomes the second largest
+					secLargContigList.Swap(currList);
+				}
+
+			}// end else
+
+			// Reset the location back to the original location
+			currItem.key = startLoc;
+
+		}// end if
+
+		
+		// Increment to the next cell column wise
+		currItem.key.y++;
+
+		// Check if the position should be moved to the next depth
+		if (currItem.key.y >= colorCube.GetCols())
+		{
+			// Increment depth
+			currItem.key.z++;
+			// Reset Column
+			currItem.key.y = 0;
+		}
+		// Check if the position should be moved to the next row
+		if(currItem.key.z >= colorCube.GetDeps())
+		{
+			// Increment row
+			currItem.key.x++;
+			// Reset depth
+			currItem.key.z = 0;
+		}
+
+	}// end while
+
+}// end FloodSearch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To find the largest and second largest contiguous blocks by flood filling
+//		   a halo padded copy of the cube one block at a time
+//Pre: The cube must be populated, and the color array must hold the amount of each color
+//	   with none checked
+//Post: The lists hold the cells of the largest and second largest contiguous blocks,
+//		the cube itself is left untouched
+template <class Cube>
+void HaloFloodSearch(/*IN*/const Cube& colorCube,				// The cube being searched
+					 /*IN/OUT*/ColorArr& colorArr,				// The amount of each color, and the amount checked
+					 /*OUT*/ListClass& largContigList,			// The cells of the largest contiguous block
+					 /*OUT*/ListClass& secLargContigList)		// The cells of the second largest contiguous block
+{
+	vector<BlockRec> blocks;	// The two largest blocks
+
+	// The two largest blocks are the top two of every color
+	HaloFloodTopK(colorCube, colorArr, COLOR_TRACKER, ANY_TYPE, blocks);
+
+	largContigList.Clear();
+	secLargContigList.Clear();
+
+	if (blocks.size() > ZERO)
+		largContigList = move(blocks[ZERO].cells);
+
+	if (blocks.size() > OFFSET)
+		secLargContigList = move(blocks[OFFSET].cells);
+
+}// end HaloFloodSearch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3 + B log K)
+//Purpose: To find the k largest contiguous blocks by flood filling a halo padded copy of the
+//		   cube one block at a time. Neighbors are reached through the offset table, halo cells
+//		   never match so no bounds are checked and nothing is thrown. A color is skipped once
+//		   its unchecked cells can not beat the k-th largest block found so far
+//Pre: The cube must be populated, the color array must hold the amount of each color
+//	   with none checked, k > 0
+//Post: blocks holds at most k blocks from largest to smallest, ties go to the block found first.
+//		Only blocks of type are considered unless type is ANY_TYPE. Only blocks that make the
+//		cut when they are found have their cells listed, the cube itself is left untouched
+template <class Cube>
+void HaloFloodTopK(/*IN*/const Cube& colorCube,				// The cube being searched
+				   /*IN/OUT*/ColorArr& colorArr,				// The amount of each color, and the amount checked
+				   /*IN*/const int& k,							// The most blocks to find
+				   /*IN*/const int& type,						// The color of the blocks, or ANY_TYPE
+				   /*OUT*/vector<BlockRec>& blocks)				// The largest blocks
+{
+	HaloCubeClass haloCube(colorCube);	// The padded copy of the cube being searched
+	TopBlocksClass topBlocks(k);		// The largest blocks found so far
+	vector<size_t> currBlock;			// The padded indexes of the current contiguous block
+	ptrdiff_t offsets[MAX_NUM_DIR];		// The index offset of a step in each direction
+	BlockRec foundBlock;				// The block being offered
+	ItemRec currItem;					// The current item / position being viewed
+	size_t start;						// The padded index of the first cell of a block
+	size_t neighbor;					// The padded index of the neighbor being checked
+	int currCol;						// The current color being viewed
+	int blockAmt = ZERO;				// The amount of blocks flood filled
+
+	for (int i = 0; i < MAX_NUM_DIR; i++)
+		offsets[i] = haloCube.GetNeighborOffset((DirectionEnum)i);
+
+	// Start blocks in the same order as the original flood fill, column wise then depth then row
+	for (currItem.key.x = 0; currItem.key.x < colorCube.GetRows(); currItem.key.x++)
+	{
+		for (currItem.key.z = 0; currItem.key.z < colorCube.GetDeps(); currItem.key.z++)
+		{
+			for (currItem.key.y = 0; currItem.key.y < colorCube.GetCols(); currItem.key.y++)
+			{
+				start = haloCube.GetIndex(currItem.key);
+
+				// Skip cells already within a block
+				if (haloCube.GetStatusAt(start))
+					continue;
+
+				currCol = haloCube.GetTypeAt(start);
+				INSTRUMENT_COUNT(CELLS_VISITED);
+
+				// Skip empty cells and colors that were not asked for
+				if (currCol == EMPTY_CELL || (type != ANY_TYPE && currCol != type))
+				{
+					haloCube.SetStatusAt(start);
+					continue;
+				}
+
+				// Skip colors that have no chance at being one of the k largest contiguous blocks
+				if (colorArr[currCol][ZERO] - colorArr[currCol][OFFSET] <= topBlocks.GetBound())
+				{
+					haloCube.SetStatusAt(start);
+					INSTRUMENT_COUNT(BLOCKS_PRUNED);
+					continue;
+				}
+
+				// The current block doubles as the queue of cells left to expand
+				currBlock.clear();
+				currBlock.push_back(start);
+				haloCube.SetStatusAt(start);
+
+				for (size_t head = 0; head < currBlock.size(); head++)
+				{
+					// The first cell was counted when it was started from
+					if (head > ZERO)
+						INSTRUMENT_COUNT(CELLS_VISITED);
+					INSTRUMENT_ADD(NEIGHBOR_PROBES, MAX_NUM_DIR);
+
+					// Check each adjacent cell, stepping off the cube lands on the halo
+					for (int i = 0; i < MAX_NUM_DIR; i++)
+					{
+						neighbor = currBlock[head] + offsets[i];
+
+						if (haloCube.GetTypeAt(neighbor) == currCol && !haloCube.GetStatusAt(neighbor))
+						{
+							currBlock.push_back(neighbor);
+							haloCube.SetStatusAt(neighbor);
+						}
+					}
+				}
+
+				// Increment the amount of colors checked in the color array
+				colorArr[currCol][OFFSET] += (int)currBlock.size();
+
+				// Only a block that makes the cut has its cells listed
+				if (topBlocks.Accepts((long long)currBlock.size()))
+				{
+					foundBlock.type = currCol;
+					foundBlock.size = (long long)currBlock.size();
+					foundBlock.id = blockAmt;
+					foundBlock.cells = ListClass((int)currBlock.size());
+
+					for (size_t i = 0; i < currBlock.size(); i++)
+					{
+						currItem.key = haloCube.GetLocation(currBlock[i]);
+						foundBlock.cells.Insert(currItem);
+					}
+
+					// Reset the location back to the original location
+					currItem.key = haloCube.GetLocation(start);
+
+					topBlocks.Offer(foundBlock);
+				}
+
+				blockAmt++;
+
+			}// end y
+		}// end z
+	}// end x
+
+	topBlocks.TakeSorted(blocks);
+
+}// end HaloFloodTopK
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(K)
+//Purpose: To output the color, size and first cell of each of the largest blocks
+//Pre: The writer's file must be open, the largest blocks from largest to smallest
+//Post: Each block is outputted on its own line, ranked from largest
+void PrintTopBlocks(/*IN*/const vector<BlockRec>& blocks,	// The largest blocks
+					/*IN*/const string& heading,			// Printed before the title
+					/*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the output file
+{
+	LocationRec firstCell;	// The first cell listed for a block
+
+	// Output title
+	writer.PutText("\n\n");
+	writer.PutText(heading);
+	writer.PutText("Largest ");
+	writer.PutInt((long long)blocks.size());
+	writer.PutText(" Contiguous Blocks:\n");
+
+	for (size_t i = 0; i < blocks.size(); i++)
+	{
+		firstCell = blocks[i].cells.Retrieve().key;
+
+		writer.PutInt((long long)i + OFFSET);
+		writer.PutText(".\t");
+		writer.PutName(blocks[i].type);
+		writer.PutChar('\t');
+		writer.PutInt(blocks[i].size);
+		writer.PutText(" cells, starting at (");
+		writer.PutInt(firstCell.x);
+		writer.PutText(", ");
+		writer.PutInt(firstCell.y);
+		writer.PutText(", ");
+		writer.PutInt(firstCell.z);
+		writer.PutText(")\n");
+	}
+
+}// end PrintTopBlocks
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(K + B)
+//Purpose: To output the shape of each of the largest blocks and the amount of blocks of each size
+//Pre: The writer's file must be open, the largest blocks from largest to smallest, the shape of
+//	   each of them and the size histogram of every block
+//Post: Each block's bounding box, centroid, exposed faces and the faces of the cube it touches
+//		are outputted on its own line, ranked from largest, then a line for each range of sizes.
+//		The shapes are left out when no block was measured
+void PrintGeometry(/*IN*/const vector<BlockRec>& blocks,		// The largest blocks
+				   /*IN*/const BlockShapesRec& shapes,			// The shapes of the blocks and the sizes of every block
+				   /*IN/OUT*/ReportWriterClass& writer)		// Formats and writes the output file
+{
+	bool touches;	// True once a face of the cube the block touches is outputted
+
+	// Output title, only the blocks of -top are measured
+	if (!shapes.topShapes.empty())
+	{
+		writer.PutText("\n\nShapes of the Largest ");
+		writer.PutInt((long long)blocks.size());
+		writer.PutText(" Contiguous Blocks:\n");
+	}
+
+	for (size_t i = 0; i < shapes.topShapes.size(); i++)
+	{
+		const GeometryRec& shape = shapes.topShapes[i];	// The shape of the block
+
+		writer.PutInt((long long)i + OFFSET);
+		writer.PutText(".\t");
+		writer.PutName(blocks[i].type);
+		writer.PutText("\trows ");
+		writer.PutInt(shape.low.x);
+		writer.PutText(" to ");
+		writer.PutInt(shape.high.x);
+		writer.PutText(", columns ");
+		writer.PutInt(shape.low.y);
+		writer.PutText(" to ");
+		writer.PutInt(shape.high.y);
+		writer.PutText(", faces ");
+		writer.PutInt(shape.low.z);
+		writer.PutText(" to ");
+		writer.PutInt(shape.high.z);
+		writer.PutText(", centroid (");
+		writer.PutFixed(shape.centerX);
+		writer.PutText(", ");
+		writer.PutFixed(shape.centerY);
+		writer.PutText(", ");
+		writer.PutFixed(shape.centerZ);
+		writer.PutText("), ");
+		writer.PutInt(shape.exposedFaces);
+		writer.PutText(" exposed faces, touches");
+
+		touches = false;
+		for (int f = 0; f < CUBE_FACE_AMT; f++)
+		{
+			if (shape.cubeFaces & (OFFSET << f))
+			{
+				writer.PutChar(' ');
+				writer.PutText(CUBE_FACE_NAMES[f]);
+				touches = true;
+			}
+		}
+
+		if (!touches)
+			writer.PutText(" no face of the cube");
+		writer.PutChar('\n');
+	}
+
+	// Output the amount of blocks of each range of sizes
+	writer.PutText("\n\nContiguous Blocks by Size:\n");
+
+	for (size_t b = 0; b < shapes.sizeHistogram.size(); b++)
+	{
+		writer.PutInt(1LL << b);
+		writer.PutText(" to ");
+		writer.PutInt((2LL << b) - OFFSET);
+		writer.PutText(" cells:\t");
+		writer.PutInt(shapes.sizeHistogram[b]);
+		writer.PutText(" blocks\n");
+	}
+
+}// end PrintGeometry
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(A * size of the blocks touched), A is the amount of cells recolored
+//Purpose: To recolor random cells of the cube and find the two largest blocks after. The cube
+//		   keeps its blocks current as each cell changes, the cube is never searched again
+//Pre: The cube, the amount of cells to recolor and the amount of colors in the palette
+//Post: amount cells drawn with RECOLOR_SEED are given colors of the palette drawn with
+//		RECOLOR_SEED, blocks holds the two largest blocks after with their cells
+void RecolorCube(/*IN/OUT*/CubeClass& colCube,		// The cube being recolored
+				 /*IN*/const int& amount,			// The amount of cells recolored
+				 /*IN*/const int& colorAmt,			// The amount of colors in the palette
+				 /*OUT*/vector<BlockRec>& blocks)	// The two largest blocks after
+{
+	size_t cellIndex;		// The linear index of the cell being recolored
+	LocationRec currLoc;	// The cell being recolored
+
+	// Label every block once
+	colCube.EnableComponents();
+
+	for (int i = 0; i < amount; i++)
+	{
+		// Each recolor draws its cell and its color from counters of its own
+		cellIndex = MixCell(RECOLOR_SEED, (uint64_t)i * COLOR_TRACKER) % colCube.GetCellCount();
+		currLoc.x = (int)(cellIndex / ((size_t)colCube.GetCols() * colCube.GetDeps()));
+		currLoc.y = (int)(cellIndex / colCube.GetDeps() % colCube.GetCols());
+		currLoc.z = (int)(cellIndex % colCube.GetDeps());
+
+		colCube.SetType(currLoc, (CellType)RandomCellType(RECOLOR_SEED, (uint64_t)i * COLOR_TRACKER + OFFSET, colorAmt));
+	}
+
+	colCube.GetComponents().FindTopK(COLOR_TRACKER, blocks);
+}// end RecolorCube
+
+
+// --------------------------------------------------------------------------------------
+
+
+
+//O(B * N^3 / T) : B cubes on T threads
+//Purpose: To populate and search a batch of cubes on a pool of threads and output a line for each.
+//		   The threads, the output file and each thread's cube and labeler are made once for the
+//		   whole batch, each cube is populated and labeled by a single thread
+//Pre: The options chosen, options.batch is true
+//Post: BATCH_FILE_NAME holds a line for every cube in the order of the seeds and a summary
+//		of the batch. Return false if the job file can not be read or the output file written
+bool RunBatch(/*IN*/const RunOptionsRec& options)	// The options chosen
+{
+	vector<BatchJobRec> jobs;			// The cubes of the batch
+	vector<BatchResultRec> results;		// The result of every cube, by job
+	ofstream bout;						// The batch output file
+
+	if (!ReadBatchJobs(options, jobs))
+		return false;
+
+	bout.open(BATCH_FILE_NAME);
+	if (!bout)
+		return false;
+
+	results.resize(jobs.size());
+
+	{
+		INSTRUMENT_TIMER(BATCH_TIMER);
+		ThreadPoolClass pool(options.threadAmt);						// Runs a cube on each thread at a time
+		vector<BatchWorkerRec> workers((size_t)pool.GetThreadAmt());	// What each thread keeps between cubes
+
+		// A thread that draws small cubes steals from the threads with large ones
+		pool.Run((int)jobs.size(), [&](const int& job, const int& worker)
+		{
+			AnalyzeCube(jobs[job], options, workers[worker], results[job]);
+		});
+	}
+
+	PrintBatch(jobs, results, options.palette, bout);
+
+	bout.close();
+
+	return !bout.fail();
+}// end RunBatch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(B)
+//Purpose: To list the seed and dimensions of every cube of a batch
+//Pre: The options chosen, options.batch is true
+//Post: jobs holds a cube for every seed from options.seed to options.lastSeed, or for every
+//		line of the job file. Return false if the job file can not be opened, or a line is
+//		not a seed followed by nothing or by three dimensions greater than 0
+bool ReadBatchJobs(/*IN*/const RunOptionsRec& options,	// The options naming the seeds
+				   /*OUT*/vector<BatchJobRec>& jobs)	// The cubes of the batch
+{
+	ifstream din;			// The job file
+	string line;			// The current line of the job file
+	BatchJobRec job;		// The cube of the current line
+	string extra;			// Anything after the dimensions of a line
+
+	jobs.clear();
+
+	// A range of seeds shares the given dimensions
+	if (options.batchName.empty())
+	{
+		for (long long seed = options.seed; seed <= options.lastSeed; seed++)
+			jobs.push_back({ (int)seed, options.rows, options.cols, options.deps });
+
+		return true;
+	}
+
+	din.open(options.batchName);
+	if (!din)
+		return false;
+
+	while (getline(din, line))
+	{
+		istringstream fields(line);	// The fields of the current line
+
+		// Blank lines are skipped
+		if (!(fields >> job.seed))
+		{
+			if (line.find_first_not_of(" \t\r") != string::npos)
+				return false;
+
+			continue;
+		}
+
+		// A seed alone uses the given dimensions
+		if (!(fields >> job.rows))
+		{
+			job.rows = options.rows;
+			job.cols = options.cols;
+			job.deps = options.deps;
+		}
+		else if (!(fields >> job.cols >> job.deps) || job.rows <= ZERO || job.cols <= ZERO || job.deps <= ZERO)
+			return false;
+
+		fields.clear();
+		if (fields >> extra)
+			return false;
+
+		jobs.push_back(job);
+	}
+
+	return true;
+}// end ReadBatchJobs
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate and label a single cube of a batch with the state of its thread. The
+//		   thread's cube is only made again when the dimensions change
+//Pre: The cube being analyzed, the options chosen, and what the thread running it keeps
+//Post: result holds the amount of blocks, the two largest blocks and the most populous color
+//		of the cube. They are the same as a single run with -seed gives
+void AnalyzeCube(/*IN*/const BatchJobRec& job,				// The cube being analyzed
+				 /*IN*/const RunOptionsRec& options,		// The options chosen
+				 /*IN/OUT*/BatchWorkerRec& worker,			// What the thread keeps between cubes
+				 /*OUT*/BatchResultRec& result)				// The result of the cube
+{
+	int largLabel;			// The label of the largest contiguous block
+	int secLargLabel;		// The label of the second largest contiguous block
+	ComponentRec block;		// The details of a block
+
+	// A cube of the default dimensions held as records uses the thread's fixed cube
+	if (job.rows == DEFAULT_ROW && job.cols == DEFAULT_COL && job.deps == DEFAULT_DEP &&
+		options.storage == RECORD_STORAGE)
+		LabelBatchCube(job, options, worker.defaultCube, worker);
+	else
+	{
+		// Every cell is populated again, so a cube of the same dimensions can be reused
+		if (!worker.cube || worker.cube->GetRows() != job.rows || worker.cube->GetCols() != job.cols
+			|| worker.cube->GetDeps() != job.deps)
+		{
+			worker.cube.reset();	// The old cube is freed before the new one is made
+			worker.cube.reset(new CubeClass(job.rows, job.cols, job.deps, options.storage, options.palette.GetColorAmt()));
+		}
+
+		LabelBatchCube(job, options, *worker.cube, worker);
+	}
+
+	worker.labeler.FindLargest(largLabel, secLargLabel);
+
+	result.blockAmt = worker.labeler.GetComponentCount();
+	result.largType = ANY_TYPE;
+	result.largSize = ZERO;
+	result.secLargType = ANY_TYPE;
+	result.secLargSize = ZERO;
+
+	if (largLabel != NO_LABEL)
+	{
+		block = worker.labeler.GetComponent(largLabel);
+		result.largType = block.type;
+		result.largSize = (int)block.size;
+	}
+
+	if (secLargLabel != NO_LABEL)
+	{
+		block = worker.labeler.GetComponent(secLargLabel);
+		result.secLargType = block.type;
+		result.secLargSize = (int)block.size;
+	}
+
+	// The first color wins a tie, as in FindPopulousColors
+	result.popType = ZERO;
+	for (int i = OFFSET; i < (int)worker.histogram.size(); i++)
+		if (worker.histogram[i] > worker.histogram[result.popType])
+			result.popType = i;
+
+	result.popAmt = worker.histogram[result.popType];
+}// end AnalyzeCube
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate and label a single cube of a batch, for either form of the cube
+//Pre: The cube being analyzed, the options chosen, a cube of the job's dimensions and what
+//	   the thread running it keeps
+//Post: The cube holds the job's colors, the thread's histogram holds the amount of each color
+//		and its labeler holds every contiguous block of the cube
+template <class Cube>
+void LabelBatchCube(/*IN*/const BatchJobRec& job,			// The cube being analyzed
+					/*IN*/const RunOptionsRec& options,		// The options chosen
+					/*IN/OUT*/Cube& colorCube,				// The cube being populated and labeled
+					/*IN/OUT*/BatchWorkerRec& worker)		// What the thread keeps between cubes
+{
+	size_t blockAmt = (colorCube.GetCellCount() + POPULATE_BLOCK - OFFSET) / POPULATE_BLOCK;	// The amount of blocks
+
+	worker.histogram.assign(options.palette.GetColorAmt(), ZERO);
+	PopulateBlocks(colorCube, ZERO, blockAmt, worker.histogram, job.seed);
+
+	// The batch is already spread over the threads, a cube is labeled by one
+	worker.labeler.SetMethod(options.method);
+	worker.labeler.SetConnectivity(options.connectivity);
+	worker.labeler.Label(colorCube, OFFSET);
+}// end LabelBatchCube
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(B)
+//Purpose: To output the line of every cube of a batch and a summary of the batch
+//Pre: Output file must be open, the cubes of the batch, the result of every cube and the palette
+//Post: A line per cube holds its seed, dimensions, amount of blocks, two largest blocks and
+//		most populous color. The summary holds the amount of cubes and cells, the average
+//		amount of blocks and size of the largest block, the largest block of the batch and
+//		how often each color held the largest block
+void PrintBatch(/*IN*/const vector<BatchJobRec>& jobs,			// The cubes of the batch
+				/*IN*/const vector<BatchResultRec>& results,	// The result of every cube
+				/*IN*/const PaletteClass& palette,				// The name of every color
+				/*IN/OUT*/ofstream& bout)						// The batch output file
+{
+	unsigned long long cellTotal = ZERO;	// The amount of cells in every cube
+	unsigned long long blockTotal = ZERO;	// The amount of blocks in every cube
+	unsigned long long largTotal = ZERO;	// The sizes of the largest blocks added
+	size_t bestJob = ZERO;					// The cube holding the largest block of the batch
+	size_t worstJob = ZERO;					// The cube whose largest block is the smallest
+	vector<int> largWins(palette.GetColorAmt(), ZERO);	// How often each color held the largest block
+
+	bout << "Seed Rows Cols Deps Blocks Largest Second Principle\n";
+
+	for (size_t i = 0; i < jobs.size(); i++)
+	{
+		bout << jobs[i].seed << " " << jobs[i].rows << " " << jobs[i].cols << " " << jobs[i].deps
+			 << " " << results[i].blockAmt;
+
+		// A cube of one cell has no second block
+		if (results[i].largType == ANY_TYPE)
+			bout << " - 0";
+		else
+			bout << " " << palette.GetName(results[i].largType) << " " << results[i].largSize;
+
+		if (results[i].secLargType == ANY_TYPE)
+			bout << " - 0";
+		else
+			bout << " " << palette.GetName(results[i].secLargType) << " " << results[i].secLargSize;
+
+		bout << " " << palette.GetName(results[i].popType) << " " << results[i].popAmt << "\n";
+
+		cellTotal += (unsigned long long)jobs[i].rows * jobs[i].cols * jobs[i].deps;
+		blockTotal += (unsigned long long)results[i].blockAmt;
+		largTotal += (unsigned long long)results[i].largSize;
+
+		if (results[i].largSize > results[bestJob].largSize)
+			bestJob = i;
+		if (results[i].largSize < results[worstJob].largSize)
+			worstJob = i;
+		if (results[i].largType != ANY_TYPE)
+			largWins[results[i].largType]++;
+	}
+
+	// Output the summary of the batch
+	bout << "\nBatch Summary:\n";
+	bout << "Cubes: " << jobs.size() << "\n";
+	bout << "Cells: " << cellTotal << "\n";
+
+	if (jobs.empty())
+		return;
+
+	bout << fixed << showpoint << setprecision(2);
+	bout << "Average Blocks Per Cube: " << (double)blockTotal / (double)jobs.size() << "\n";
+	bout << "Average Largest Block: " << (double)largTotal / (double)jobs.size() << " cells\n";
+
+	bout << "Largest Block: " << results[bestJob].largSize << " "
+		 << (results[bestJob].largType == ANY_TYPE ? "-" : palette.GetName(results[bestJob].largType))
+		 << " cells, seed " << jobs[bestJob].seed << "\n";
+	bout << "Smallest Largest Block: " << results[worstJob].largSize << " "
+		 << (results[worstJob].largType == ANY_TYPE ? "-" : palette.GetName(results[worstJob].largType))
+		 << " cells, seed " << jobs[worstJob].seed << "\n";
+
+	// Output how often each color held the largest block
+	bout << "Largest Block Colors:";
+	for (int i = 0; i < palette.GetColorAmt(); i++)
+		bout << " " << palette.GetName(i) << " " << largWins[i];
+	bout << "\n";
+}// end PrintBatch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate the color cube with random colors and to collect data on the amount
+//		   of each color. The cube is split into blocks of POPULATE_BLOCK cells, each thread
+//		   populates a run of blocks and counts its own colors, the counts are added at the end
+//Pre: A cube to be populated, an array to store the colors information set to its
+//	   default values, the amount of threads to populate with and the seed of the cube
+//Post: The cube is populated with random colors, and the color amounts will be known.
+//		The cube does not depend on threadAmt
+template <class Cube>
+void PopulateCube(/*OUT*/Cube& colCube,		// The cube being populated
+				  /*IN/OUT*/ColorArr& colArr,		// A tracker to store the amount of each color
+				  /*IN*/const int& threadAmt,		// The amount of threads to populate with
+				  /*IN*/const int& seed)			// The seed of the cube
+{
+	size_t blockAmt = (colCube.GetCellCount() + POPULATE_BLOCK - OFFSET) / POPULATE_BLOCK;	// The amount of blocks
+	size_t workerAmt = (size_t)threadAmt;	// The amount of threads that get blocks
+	vector<size_t> workerStart;				// The first block of each thread, and the block after the last
+	vector<vector<int>> histograms;			// The amount of each color populated by each thread
+	vector<thread> workers;					// The threads populating each run of blocks
+
+	// Every thread gets at least one block
+	if (workerAmt > blockAmt)
+		workerAmt = blockAmt;
+	if (workerAmt < OFFSET)
+		workerAmt = OFFSET;
+
+	workerStart.resize(workerAmt + OFFSET);
+	for (size_t t = 0; t <= workerAmt; t++)
+		workerStart[t] = blockAmt * t / workerAmt;
+
+	histograms.assign(workerAmt, vector<int>(colArr.GetColorAmt(), ZERO));
+
+	// The first run is populated by this thread, every other run by a worker
+	for (size_t t = OFFSET; t < workerAmt; t++)
+		workers.push_back(thread(PopulateBlocks<Cube>, ref(colCube), workerStart[t],
+								 workerStart[t + OFFSET], ref(histograms[t]), seed));
+
+	PopulateBlocks(colCube, workerStart[ZERO], workerStart[OFFSET], histograms[ZERO], seed);
+
+	for (size_t w = 0; w < workers.size(); w++)
+		workers[w].join();
+
+	// Add each thread's color counts
+	for (size_t t = 0; t < workerAmt; t++)
+		for (int c = 0; c < colArr.GetColorAmt(); c++)
+			colArr[c][ZERO] += histograms[t][c];
+}// end PopulateCube
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To populate a range of blocks of cells with random colors and count them
+//Pre: The cube being populated, the range of blocks of POPULATE_BLOCK cells to populate,
+//	   a histogram with a count for every color of the palette set to zero and the seed of the cube
+//Post: Every cell of the blocks holds its random color, histogram holds the amount of each color
+template <class Cube>
+void PopulateBlocks(/*IN/OUT*/Cube& colCube,			// The cube being populated
+					/*IN*/const size_t& firstBlock,		// The first block populated
+					/*IN*/const size_t& endBlock,		// The block after the last populated
+					/*OUT*/vector<int>& histogram,		// The amount of each color populated
+					/*IN*/const int& seed)				// The seed of the cube
+{
+	vector<int> blockTypes(POPULATE_BLOCK);	// The colors of the current block
+	size_t first;							// The linear index of the first cell of the block
+	size_t amount;							// The amount of cells in the block
+
+	for (size_t b = firstBlock; b < endBlock; b++)
+	{
+		first = b * POPULATE_BLOCK;
+		amount = min(POPULATE_BLOCK, colCube.GetCellCount() - first);
 
-// Prototypes
-void PopulateCube(/*OUT*/CubeClass&,			 // The cube being populated
-				  /*IN/OUT*/ColorArr);			 // A tracker to store the amount of each color
-void InitializeColorArray(/*OUT*/ColorArr);		 // The color array being initialized
-void Move(/*IN*/const DirectionEnum&,			 // The desired direction to move in
-		  /*IN/OUT*/LocationRec&);				 // The current location
-void PrintContig(/*IN*/ ListClass&,				 // A list of the locations of the cells to be printed
-				 /*IN*/ const ColorEnum&,		 // The cells colors
-				 /*IN/OUT*/ofstream&);			 // The output file
-void ColorStats(/*IN*/const ColorArr,			 // The color array whose stats are being printed
-				/*IN/OUT*/ofstream&);			 // The output file
-float CoveragePercentage(/*IN*/const int&);		 // The amount of the color in the cube
-void FindPopulousColors(/*IN*/const ColorArr,	 // The color array whose being analyzed
-						/*OUT*/int&,			 // Holds the most populous color's index	
-						/*OUT*/int&);			 // Holds the second most populous color's index
-string ColorEnumIndexToString(/*IN*/const int&); // The integer index of a ColorEnum
+		// The color of a cell only depends on the seed and where the cell is
+		for (size_t i = 0; i < amount; i++)
+		{
+			blockTypes[i] = RandomCellType(seed, first + i, (int)histogram.size());
+			histogram[blockTypes[i]]++;
+		}
+
+		colCube.SetCellTypes(first, amount, blockTypes.data());
+	}
+}// end PopulateBlocks
 
 
+// --------------------------------------------------------------------------------------
 
 
-int main()
+//O(N^3)
+//Purpose: To populate a cube file with random colors a plane at a time and to collect data on
+//		   the amount of each color. Every cell gets the same color as PopulateCube gives it
+//Pre: The name of the file, the options holding the dimensions and palette, and an array to store the colors
+//	   information set to its default values
+//Post: The file holds a cube of random colors, and the color amounts will be known
+//Exception: CubeFileException is thrown if the file can not be written
+void PopulateCubeFile(/*IN*/const string& fileName,			// The cube file being populated
+					  /*IN*/const RunOptionsRec& options,	// The options holding the dimensions
+					  /*IN/OUT*/ColorArr& colArr)			// A tracker to store the amount of each color
 {
-	ListClass largContigList = ListClass();		// Holds all positions of the largest 
-												// contiguous block of colors
-	ListClass secLargContigList = ListClass();	// Holds all positions of the second largest 
-												// contiguous block of colors
-	ListClass currList = ListClass();		// The current contiguous block being checked
-	CubeClass colorCube = CubeClass();		// Simulates and holds data on ColorCube
-	ColorArr colorArr;					// Keeps track of the amount of colors, and the amount checked
-	ofstream dout;						// The output file everything will be outputted to
-	srand(SEED);						// The random number generator with its specified seed
-	ItemRec currItem;					// The current item / position being viewed
-	ColorEnum currCol;					// The current color being viewed
-	bool done = false;					// A bool that controls when the cube is done being searched
+	vector<int> planeTypes((size_t)options.cols * options.deps);	// The colors of the current plane
+	int colorAmt = options.palette.GetColorAmt();	// The amount of colors in the palette
+	int currColor;		// The current color being stored into the plane
+	size_t planeStart;	// The linear index of the first cell of the plane
 
+	CubeFileWriterClass writer(fileName, options.rows, options.cols, options.deps,
+							   options.palette.GetNames());	// Writes the cube file
 
-	// Set all elements in the color array to zero
-	InitializeColorArray(colorArr);
+	// Cycle through each cell of a plane and populate it with a random color
+	for (int i = 0; i < options.rows; i++)
+	{
+		planeStart = (size_t)i * planeTypes.size();
 
-	// Populate the cube with random colors, and keep track of the color counts
-	PopulateCube(colorCube, colorArr);
+		for (size_t cell = 0; cell < planeTypes.size(); cell++)
+		{
+			currColor = RandomCellType(options.seed, planeStart + cell, colorAmt);	// Get a random color
 
+			planeTypes[cell] = currColor;
 
-	// ---------------- Find Largest and Second Largest Contiguous Blocks -----------------
+			// Increment the color count
+			colArr[currColor][ZERO]++;
+		}
 
-	
-	// Set the initial position to zero
-	currItem.key.x = 0;
-	currItem.key.y = 0;
-	currItem.key.z = 0;
-	
+		writer.WritePlane(planeTypes.data());
+	}
 
-	// Repeats until done is marked as true aka the whole cube is checked
-	while (!done)
-	{
-		// Check if the last cell is being looked at
-		if (currItem.key.x == MAX_ROW - OFFSET 
-			&& currItem.key.y == MAX_COL - OFFSET 
-			&& currItem.key.z == MAX_DEP - OFFSET)
-			done = true;	// The search for largest contig is over
+	writer.Close();
+}// end PopulateCubeFile
 
-		else
-		{
-			// Get the color of the cell
-			currCol = colorCube.GetType(currItem.key);
 
-			// Check if the status of the cell is not checked
-			if (!colorCube.GetStatus(currItem.key))
-			{
-				// The cell hasn't been checked yet!
-				 
-				// Check if the color has no chance at being one of the 
-				// top two largest contiguous colors
-				if (colorArr[(int)currCol][ZERO] - colorArr[(int)currCol][OFFSET] <= 
-					secLargContigList.GetLength())
-				{
-					// This cell has no chance, set it to checked and move on
-					colorCube.SetStatus(currItem.key, CHECKED);
-				}
-				else
-				{
-					// Reset the current list
-					currList.Clear();
+// --------------------------------------------------------------------------------------
 
-					// Insert the first spot in the list
-					currList.Insert(currItem);
 
-					// Set the status of the cell to checked
-					colorCube.SetStatus(currItem.key, CHECKED);
-					
-					// Increment the amount of colors checked in the color array
-					colorArr[(int)currCol][OFFSET]++;
+//O(N^3)
+//Purpose: To collect data on the amount of each color of a loaded cube
+//Pre: The loaded cube, and an array to store the colors information set to its default values
+//Post: The color amounts will be known
+//Exception: CubeFileException is thrown if a cell has a color outside the palette
+template <class Cube>
+void CountColors(/*IN*/const Cube& colCube,		// The cube being counted
+				 /*IN/OUT*/ColorArr& colArr)	// A tracker to store the amount of each color
+{
+	vector<int> rowTypes(colCube.GetDeps());	// The colors of the current row
 
-					do
-					{
-						// Chech each adjacent cell to see if it is the same color
-						// and that it has not yet been checked
-						for (int i = 0; i <= MAX_NUM_DIR; i++)
-						{
-							// Update the location
-							Move((DirectionEnum)i, currItem.key);
+	// Cycle through each row of the cube
+	for (int i = 0; i < colCube.GetRows(); i++)
+	{
+		for (int j = 0; j < colCube.GetCols(); j++)
+		{
+			// A row a sparse cube knows is empty has no color to count
+			if (!colCube.RowHasTypes(i, j))
+				continue;
 
-							try
-							{
-								// Check if the cell is the same color and hasn't yet been checked
-								if (colorCube.GetType(currItem.key) == currCol && 
-									colorCube.GetStatus(currItem.key) != CHECKED)
-								{
-									// Insert the location if it is contiguous with the starting block
-									currList.Insert(currItem);
-
-									// Set the cell to checked
-									colorCube.SetStatus(currItem.key, CHECKED);
-
-									// Increment the amount of colors checked in the color array
-									colorArr[(int)currCol][OFFSET]++;
-								}
-							}
-							catch (OutOfBoundsException)
-							{
-								// Do nothing just move on
-							}
+			colCube.GetRowTypes(i, j, rowTypes.data());
 
-							// Move the location back to the starting location
-							if (i % 2 == ZERO)	// If the index is even offset by positive one
-								Move((DirectionEnum)(i + OFFSET), currItem.key);
+			for (int k = 0; k < colCube.GetDeps(); k++)
+			{
+				// An empty cell has no color to count
+				if (rowTypes[k] == EMPTY_CELL)
+					continue;
 
-							else				// Else offset by negative one
-								Move((DirectionEnum)(i - OFFSET), currItem.key);
+				if (rowTypes[k] >= colArr.GetColorAmt())
+					throw CubeFileException();
 
-						}// end for
+				colArr[rowTypes[k]][ZERO]++;
+			}
+		}
+	}
+}// end CountColors
 
-						// Go to the oldest cell addition and check repeat the contiguous check on it
-						currList.NextPosition();
 
-						// Update the location to the new position to be checked
-						currItem = currList.Retrieve();
+// --------------------------------------------------------------------------------------
 
-						// Repeat until all of currlist has been checked
-					} while (currList.EndOfList() == false);
-					
-					// Check to see if the current list is will become either the 
-					// largest contiguous block of colors or the second largest
-					if (currList.GetLength() > largContigList.GetLength())	// Current is the largest
-					{
-						// Largest becomes the second largest
-						secLargContigList = largContigList;
 
-						// Current list becomes the largest
-						largContigList = currList;
-					}
-					// Current is the second largest
-					else if (currList.GetLength() > secLargContigList.GetLength())	
-					{
-						// Current list becomes the second largest
-						secLargContigList = currList;
-					}
+//O(C)
+//Purpose: To set all indexes in a ColorArr to 0
+//Pre: The ColorArr being initialized and the amount of colors in the palette
+//Post: ColorArr counts every color of the palette and all indexes are 0
+void InitializeColorArray(/*OUT*/ColorArr& colArr,		// The color array being initialized
+						  /*IN*/const int& colorAmt)	// The amount of colors in the palette
+{
+	colArr.Reset(colorAmt);
+}// end InitializeColorArray
+
 
-				}// end else
+// --------------------------------------------------------------------------------------
+
+
+// O(1)
+// Purpose: Increment a LocationRec in a single direction
+// Pre: The desired location and the LocationRec being changed
+// Post: The LocationRec will be updated to the new location
+void Move(/*IN*/const DirectionEnum& dir,	// The desired direction to move in
+		  /*IN/OUT*/LocationRec& currPos)	// The current location
+{
+	// Increment currPos according to the specified direction
+	switch (dir)
+	{
+	case UP:
+			currPos.y++;
+		break;
+	case DOWN:
+			currPos.y--;
+		break;
+	case NORTH:
+			currPos.z++;
+		break;
+	case SOUTH:
+			currPos.z--;
+		break;
+	case EAST:
+			currPos.x++;
+		break;
+	case WEST:
+			currPos.x--;
+		break;
+	default:
+		break;
+	};
 
-				// Go back to the original cell
-				currList.FirstPosition();
+}// end Move
 
-				// Reset the location back to the original location
-				currItem = currList.Retrieve();
 
-			}// end if
+// --------------------------------------------------------------------------------------
 
-			
-			// Increment to the next cell column wise
-			currItem.key.y++;
 
-			// Check if the position should be moved to the next depth
-			if (currItem.key.y >= MAX_COL)
-			{
-				// Increment depth
-				currItem.key.z++;
-				// Reset Column
-				currItem.key.y = 0;
-			}
-			// Check if the position should be moved to the next row
-			if(currItem.key.z >= MAX_DEP)
-			{
-				// Increment row
-				currItem.key.x++;
-				// Reset depth
-				currItem.key.z = 0;
-			}
+//O(1)
+//Purpose: To name the output file of a report format
+//Pre: The format of the report
+//Post: OUTPUT_FILE_NAME is returned for the text report, otherwise the file of the format
+string ReportFileName(/*IN*/const ReportFormatEnum& format)	// The format of the report
+{
+	switch (format)
+	{
+	case CSV_REPORT:	return CSV_FILE_NAME;
+	case JSON_REPORT:	return JSON_FILE_NAME;
+	case BINARY_REPORT:	return BINARY_FILE_NAME;
+	default:			return OUTPUT_FILE_NAME;
+	};
+}// end ReportFileName
 
-		}// end else
 
-	}// end while
+// --------------------------------------------------------------------------------------
 
 
-	// ---------------- The Search Ends -----------------
+//O(N^3)
+//Purpose: To write the report of a cube in the format of the writer
+//Pre: The report of the cube, the writer's file is open
+//Post: The report is in the writer, the lists of the blocks are indexed and at their end
+void PrintReport(/*IN/OUT*/CubeReportRec& report,		// Everything the report is written from
+				 /*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the report
+{
+	switch (writer.GetFormat())
+	{
+	case CSV_REPORT:	PrintCsvReport(report, writer);		break;
+	case JSON_REPORT:	PrintJsonReport(report, writer);	break;
+	case BINARY_REPORT:	PrintBinaryReport(report, writer);	break;
+	default:			PrintTextReport(report, writer);	break;
+	};
+}// end PrintReport
 
 
-	// Open the output file
-	dout.open(OUTPUT_FILE_NAME);
+// --------------------------------------------------------------------------------------
 
 
+//O(N^3)
+//Purpose: To write the text report, the largest blocks printed over the cube, the color
+//		   statistics, and the blocks of -top and -recolor when asked for
+//Pre: The report of the cube, the writer's file is open
+//Post: The writer holds the text the client has always written to OUTPUT_FILE_NAME
+void PrintTextReport(/*IN/OUT*/CubeReportRec& report,		// Everything the report is written from
+					 /*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the report
+{
 	// Reset the contiguous lists to the beginning
-	largContigList.FirstPosition();
-	secLargContigList.FirstPosition();
+	report.largest.cells.FirstPosition();
+	report.secLargest.cells.FirstPosition();
 
 
-	// The try is here incase the cube is too small (1x1x1)
+	// The try is here incase no cell of a loaded cube has a color
 	try
 	{
-		// Get the largest contiguous color
-		currCol = colorCube.GetType(largContigList.Retrieve().key);
+		// An empty list throws
+		report.largest.cells.Retrieve();
 
 		// Title the largest contiguous block
-		dout << "Largest Contiguous Block:" << endl;
+		writer.PutText("Largest Contiguous Block:\n");
 
 		// Print the largest contiguous block
-		PrintContig(largContigList, currCol, dout);
+		PrintContig(report.largest.cells, report.largest.type, report.rows, report.cols,
+					report.deps, writer);
 
 		// Output the amount of cells contained within this block
-		dout << "\n[There are " << largContigList.GetLength() << " "
-			 << ColorEnumIndexToString((int)currCol)
-			 << " cells within this block]\n";
+		writer.PutText("\n[There are ");
+		writer.PutInt(report.largest.size);
+		writer.PutChar(' ');
+		writer.PutName(report.largest.type);
+		writer.PutText(" cells within this block]\n");
 
 
-		// Get the second largest contiguous color
-		currCol = colorCube.GetType(secLargContigList.Retrieve().key);
+		// A cube of a single block has no second largest block
+		if (report.secLargest.size == ZERO)
+			writer.PutText("\n[There is no second largest contiguous block]\n");
 
 		// Check to see if the second largest contiguous list is the same size as the largest
-		if (secLargContigList.GetLength() == largContigList.GetLength())
+		else if (report.secLargest.size == report.largest.size)
 		{
-
 			// Title the second largest contiguous block
-			dout << "\nSecond Largest Contiguous Block:" << endl;
+			writer.PutText("\nSecond Largest Contiguous Block:\n");
 
 			// Print the second largest contiguous block
-			PrintContig(secLargContigList, currCol, dout);
+			PrintContig(report.secLargest.cells, report.secLargest.type, report.rows,
+						report.cols, report.deps, writer);
 
 			// Output the amount of cells contained within this block
-			dout << "\n[There are " << secLargContigList.GetLength() << " " 
-				<< ColorEnumIndexToString((int)currCol)
-				<< " cells within this block]\n";
+			writer.PutText("\n[There are ");
+			writer.PutInt(report.secLargest.size);
+			writer.PutChar(' ');
+			writer.PutName(report.secLargest.type);
+			writer.PutText(" cells within this block]\n");
 		}// end if
 		// Else just print statistics for second largest contiguous block
 		else
 		{
 			// Output the amount of cells contained within the second largest block
-			dout << "\n[There are " << secLargContigList.GetLength() << " " 
-				<< ColorEnumIndexToString((int)currCol)
-				<< " cells within the second largest contiguous block]\n";
+			writer.PutText("\n[There are ");
+			writer.PutInt(report.secLargest.size);
+			writer.PutChar(' ');
+			writer.PutName(report.secLargest.type);
+			writer.PutText(" cells within the second largest contiguous block]\n");
 		}
 
 	}// end try
 	catch (EmptyListException)
 	{
 		// Output a message stating the cause of the lack of output
-		dout << "Cube too small to print!\n";
+		writer.PutText("No cell of the cube has a color to print!\n");
 	}
 
 
-	// Output the color statistics to the output file 
-	ColorStats(colorArr, dout);
+	// Output the color statistics to the output file
+	ColorStats(report.colorArr, report.cellAmt, writer);
 
-	// Close the output file
-	dout.close();
 
-}// end main
+	// Output the largest blocks when asked for
+	if (report.topAmt > ZERO)
+		PrintTopBlocks(report.topBlocks, "", writer);
 
+	// Output their shapes and the sizes of every block
+	if (report.geometry)
+		PrintGeometry(report.topBlocks, report.shapes, writer);
 
+	// Output the largest blocks after recoloring
+	if (report.recolorAmt > ZERO)
+		PrintTopBlocks(report.recolorBlocks, "After Recoloring " + to_string(report.recolorAmt) + " Cells, ", writer);
 
+}// end PrintTextReport
 
 
-// --------------------------------- FUNCTIONS ------------------------------------------
+// --------------------------------------------------------------------------------------
 
 
-//O(N^3)
-//Purpose: To populate the color cube with random colors and to collect data on the amount of each color
-//Pre: The cube to be populated, and an array to store the colors information
-//	   The color array should be set to its default values ie... InitializeColorArray
-//Post: The cube will be populated with random colors, and the color amounts will be known
-void PopulateCube(/*OUT*/CubeClass& colCube,	// The cube being populated
-				  /*IN/OUT*/ColorArr colArr)		// A tracker to store the amount of each color
+//O(N)
+//Purpose: To write the report as CSV, a row for every value with the columns
+//		   Record,Rank,Color,Cells,Percent,X,Y,Z
+//Pre: The report of the cube, the writer's file is open
+//Post: The writer holds a Cube row with the cells and dimensions, a Block row and a Cell
+//		row for each cell of the two largest blocks, a Color row for every color, two
+//		Principle rows, and a Top or Recolor row with the first cell of each block of -top
+//		and -recolor when asked for. With -geometry each -top block also has Low, High and
+//		Center rows at X,Y,Z, TouchesLow and TouchesHigh rows with a 1 at X, Y or Z when
+//		it touches the low or high face of the cube along it and a 0 when not, and an
+//		Exposed row with its exposed faces as Cells, then a Sizes row for each range of
+//		sizes with its least size as Rank and its amount of blocks as Cells
+void PrintCsvReport(/*IN/OUT*/CubeReportRec& report,		// Everything the report is written from
+					/*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the report
 {
-	ColorEnum currColor;		// The current color being stored into the cube
-	LocationRec currLoc;	// The current cell being populated
+	BlockRec* blocks[] = { &report.largest, &report.secLargest };	// The two largest blocks
+	vector<BlockRec>* lists[] = { &report.topBlocks, &report.recolorBlocks };	// The blocks of -top and -recolor
+	const char* listNames[] = { "Top,", "Recolor," };	// The record of each list of blocks
+	bool asked[] = { report.topAmt > ZERO, report.recolorAmt > ZERO };	// True when a list was asked for
+	int popIndex;			// Holds the most populous color's index
+	int secPopIndex;		// Holds the second most populous color's index
+	int colorAmt = report.colorArr.GetColorAmt();	// The amount of colors in the palette
+	LocationRec currLoc;	// The cell being written
+
+	writer.PutText("Record,Rank,Color,Cells,Percent,X,Y,Z\n");
+
+	writer.PutText("Cube,,,");
+	writer.PutInt((long long)report.cellAmt);
+	writer.PutText(",,");
+	writer.PutInt(report.rows);
+	writer.PutChar(',');
+	writer.PutInt(report.cols);
+	writer.PutChar(',');
+	writer.PutInt(report.deps);
+	writer.PutChar('\n');
+
+	// The two largest blocks and every cell of them
+	for (int b = 0; b < 2; b++)
+	{
+		if (blocks[b]->cells.IsEmpty())
+			continue;
+
+		writer.PutText("Block,");
+		writer.PutInt(b + OFFSET);
+		writer.PutChar(',');
+		writer.PutName(blocks[b]->type);
+		writer.PutChar(',');
+		writer.PutInt(blocks[b]->size);
+		writer.PutText(",,,,\n");
+
+		for (blocks[b]->cells.FirstPosition(); !blocks[b]->cells.EndOfList(); blocks[b]->cells.NextPosition())
+		{
+			currLoc = blocks[b]->cells.Retrieve().key;
+
+			writer.PutText("Cell,");
+			writer.PutInt(b + OFFSET);
+			writer.PutChar(',');
+			writer.PutName(blocks[b]->type);
+			writer.PutText(",,,");
+			writer.PutInt(currLoc.x);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.y);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.z);
+			writer.PutChar('\n');
+		}
+	}
+
+	// The amount of each color, then the two most populous
+	FindPopulousColors(report.colorArr, popIndex, secPopIndex);
+
+	for (int i = 0; i < colorAmt + 2; i++)
+	{
+		int color = i < colorAmt ? i : (i == colorAmt ? popIndex : secPopIndex);	// The color of the row
+
+		writer.PutText(i < colorAmt ? "Color," : "Principle,");
+		if (i >= colorAmt)
+			writer.PutInt(i - colorAmt + OFFSET);
+		writer.PutChar(',');
+		writer.PutName(color);
+		writer.PutChar(',');
+		writer.PutInt(report.colorArr[color][ZERO]);
+		writer.PutChar(',');
+		writer.PutFixed(CoveragePercentage(report.colorArr[color][ZERO], report.cellAmt));
+		writer.PutText(",,,\n");
+	}
+
+	// The first cell of each block of -top and -recolor
+	for (int l = 0; l < 2; l++)
+	{
+		if (!asked[l])
+			continue;
 
-	// Cycle through each cell and populate it with a random color
-	for (int i = 0; i < MAX_ROW; i++)
+		for (size_t i = 0; i < lists[l]->size(); i++)
+		{
+			currLoc = (*lists[l])[i].cells.Retrieve().key;
+
+			writer.PutText(listNames[l]);
+			writer.PutInt((long long)i + OFFSET);
+			writer.PutChar(',');
+			writer.PutName((*lists[l])[i].type);
+			writer.PutChar(',');
+			writer.PutInt((*lists[l])[i].size);
+			writer.PutText(",,");
+			writer.PutInt(currLoc.x);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.y);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.z);
+			writer.PutChar('\n');
+		}
+	}
+
+	// The shape of each block of -top, then the amount of blocks of each range of sizes
+	if (!report.geometry)
+		return;
+
+	for (size_t i = 0; i < report.shapes.topShapes.size(); i++)
 	{
-		currLoc.x = i;	// Update the row
-		for (int j = 0; j < MAX_COL; j++)
+		const GeometryRec& shape = report.shapes.topShapes[i];	// The shape of the block
+		const LocationRec* corners[] = { &shape.low, &shape.high };	// The corners of its bounding box
+		const char* cornerNames[] = { "Low,", "High,", "Center,", "TouchesLow,", "TouchesHigh," };
+							// The record of each corner, the centroid and the faces of the cube touched
+
+		for (int c = 0; c < 5; c++)
 		{
-			currLoc.y = j;	// Update the column
-			for (int k = 0; k < MAX_DEP; k++)
+			writer.PutText(cornerNames[c]);
+			writer.PutInt((long long)i + OFFSET);
+			writer.PutChar(',');
+			writer.PutName(report.topBlocks[i].type);
+			writer.PutText(",,,");
+
+			if (c < 2)
+			{
+				writer.PutInt(corners[c]->x);
+				writer.PutChar(',');
+				writer.PutInt(corners[c]->y);
+				writer.PutChar(',');
+				writer.PutInt(corners[c]->z);
+			}
+			else if (c == 2)
+			{
+				writer.PutFixed(shape.centerX);
+				writer.PutChar(',');
+				writer.PutFixed(shape.centerY);
+				writer.PutChar(',');
+				writer.PutFixed(shape.centerZ);
+			}
+			else
 			{
-				currLoc.z = k;	// Update the depth
+				// The CubeFaceEnum bits are low then high for each of x, y and z
+				for (int a = 0; a < 3; a++)
+				{
+					if (a > ZERO)
+						writer.PutChar(',');
+					writer.PutInt((shape.cubeFaces >> (2 * a + c - 3)) & OFFSET);
+				}
+			}
+			writer.PutChar('\n');
+		}
 
-				currColor = (ColorEnum)(rand() % MAX_COLOR_AMT); // Get a random color
+		writer.PutText("Exposed,");
+		writer.PutInt((long long)i + OFFSET);
+		writer.PutChar(',');
+		writer.PutName(report.topBlocks[i].type);
+		writer.PutChar(',');
+		writer.PutInt(shape.exposedFaces);
+		writer.PutText(",,,,\n");
+	}
 
-				colCube.SetType(currLoc,currColor);	// Populate the cell with the color
+	for (size_t b = 0; b < report.shapes.sizeHistogram.size(); b++)
+	{
+		writer.PutText("Sizes,");
+		writer.PutInt(1LL << b);
+		writer.PutText(",,");
+		writer.PutInt(report.shapes.sizeHistogram[b]);
+		writer.PutText(",,,,\n");
+	}
 
-				// Increment the color count
-				colArr[(int)currColor][ZERO]++;
-			}// k
-		}// j
-	}// i
-}// end PopulateCube
+}// end PrintCsvReport
 
 
 // --------------------------------------------------------------------------------------
 
 
-//O(N^2)
-//Purpose: To set all indexes in a ColorArr to 0
-//Pre: The ColorArr being initialized
-//Post: All indexes in ColorArr are 0
-void InitializeColorArray(/*OUT*/ColorArr colArr)	// The color array being initialized
-{
-	// Cycle through the array
-	for (int i = 0; i < MAX_COLOR_AMT; i++)
-		for (int j = 0; j < COLOR_TRACKER; j++)
-			colArr[i][j] = ZERO;	// Set the index to zero
-}// end InitializeColorArray
+//O(N)
+//Purpose: To write the report as a single JSON object
+//Pre: The report of the cube, the writer's file is open
+//Post: The writer holds the dimensions and cells of the cube, the color, size and cells of
+//		the two largest blocks, the cells and percent of every color and of the two most
+//		populous, and the color, size and first cell of each block of -top and -recolor
+//		when asked for. With -geometry each -top block also holds its low and high corners,
+//		center, exposed faces and the names of the faces of the cube it touches (see
+//		CUBE_FACE_NAMES), and "sizes" holds the amount of blocks of 2^b to 2^(b + 1) - 1
+//		cells at b
+void PrintJsonReport(/*IN/OUT*/CubeReportRec& report,		// Everything the report is written from
+					 /*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the report
+{
+	BlockRec* blocks[] = { &report.largest, &report.secLargest };	// The two largest blocks
+	vector<BlockRec>* lists[] = { &report.topBlocks, &report.recolorBlocks };	// The blocks of -top and -recolor
+	const char* listNames[] = { ",\n\"top\":[", ",\n\"recolor\":{\"amount\":" };	// Opens each list of blocks
+	bool asked[] = { report.topAmt > ZERO, report.recolorAmt > ZERO };	// True when a list was asked for
+	int popIndex;			// Holds the most populous color's index
+	int secPopIndex;		// Holds the second most populous color's index
+	int colorAmt = report.colorArr.GetColorAmt();	// The amount of colors in the palette
+	LocationRec currLoc;	// The cell being written
+	bool first;				// True until the first cell of a block, or face it touches, is written
+
+	writer.PutText("{\"rows\":");
+	writer.PutInt(report.rows);
+	writer.PutText(",\"cols\":");
+	writer.PutInt(report.cols);
+	writer.PutText(",\"deps\":");
+	writer.PutInt(report.deps);
+	writer.PutText(",\"cells\":");
+	writer.PutInt((long long)report.cellAmt);
+
+	// The two largest blocks and every cell of them
+	writer.PutText(",\n\"blocks\":[");
+	for (int b = 0; b < 2; b++)
+	{
+		if (blocks[b]->cells.IsEmpty())
+			continue;
+
+		writer.PutText(b > ZERO ? ",\n{\"rank\":" : "\n{\"rank\":");
+		writer.PutInt(b + OFFSET);
+		writer.PutText(",\"color\":\"");
+		writer.PutName(blocks[b]->type);
+		writer.PutText("\",\"size\":");
+		writer.PutInt(blocks[b]->size);
+		writer.PutText(",\"cells\":[");
+
+		first = true;
+		for (blocks[b]->cells.FirstPosition(); !blocks[b]->cells.EndOfList(); blocks[b]->cells.NextPosition())
+		{
+			currLoc = blocks[b]->cells.Retrieve().key;
+
+			writer.PutText(first ? "[" : ",[");
+			writer.PutInt(currLoc.x);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.y);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.z);
+			writer.PutChar(']');
+			first = false;
+		}
+		writer.PutText("]}");
+	}
+	writer.PutChar(']');
+
+	// The amount of each color, then the two most populous
+	FindPopulousColors(report.colorArr, popIndex, secPopIndex);
+
+	writer.PutText(",\n\"colors\":[");
+	for (int i = 0; i < colorAmt + 2; i++)
+	{
+		int color = i < colorAmt ? i : (i == colorAmt ? popIndex : secPopIndex);	// The color of the entry
+
+		if (i == colorAmt)
+			writer.PutText("],\n\"principle\":");
+		else if (i > colorAmt)
+			writer.PutText(",\n\"second\":");
+		else if (i > ZERO)
+			writer.PutChar(',');
+
+		writer.PutText("{\"color\":\"");
+		writer.PutName(color);
+		writer.PutText("\",\"cells\":");
+		writer.PutInt(report.colorArr[color][ZERO]);
+		writer.PutText(",\"percent\":");
+		writer.PutFixed(CoveragePercentage(report.colorArr[color][ZERO], report.cellAmt));
+		writer.PutChar('}');
+	}
+
+	// The first cell of each block of -top and -recolor
+	for (int l = 0; l < 2; l++)
+	{
+		if (!asked[l])
+			continue;
+
+		writer.PutText(listNames[l]);
+		if (l > ZERO)
+		{
+			writer.PutInt(report.recolorAmt);
+			writer.PutText(",\"blocks\":[");
+		}
+
+		for (size_t i = 0; i < lists[l]->size(); i++)
+		{
+			currLoc = (*lists[l])[i].cells.Retrieve().key;
+
+			writer.PutText(i > ZERO ? ",{\"rank\":" : "{\"rank\":");
+			writer.PutInt((long long)i + OFFSET);
+			writer.PutText(",\"color\":\"");
+			writer.PutName((*lists[l])[i].type);
+			writer.PutText("\",\"size\":");
+			writer.PutInt((*lists[l])[i].size);
+			writer.PutText(",\"first\":[");
+			writer.PutInt(currLoc.x);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.y);
+			writer.PutChar(',');
+			writer.PutInt(currLoc.z);
+			writer.PutChar(']');
+
+			// The shape of a block of -top
+			if (l == ZERO && report.geometry)
+			{
+				const GeometryRec& shape = report.shapes.topShapes[i];	// The shape of the block
+
+				writer.PutText(",\"low\":[");
+				writer.PutInt(shape.low.x);
+				writer.PutChar(',');
+				writer.PutInt(shape.low.y);
+				writer.PutChar(',');
+				writer.PutInt(shape.low.z);
+				writer.PutText("],\"high\":[");
+				writer.PutInt(shape.high.x);
+				writer.PutChar(',');
+				writer.PutInt(shape.high.y);
+				writer.PutChar(',');
+				writer.PutInt(shape.high.z);
+				writer.PutText("],\"center\":[");
+				writer.PutFixed(shape.centerX);
+				writer.PutChar(',');
+				writer.PutFixed(shape.centerY);
+				writer.PutChar(',');
+				writer.PutFixed(shape.centerZ);
+				writer.PutText("],\"exposed\":");
+				writer.PutInt(shape.exposedFaces);
+				writer.PutText(",\"touches\":[");
+				first = true;
+				for (int f = 0; f < CUBE_FACE_AMT; f++)
+				{
+					if (shape.cubeFaces & (OFFSET << f))
+					{
+						if (!first)
+							writer.PutChar(',');
+						writer.PutChar('"');
+						writer.PutText(CUBE_FACE_NAMES[f]);
+						writer.PutChar('"');
+						first = false;
+					}
+				}
+				writer.PutChar(']');
+			}
+			writer.PutChar('}');
+		}
+
+		writer.PutText(l > ZERO ? "]}" : "]");
+	}
+
+	// The amount of blocks of each range of sizes
+	if (report.geometry)
+	{
+		writer.PutText(",\n\"sizes\":[");
+		for (size_t b = 0; b < report.shapes.sizeHistogram.size(); b++)
+		{
+			if (b > ZERO)
+				writer.PutChar(',');
+			writer.PutInt(report.shapes.sizeHistogram[b]);
+		}
+		writer.PutChar(']');
+	}
+
+	writer.PutText("}\n");
+
+}// end PrintJsonReport
 
 
 // --------------------------------------------------------------------------------------
 
 
-// O(1)
-// Purpose: Increment a LocationRec in a single direction
-// Pre: The desired location and the LocationRec being changed
-// Post: The LocationRec will be updated to the new location
-void Move(/*IN*/const DirectionEnum& dir,	// The desired direction to move in
-		  /*IN/OUT*/LocationRec& currPos)	// The current location
+//O(N)
+//Purpose: To write the report as 32 bit integers in the byte order of the machine, the amounts
+//		   of cells and the sizes of blocks as 64 bit integers:
+//			REPORT_MAGIC, REPORT_VERSION, rows, cols, deps, the amount of colors
+//			per color: its name in PALETTE_NAME_SIZE bytes, then its amount of cells
+//			the most and second most populous colors
+//			the amount of largest blocks (0 to 2), per block: color, size, then x, y, z per cell
+//			the amount of -top blocks, per block: color, size, then x, y, z of its first cell
+//			the amount of cells recolored, the amount of blocks after, each as a -top block
+//Pre: The report of the cube, the writer's file is open in binary mode
+//Post: The writer holds the report, a list that was not asked for has no blocks
+void PrintBinaryReport(/*IN/OUT*/CubeReportRec& report,		// Everything the report is written from
+					   /*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the report
 {
-	// Increment currPos according to the specified direction
-	switch (dir)
+	BlockRec* blocks[] = { &report.largest, &report.secLargest };	// The two largest blocks
+	vector<BlockRec>* lists[] = { &report.topBlocks, &report.recolorBlocks };	// The blocks of -top and -recolor
+	bool asked[] = { report.topAmt > ZERO, report.recolorAmt > ZERO };	// True when a list was asked for
+	int blockAmt = ZERO;	// The amount of largest blocks found
+	int popIndex;			// Holds the most populous color's index
+	int secPopIndex;		// Holds the second most populous color's index
+	int colorAmt = report.colorArr.GetColorAmt();	// The amount of colors in the palette
+	LocationRec currLoc;	// The cell being written
+
+	writer.PutText(REPORT_MAGIC);
+	writer.PutBinary(REPORT_VERSION);
+	writer.PutBinary(report.rows);
+	writer.PutBinary(report.cols);
+	writer.PutBinary(report.deps);
+
+	// The name and amount of each color, then the two most populous
+	writer.PutBinary(colorAmt);
+	for (int i = 0; i < colorAmt; i++)
 	{
-	case UP:
-			currPos.y++;
-		break;
-	case DOWN:
-			currPos.y--;
-		break;
-	case NORTH:
-			currPos.z++;
-		break;
-	case SOUTH:
-			currPos.z--;
-		break;
-	case EAST:
-			currPos.x++;
-		break;
-	case WEST:
-			currPos.x--;
-		break;
-	default:
-		break;
-	};
+		writer.PutBinaryName(i);
+		writer.PutBinaryLong(report.colorArr[i][ZERO]);
+	}
 
-}// end Move
+	FindPopulousColors(report.colorArr, popIndex, secPopIndex);
+	writer.PutBinary(popIndex);
+	writer.PutBinary(secPopIndex);
+
+	// The two largest blocks and every cell of them
+	for (int b = 0; b < 2; b++)
+		if (!blocks[b]->cells.IsEmpty())
+			blockAmt++;
+
+	writer.PutBinary(blockAmt);
+	for (int b = 0; b < blockAmt; b++)
+	{
+		writer.PutBinary(blocks[b]->type);
+		writer.PutBinaryLong(blocks[b]->size);
+
+		for (blocks[b]->cells.FirstPosition(); !blocks[b]->cells.EndOfList(); blocks[b]->cells.NextPosition())
+		{
+			currLoc = blocks[b]->cells.Retrieve().key;
+
+			writer.PutBinary(currLoc.x);
+			writer.PutBinary(currLoc.y);
+			writer.PutBinary(currLoc.z);
+		}
+	}
+
+	// The first cell of each block of -top and -recolor
+	for (int l = 0; l < 2; l++)
+	{
+		if (l > ZERO)
+			writer.PutBinary(report.recolorAmt);
+
+		writer.PutBinary(asked[l] ? (int)lists[l]->size() : ZERO);
+		for (size_t i = 0; asked[l] && i < lists[l]->size(); i++)
+		{
+			currLoc = (*lists[l])[i].cells.Retrieve().key;
+
+			writer.PutBinary((*lists[l])[i].type);
+			writer.PutBinaryLong((*lists[l])[i].size);
+			writer.PutBinary(currLoc.x);
+			writer.PutBinary(currLoc.y);
+			writer.PutBinary(currLoc.z);
+		}
+	}
+
+}// end PrintBinaryReport
 
 
 // --------------------------------------------------------------------------------------
 
 
-// O(N^2)
+// O(N^3)
 // Purpose: To print the cube highlighting a series of cells whose colors are contiguous
-// Pre: The list of contiguous cells, their color, and the output file to output to
+// Pre: The list of contiguous cells, their color, the dimensions of the cube and the writer to output to
 // Post: The cube will be outputted layer by layer with the indicated cells specifying their color,
-//		 all other cells will be marked with "***" as null status
+//		 all other cells will be marked with "***" as null status. The list is indexed so
+//		 each cell is found in constant time, and each cell is copied from the writer's name table
 void PrintContig(/*IN*/ ListClass& colLocList,	 // A list of the locations of the cells to be printed
-				/*IN*/ const ColorEnum& cellCol, // The cells colors
-				/*IN/OUT*/ofstream& dout)		 // The output file
+				/*IN*/ const int& cellCol, // The cells colors
+				/*IN*/ const int& rows,			 // The amount of rows in the cube the cells are within
+				/*IN*/ const int& cols,			 // The amount of columns in the cube the cells are within
+				/*IN*/ const int& deps,			 // The amount of faces in the cube the cells are within
+				/*IN/OUT*/ReportWriterClass& writer) // Formats and writes the output file
 {
 	LocationRec tempLoc;	// The location being analyzed
 
+	// Index the list so the cube is printed in a single pass
+	colLocList.EnableIndex();
+
 	// Cycle through the rows
-	for (int i = 0; i < MAX_ROW; i++)
+	for (int i = 0; i < rows; i++)
 	{
 		tempLoc.x = i;	// Update tempLoc
 
 		// Cycle through the faces 
-		for (int k = MAX_DEP - 1; k >= 0; k--)
+		for (int k = deps - 1; k >= 0; k--)
 		{
-			dout << endl;	// Go to next line
+			writer.PutChar('\n');	// Go to next line
 			tempLoc.z = k;	// Update tempLoc
 
 			// Cycle through the columns
-			for (int j = 0; j < MAX_COL; j++)
+			for (int j = 0; j < cols; j++)
 			{
 				tempLoc.y = j;	// Update tempLoc
 
@@ -472,13 +2649,13 @@ void PrintContig(/*IN*/ ListClass& colLocList,	 // A list of the locations of th
 				if (colLocList.Find(tempLoc))
 				{
 					// Output the color of the cell if it is
-					dout << ColorEnumIndexToString((int)cellCol) << "\t";
+					writer.PutCell((int)cellCol);
 				}
 				else // Otherwise print null status
-					dout << "***" << "\t";
+					writer.PutEmptyCell();
 			}// end j
 		}// end k
-		dout << endl;	// Go to next line
+		writer.PutChar('\n');	// Go to next line
 	}// end i
 
 }// end PrintContig
@@ -489,10 +2666,11 @@ void PrintContig(/*IN*/ ListClass& colLocList,	 // A list of the locations of th
 
 //O(N)
 //Purpose: Output color statistics to an output file
-//Pre: Output file must be open, the color Array being printed
-//Post: The color statistics will be outputted to the output file
-void ColorStats(/*IN*/const ColorArr colArr,		// The color array whose stats are being printed
-				/*IN/OUT*/ofstream& dout)			// The output file
+//Pre: The writer's file must be open, the color Array being printed, the amount of cells in the cube
+//Post: The color statistics will be outputted to the writer
+void ColorStats(/*IN*/const ColorArr& colArr,		// The color array whose stats are being printed
+				/*IN*/const size_t& cellAmt,		// The amount of cells in the cube
+				/*IN/OUT*/ReportWriterClass& writer)	// Formats and writes the output file
 {
 	int popIndex;		// Holds the most populous color's index
 	int secPopIndex;	// Holds the second most populous color's index
@@ -501,22 +2679,30 @@ void ColorStats(/*IN*/const ColorArr colArr,		// The color array whose stats are
 	FindPopulousColors(colArr, popIndex, secPopIndex);
 
 	// Output title
-	dout << endl << "Color Statistics:\n";
+	writer.PutText("\nColor Statistics:\n");
 
 	// Output the amount of each color
-	for (int i = 0; i < MAX_COLOR_AMT; i++)
-		dout << ColorEnumIndexToString(i) << " Cells: " << colArr[i][ZERO] << "\n";
-
-	// Get the percentages to output to the correct decimal place
-	dout << fixed << showpoint << setprecision(2);
+	for (int i = 0; i < colArr.GetColorAmt(); i++)
+	{
+		writer.PutName(i);
+		writer.PutText(" Cells: ");
+		writer.PutInt(colArr[i][ZERO]);
+		writer.PutChar('\n');
+	}
 
-	// Output the principle color and its coverage percentage
-	dout << "The principle color was " << ColorEnumIndexToString(popIndex)
-		<< ", it took up " << CoveragePercentage(colArr[popIndex][ZERO]) << "% of the cube.\n";
+	// Output the principle color and its coverage percentage, to two decimal places
+	writer.PutText("The principle color was ");
+	writer.PutName(popIndex);
+	writer.PutText(", it took up ");
+	writer.PutFixed(CoveragePercentage(colArr[popIndex][ZERO], cellAmt));
+	writer.PutText("% of the cube.\n");
 
 	// Output the second most populous color and its coverage percentage
-	dout << "The second most populous color was " << ColorEnumIndexToString(secPopIndex)
-		<< ", it took up " << CoveragePercentage(colArr[secPopIndex][ZERO]) << "% of the cube.";
+	writer.PutText("The second most populous color was ");
+	writer.PutName(secPopIndex);
+	writer.PutText(", it took up ");
+	writer.PutFixed(CoveragePercentage(colArr[secPopIndex][ZERO], cellAmt));
+	writer.PutText("% of the cube.");
 
 
 }// end ColorStats
@@ -527,79 +2713,87 @@ void ColorStats(/*IN*/const ColorArr colArr,		// The color array whose stats are
 
 //O(1)
 //Purpose: To determine and return the percentage that a color takes up of the cube
-//Pre: The amount of cells with the color in the cube
+//Pre: The amount of cells with the color in the cube, the amount of cells in the cube
 //Post: The percent that the color takes up within the cube
-float CoveragePercentage(/*IN*/const int& colAmt)	// The amount of the color in the cube
+float CoveragePercentage(/*IN*/const long long& colAmt,	// The amount of the color in the cube
+						 /*IN*/const size_t& cellAmt)	// The amount of cells in the cube
 {
-	return	(float)colAmt / (float)(MAX_ROW * MAX_COL * MAX_DEP) * (float)PERCENT_CONVERTER;
+	return	(float)colAmt / (float)cellAmt * (float)PERCENT_CONVERTER;
 }// end CoveragePercentage
 
 // --------------------------------------------------------------------------------------
 
 
-// O(N)
+// O(C)
 // Purpose: Determine the two most populous colors
 // Pre: The array of colors should be filled, places to store the populous color's indexes
 // Post: The populous color indexes will be returned
-void FindPopulousColors(/*IN*/const ColorArr colArr,	// The color array whose being analyzed
+void FindPopulousColors(/*IN*/const ColorArr& colArr,	// The color array whose being analyzed
 	/*OUT*/int& popIndex,			// Holds the most populous color's index	
 	/*OUT*/int& secPopIndex)		// Holds the second most populous color's index
 {
-	// Get an initial value for popIndex
-	popIndex = ZERO;
-
-	// Check the first two colors against each other to determine their popularity order
-	if (colArr[popIndex][ZERO] < colArr[OFFSET][ZERO])
-	{
-		secPopIndex = popIndex;
-		popIndex = OFFSET;		// Get an initial value for secPopIndex
-	}
+	vector<int> top;	// The two most populous colors
 
-	else
-		secPopIndex = OFFSET;		// Get an initial value for secPopIndex
+	FindTopColors(colArr, 2, top);
 
-	// Iterate through all the colors and determine the two most populous colors
-	for (int i = 2; i < MAX_COLOR_AMT; i++)
-	{
-		// Check if the color amount is greater than the second largest
-		if (colArr[i][ZERO] > colArr[secPopIndex][ZERO])
-		{
-			// Check if the color amount is greater than the largest
-			if (colArr[i][ZERO] > colArr[popIndex][ZERO])
-			{
-				// Update the color popularity order
-				secPopIndex = popIndex;
-				popIndex = i;
-			}
-			else
-				// Update the color popularity order
-				secPopIndex = i;
-		}
-	}
+	popIndex = top[ZERO];
+	secPopIndex = top[OFFSET];
 }// end FindPopulousColors
 
 
 // --------------------------------------------------------------------------------------
 
-//O(1)
-//Purpose: To convert the integer index of a ColorEnum to a string
-//Pre: The integer index
-//Post: The corresponding color will be returned
-string ColorEnumIndexToString(/*IN*/const int& index)	// The integer index of a ColorEnum
-{
-	// Determine the color based off the index
-	switch (index)
-	{
-	case 0: return "RED";		break;
-	case 1: return "ORG";		break;
-	case 2: return "YEL";		break;
-	case 3: return "GRN";		break;
-	case 4: return "BLU";		break;
-		// *ADDITIONAL COLOR CASES GO HERE* 
-	default: return "OTH";	// Short for other color
+//O(C log K)
+//Purpose: To find the most populous colors of a palette of any size
+//Pre: The array of colors should be filled, the amount of colors wanted
+//Post: top holds the amount most populous colors, most populous first. Of two colors with
+//		the same amount the earlier color comes first. Only the first amount colors are
+//		ordered, the rest of the palette is left unsorted
+void FindTopColors(/*IN*/const ColorArr& colArr,	// The color array being analyzed
+				   /*IN*/const int& amount,			// The amount of colors wanted
+				   /*OUT*/vector<int>& top)			// The most populous colors
+{
+	size_t topAmt = (size_t)min(amount, colArr.GetColorAmt());	// The amount of colors ordered
 
-	};
-}// end ColorEnumIndexToString
+	top.resize(colArr.GetColorAmt());
+	for (int i = 0; i < colArr.GetColorAmt(); i++)
+		top[i] = i;
+
+	partial_sort(top.begin(), top.begin() + topAmt, top.end(),
+				 [&colArr](const int& first, const int& second)
+				 {
+					 if (colArr[first][ZERO] != colArr[second][ZERO])
+						 return colArr[first][ZERO] > colArr[second][ZERO];
+					 return first < second;
+				 });
+
+	top.resize(topAmt);
+}// end FindTopColors
+
+
+// --------------------------------------------------------------------------------------
+
+
+// The templates of ContigClient.h are built here for both forms of the cube, so the benchmark
+// can call them without their bodies
+template void SearchCube(const RunOptionsRec&, CubeClass&, ColorArr&, ListClass&, ListClass&,
+						 int&, int&, vector<BlockRec>&, BlockShapesRec&);
+template void SearchCube(const RunOptionsRec&, DefaultCubeClass&, ColorArr&, ListClass&, ListClass&,
+						 int&, int&, vector<BlockRec>&, BlockShapesRec&);
+template void FloodSearch(CubeClass&, ColorArr&, ListClass&, ListClass&);
+template void FloodSearch(DefaultCubeClass&, ColorArr&, ListClass&, ListClass&);
+template void HaloFloodSearch(const CubeClass&, ColorArr&, ListClass&, ListClass&);
+template void HaloFloodSearch(const DefaultCubeClass&, ColorArr&, ListClass&, ListClass&);
+template void HaloFloodTopK(const CubeClass&, ColorArr&, const int&, const int&, vector<BlockRec>&);
+template void HaloFloodTopK(const DefaultCubeClass&, ColorArr&, const int&, const int&, vector<BlockRec>&);
+template void LabelBatchCube(const BatchJobRec&, const RunOptionsRec&, CubeClass&, BatchWorkerRec&);
+template void LabelBatchCube(const BatchJobRec&, const RunOptionsRec&, DefaultCubeClass&, BatchWorkerRec&);
+template void PopulateCube(CubeClass&, ColorArr&, const int&, const int&);
+template void PopulateCube(DefaultCubeClass&, ColorArr&, const int&, const int&);
+template void PopulateBlocks(CubeClass&, const size_t&, const size_t&, vector<int>&, const int&);
+template void PopulateBlocks(DefaultCubeClass&, const size_t&, const size_t&, vector<int>&, const int&);
+template void CountColors(const CubeClass&, ColorArr&);
+template void CountColors(const DefaultCubeClass&, ColorArr&);
 
 
 // Use this code under populate cube to print out the cube by cell color
@@ -607,18 +2801,18 @@ string ColorEnumIndexToString(/*IN*/const int& index)	// The integer index of a
 /*
 	LocationRec tempLoc;
 
-	for (int i = 0; i < MAX_ROW; i++)
+	for (int i = 0; i < colorCube.GetRows(); i++)
 	{
 		cout << endl;
 		tempLoc.x = i;
-		for (int k = MAX_DEP - 1; k >= 0; k--)
+		for (int k = colorCube.GetDeps() - 1; k >= 0; k--)
 		{
 			tempLoc.z = k;
 			cout << endl;
-			for (int j = 0; j < MAX_COL; j++)
+			for (int j = 0; j < colorCube.GetCols(); j++)
 			{
 				tempLoc.y = j;
-				cout << ColorEnumIndexToString((int)colorCube.GetType(tempLoc)) << " ";
+				cout << options.palette.GetName((int)colorCube.GetType(tempLoc)) << " ";
 			}
 		}
 	}
@@ -0,0 +1,269 @@
+#pragma once
+/*
+	FileName : ContigClient.h
+	Project Color Cuberator
+
+	PURPOSE:
+		Contains the options, records and prototypes of the functions of ContigClient.cpp, so
+		another program (the benchmark) can populate, search and report on a cube the same
+		way the client does. See ContigClient.cpp for what each function does.
+
+	ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+		1 - A program other than the client compiles ContigClient.cpp with CUBE_BENCHMARK
+			defined, which leaves out the client's main
+		2 - The functions templated on the cube are built for CubeClass and DefaultCubeClass
+			in ContigClient.cpp, only those two forms can be passed to them
+*/
+
+#include<fstream>	// Used to create output files
+#include<iomanip>	// Used for output manipulation
+#include "Cube.h"	// Grants Access to Cube Class
+#include "FixedCube.h"	// Grants Access to the Cube Class of fixed dimensions
+#include "list.h"	// Grants Access to List Class
+#include "Labeler.h"	// Grants Access to Labeler Class
+#include "HaloCube.h"	// Grants Access to Halo Cube Class
+#include "TopBlocks.h"	// Grants Access to Top Blocks Class
+#include "CubeFile.h"	// Grants Access to the Cube File classes
+#include "StreamLabeler.h"	// Grants Access to Stream Labeler Class
+#include "CellRandom.h"	// Grants Access to the counter based random colors
+#include "ComponentTracker.h"	// Grants Access to Component Tracker Class
+#include "ThreadPool.h"	// Grants Access to Thread Pool Class
+#include "Instrument.h"	// Grants Access to the instrumentation counters and timers
+#include "ReportWriter.h"	// Grants Access to Report Writer Class
+#include "Palette.h"	// Grants Access to the Palette and Color Count classes
+#include <iostream>	// For Testing Purposes
+#include <cstdlib>	// Used to read the command line dimensions
+#include <cstring>	// Used to read the command line options
+#include <thread>	// Used to find the amount of cores and to populate in parallel
+#include <algorithm>	// Used to find the smaller of two sizes and the most populous colors
+#include <sstream>	// Used to read the lines of a batch job file
+#include <memory>	// Used to hold the cube kept by each thread of a batch
+using namespace std;	// Standard namespace
+
+
+
+// Constants
+typedef ColorCountClass ColorArr;	// Used to store color amount information, a row of counts per color
+const int DIMENSION_AMT = 3;	// The amount of dimensions given on the command line
+const size_t POPULATE_BLOCK = 4096;	// The cells populated at a time, a multiple of CELL_RANGE_ALIGN
+const int RECOLOR_SEED = 7654321;	// The seed the recolored cells and their colors are drawn with
+const int CUBE_FACE_AMT = 6;	// The faces of the cube a block may touch
+const string CUBE_FACE_NAMES[CUBE_FACE_AMT] = { "-X", "+X", "-Y", "+Y", "-Z", "+Z" };	// The name of each CubeFaceEnum bit, lowest first
+
+
+// The ways the contiguous blocks can be searched for
+enum SearchEnum { LABEL_SEARCH, FLOOD_SEARCH, HALO_SEARCH, STREAM_SEARCH };
+
+
+// Struct to contain the options chosen on the command line
+struct RunOptionsRec
+{
+	int rows;			// The amount of rows in the cube
+	int cols;			// The amount of columns in the cube
+	int deps;			// The amount of faces in the cube
+	SearchEnum search;	// How the contiguous blocks are searched for
+	LabelMethodEnum method;	// How the labeler gives provisional labels
+	ConnectivityEnum connectivity;	// Which cells of the same color touch
+	StorageEnum storage;	// How the cells of the cube are stored
+	int threadAmt;		// The amount of threads to label the cube with
+	int topAmt;			// The amount of largest blocks to report, 0 for none
+	int topType;		// The color of the reported blocks, ANY_TYPE for every color
+	string saveName;	// The cube file the populated cube is saved to, empty for none
+	string loadName;	// The cube file searched instead of a populated cube, empty for none
+	int recolorAmt;		// The amount of cells recolored after the search, 0 for none
+	int seed;			// The seed the cube is populated with, the first seed of -seeds
+	int lastSeed;		// The last seed of -seeds
+	bool batch;			// True when a batch of cubes is run instead of a single cube
+	string batchName;	// The job file of -batch, empty for a -seeds batch
+	ReportFormatEnum report;	// The format the output file is written in
+	PaletteClass palette;	// The colors the cube is populated with
+	string topName;		// The name of the color of -color, empty for every color
+	bool geometry;		// True when the shape of the blocks is reported with -geometry
+};
+
+
+// Struct to contain a single cube of a batch
+struct BatchJobRec
+{
+	int seed;			// The seed the cube is populated with
+	int rows;			// The amount of rows in the cube
+	int cols;			// The amount of columns in the cube
+	int deps;			// The amount of faces in the cube
+};
+
+
+// Struct to contain the result of a single cube of a batch
+struct BatchResultRec
+{
+	int blockAmt;		// The amount of contiguous blocks
+	int largType;		// The color of the largest block, ANY_TYPE if there is none
+	int largSize;		// The amount of cells in the largest block, 0 if there is none
+	int secLargType;	// The color of the second largest block, ANY_TYPE if there is none
+	int secLargSize;	// The amount of cells in the second largest block, 0 if there is none
+	int popType;		// The most populous color
+	int popAmt;			// The amount of cells of the most populous color
+};
+
+
+// Struct to contain the shapes the labeler measured with -geometry
+struct BlockShapesRec
+{
+	vector<GeometryRec> topShapes;	// The shape of each of the largest blocks asked for with -top
+	vector<int> sizeHistogram;	// The amount of blocks of 2^b to 2^(b + 1) - 1 cells at b
+};
+
+
+// Struct to contain everything the report of a single cube is written from
+struct CubeReportRec
+{
+	int rows;			// The amount of rows in the cube
+	int cols;			// The amount of columns in the cube
+	int deps;			// The amount of faces in the cube
+	size_t cellAmt;		// The amount of cells in the cube
+	BlockRec largest;	// The largest contiguous block, no cells if there is none
+	BlockRec secLargest;	// The second largest contiguous block, no cells if there is none
+	ColorArr colorArr;	// The amount of each color
+	int topAmt;			// The amount of largest blocks asked for with -top, 0 for none
+	vector<BlockRec> topBlocks;	// The largest blocks asked for with -top
+	int recolorAmt;		// The amount of cells recolored, 0 for none
+	vector<BlockRec> recolorBlocks;	// The largest blocks after -recolor
+	bool geometry;		// True when the shapes were measured with -geometry
+	BlockShapesRec shapes;	// The shapes of the -top blocks and the sizes of every block
+};
+
+
+// Struct to contain what a thread of a batch keeps from one cube to the next
+struct BatchWorkerRec
+{
+	unique_ptr<CubeClass> cube;	// The last cube populated, reused while the dimensions match
+	DefaultCubeClass defaultCube;	// The cube of the default dimensions held as records
+	LabelerClass labeler;		// Labels each cube, its labels keep their memory
+	vector<int> histogram;		// The amount of each color of the current cube
+};
+
+
+
+// Prototypes
+bool ReadArguments(/*IN*/int,					 // The amount of command line arguments
+				   /*IN*/char*[],				 // The command line arguments
+				   /*OUT*/RunOptionsRec&);		 // The options chosen
+bool ReadCubeHeader(/*IN/OUT*/RunOptionsRec&);	 // The options naming the cube file
+template <class Cube>
+void SearchCube(/*IN*/const RunOptionsRec&,		 // The options chosen
+				/*IN/OUT*/Cube&,				 // The cube being searched
+				/*IN/OUT*/ColorArr&,			 // The amount of each color, and the amount checked
+				/*OUT*/ListClass&,				 // The cells of the largest contiguous block
+				/*OUT*/ListClass&,				 // The cells of the second largest contiguous block
+				/*OUT*/int&,					 // The color of the largest contiguous block
+				/*OUT*/int&,					 // The color of the second largest contiguous block
+				/*OUT*/vector<BlockRec>&,		 // The largest blocks asked for with -top
+				/*OUT*/BlockShapesRec&);		 // The shapes measured with -geometry
+template <class Cube>
+void FloodSearch(/*IN/OUT*/Cube&,				 // The cube being searched
+				 /*IN/OUT*/ColorArr&,			 // The amount of each color, and the amount checked
+				 /*OUT*/ListClass&,				 // The cells of the largest contiguous block
+				 /*OUT*/ListClass&);			 // The cells of the second largest contiguous block
+template <class Cube>
+void HaloFloodSearch(/*IN*/const Cube&,		 // The cube being searched
+					 /*IN/OUT*/ColorArr&,		 // The amount of each color, and the amount checked
+					 /*OUT*/ListClass&,			 // The cells of the largest contiguous block
+					 /*OUT*/ListClass&);		 // The cells of the second largest contiguous block
+template <class Cube>
+void HaloFloodTopK(/*IN*/const Cube&,			 // The cube being searched
+				   /*IN/OUT*/ColorArr&,			 // The amount of each color, and the amount checked
+				   /*IN*/const int&,			 // The most blocks to find
+				   /*IN*/const int&,			 // The color of the blocks, or ANY_TYPE
+				   /*OUT*/vector<BlockRec>&);	 // The largest blocks
+void PrintTopBlocks(/*IN*/const vector<BlockRec>&, // The largest blocks
+					/*IN*/const string&,		 // Printed before the title
+					/*IN/OUT*/ReportWriterClass&); // Formats and writes the output file
+void PrintGeometry(/*IN*/const vector<BlockRec>&, // The largest blocks
+				   /*IN*/const BlockShapesRec&,	 // The shapes of the blocks and the sizes of every block
+				   /*IN/OUT*/ReportWriterClass&); // Formats and writes the output file
+void RecolorCube(/*IN/OUT*/CubeClass&,			 // The cube being recolored
+				 /*IN*/const int&,				 // The amount of cells recolored
+				 /*IN*/const int&,				 // The amount of colors in the palette
+				 /*OUT*/vector<BlockRec>&);		 // The two largest blocks after
+void MemorySearch(/*IN*/const RunOptionsRec&,	 // The options chosen
+				  /*IN/OUT*/ColorArr&,			 // The amount of each color, and the amount checked
+				  /*OUT*/ListClass&,			 // The cells of the largest contiguous block
+				  /*OUT*/ListClass&,			 // The cells of the second largest contiguous block
+				  /*OUT*/int&,					 // The color of the largest contiguous block
+				  /*OUT*/int&,					 // The color of the second largest contiguous block
+				  /*OUT*/vector<BlockRec>&,		 // The largest blocks asked for with -top
+				  /*OUT*/vector<BlockRec>&,		 // The largest blocks after -recolor
+				  /*OUT*/BlockShapesRec&);		 // The shapes measured with -geometry
+void StreamSearch(/*IN*/const RunOptionsRec&,	 // The options chosen
+				  /*IN/OUT*/ColorArr&,			 // The amount of each color, and the amount checked
+				  /*OUT*/ListClass&,			 // The cells of the largest contiguous block
+				  /*OUT*/ListClass&,			 // The cells of the second largest contiguous block
+				  /*OUT*/int&,					 // The color of the largest contiguous block
+				  /*OUT*/int&,					 // The color of the second largest contiguous block
+				  /*OUT*/long long&,			 // The amount of cells in the largest contiguous block
+				  /*OUT*/long long&,			 // The amount of cells in the second largest contiguous block
+				  /*OUT*/vector<BlockRec>&);	 // The largest blocks asked for with -top
+bool RunBatch(/*IN*/const RunOptionsRec&);		 // The options chosen
+bool ReadBatchJobs(/*IN*/const RunOptionsRec&,	 // The options naming the seeds
+				   /*OUT*/vector<BatchJobRec>&); // The cubes of the batch
+void AnalyzeCube(/*IN*/const BatchJobRec&,		 // The cube being analyzed
+				 /*IN*/const RunOptionsRec&,	 // The options chosen
+				 /*IN/OUT*/BatchWorkerRec&,		 // What the thread keeps between cubes
+				 /*OUT*/BatchResultRec&);		 // The result of the cube
+template <class Cube>
+void LabelBatchCube(/*IN*/const BatchJobRec&,	 // The cube being analyzed
+					/*IN*/const RunOptionsRec&,	 // The options chosen
+					/*IN/OUT*/Cube&,			 // The cube being populated and labeled
+					/*IN/OUT*/BatchWorkerRec&);	 // What the thread keeps between cubes
+void PrintBatch(/*IN*/const vector<BatchJobRec>&, // The cubes of the batch
+				/*IN*/const vector<BatchResultRec>&, // The result of every cube
+				/*IN*/const PaletteClass&,		 // The colors of the batch
+				/*IN/OUT*/ofstream&);			 // The batch output file
+template <class Cube>
+void PopulateCube(/*OUT*/Cube&,				 // The cube being populated
+				  /*IN/OUT*/ColorArr&,			 // A tracker to store the amount of each color
+				  /*IN*/const int&,				 // The amount of threads to populate with
+				  /*IN*/const int&);			 // The seed of the cube
+template <class Cube>
+void PopulateBlocks(/*IN/OUT*/Cube&,			 // The cube being populated
+					/*IN*/const size_t&,		 // The first block populated
+					/*IN*/const size_t&,		 // The block after the last populated
+					/*OUT*/vector<int>&,		 // The amount of each color populated
+					/*IN*/const int&);			 // The seed of the cube
+void PopulateCubeFile(/*IN*/const string&,		 // The cube file being populated
+					  /*IN*/const RunOptionsRec&, // The options holding the dimensions
+					  /*IN/OUT*/ColorArr&);		 // A tracker to store the amount of each color
+template <class Cube>
+void CountColors(/*IN*/const Cube&,			 // The cube being counted
+				 /*IN/OUT*/ColorArr&);			 // A tracker to store the amount of each color
+void InitializeColorArray(/*OUT*/ColorArr&,	 // The color array being initialized
+						  /*IN*/const int&);	 // The amount of colors in the palette
+void Move(/*IN*/const DirectionEnum&,			 // The desired direction to move in
+		  /*IN/OUT*/LocationRec&);				 // The current location
+string ReportFileName(/*IN*/const ReportFormatEnum&); // The format of the report
+void PrintReport(/*IN/OUT*/CubeReportRec&,		 // Everything the report is written from
+				 /*IN/OUT*/ReportWriterClass&);	 // Formats and writes the report
+void PrintTextReport(/*IN/OUT*/CubeReportRec&,	 // Everything the report is written from
+					 /*IN/OUT*/ReportWriterClass&); // Formats and writes the report
+void PrintCsvReport(/*IN/OUT*/CubeReportRec&,	 // Everything the report is written from
+					/*IN/OUT*/ReportWriterClass&); // Formats and writes the report
+void PrintJsonReport(/*IN/OUT*/CubeReportRec&,	 // Everything the report is written from
+					 /*IN/OUT*/ReportWriterClass&); // Formats and writes the report
+void PrintBinaryReport(/*IN/OUT*/CubeReportRec&, // Everything the report is written from
+					   /*IN/OUT*/ReportWriterClass&); // Formats and writes the report
+void PrintContig(/*IN*/ ListClass&,				 // A list of the locations of the cells to be printed
+				 /*IN*/ const int&,				 // The cells colors
+				 /*IN*/ const int&,				 // The amount of rows in the cube the cells are within
+				 /*IN*/ const int&,				 // The amount of columns in the cube the cells are within
+				 /*IN*/ const int&,				 // The amount of faces in the cube the cells are within
+				 /*IN/OUT*/ReportWriterClass&);	 // Formats and writes the output file
+void ColorStats(/*IN*/const ColorArr&,			 // The color array whose stats are being printed
+				/*IN*/const size_t&,			 // The amount of cells in the cube
+				/*IN/OUT*/ReportWriterClass&);	 // Formats and writes the output file
+float CoveragePercentage(/*IN*/const long long&,	 // The amount of the color in the cube
+						 /*IN*/const size_t&);	 // The amount of cells in the cube
+void FindPopulousColors(/*IN*/const ColorArr&,	 // The color array whose being analyzed
+						/*OUT*/int&,			 // Holds the most populous color's index	
+						/*OUT*/int&);			 // Holds the second most populous color's index
+void FindTopColors(/*IN*/const ColorArr&,		 // The color array whose being analyzed
+				   /*IN*/const int&,			 // The amount of colors to find
+				   /*OUT*/vector<int>&);		 // The most populous colors, most populous first
@@ -1,47 +1,190 @@
 #include "Cube.h"	// Specification file for the Cube class	
+#include "CubeFile.h"	// Grants Access to Cube File Reader Class
+#include "ComponentTracker.h"	// Grants Access to Component Tracker Class
+#include "Instrument.h"	// Grants Access to the instrumentation counters
 
 
 // Pre: None
 // Post: Populated is set to false in every cell
 //       Status is set to false in every cell
-CubeClass::CubeClass()
-{
-	// Cycle through each cell
-	for (int i = 0; i < MAX_ROW; i++)
-		for (int j = 0; j < MAX_COL; j++)
-			for (int k = 0; k < MAX_DEP; k++)
-			{
-				// Populated and Status get set to false
-				cubeArr[i][j][k].populated = false;
-				cubeArr[i][j][k].status = false;
-			}
-
+CubeClass::BasicCubeClass()
+	: CubeClass(DEFAULT_ROW, DEFAULT_COL, DEFAULT_DEP)
+{
 }// end DC
 
 
 
-// Pre: The desired values for all cell's CellType and status
+// Pre: The desired dimensions of the cube
+// Post: Populated is set to false in every cell
+//       Status is set to false in every cell
+// Exception: InvalidDimensionException is thrown if a dimension is less than 1
+CubeClass::BasicCubeClass(/*IN*/const int& numRows,     // The desired amount of rows
+						  /*IN*/const int& numCols,     // The desired amount of columns
+						  /*IN*/const int& numDeps,     // The desired amount of faces
+						  /*IN*/const StorageEnum& storeType,   // How the cells are stored
+						  /*IN*/const int& typeAmt)     // The amount of types a cell may hold
+{
+	CellRec emptyCell;	// The value every cell starts with
+
+	// Populated and Status get set to false
+	emptyCell.type = RED;
+	emptyCell.populated = false;
+	emptyCell.status = NO_STAMP;
+
+	Allocate(numRows, numCols, numDeps, emptyCell, storeType, typeAmt);
+
+}// end NDC
+
+
+
+// Pre: The desired dimensions and the desired values for all cell's CellType and status
 // Post: Populated gets set to true
 //       status and type are set to their desired values
-CubeClass::CubeClass(/*IN*/const CellType& typeOfCell,     // The desired CellType
-					 /*IN*/const bool& state)             // The desired status value
-{
-	// Cycle through each cell
-	for (int i = 0; i < MAX_ROW; i++)
-		for (int j = 0; j < MAX_COL; j++)
-			for (int k = 0; k < MAX_DEP; k++)
-			{
-				// Populated gets set to true
-				cubeArr[i][j][k].populated = true;
-				// Status and type get their desired values
-				cubeArr[i][j][k].status = state;
-				cubeArr[i][j][k].type = typeOfCell;
-			}
+// Exception: InvalidDimensionException is thrown if a dimension is less than 1
+CubeClass::BasicCubeClass(/*IN*/const int& numRows,             // The desired amount of rows
+						  /*IN*/const int& numCols,             // The desired amount of columns
+						  /*IN*/const int& numDeps,             // The desired amount of faces
+						  /*IN*/const CellType& typeOfCell,     // The desired CellType
+						  /*IN*/const bool& state,              // The desired status value
+						  /*IN*/const StorageEnum& storeType,   // How the cells are stored
+						  /*IN*/const int& typeAmt)             // The amount of types a cell may hold
+{
+	CellRec fullCell;	// The value every cell starts with
+
+	// Populated gets set to true
+	fullCell.populated = true;
+	// Status and type get their desired values
+	fullCell.status = state ? FIRST_STAMP : NO_STAMP;
+	fullCell.type = typeOfCell;
+
+	Allocate(numRows, numCols, numDeps, fullCell, storeType, typeAmt);
+
+}// end NDC
+
+
+
+// Pre: The name of a cube file written by SaveCube or CubeFileWriterClass
+// Post: The cube holds the dimensions and cells of the file, status is set to false
+//       in every cell. The storage is MAPPED_STORAGE, no cell has been read yet
+// Exception: CubeFileException is thrown if the file can not be opened or mapped,
+//            is not a cube file, or is too short for its dimensions
+CubeClass::BasicCubeClass(/*IN*/const string& fileName)     // The name of the cube file
+{
+	CubeFileReaderClass header(fileName);	// Checks the header and finds the cells
+
+	rows = header.GetRows();
+	cols = header.GetCols();
+	deps = header.GetDeps();
+	storage = MAPPED_STORAGE;
+	checkedAmt = ZERO;
+	populatedAmt = UNCOUNTED_CELLS;
+
+	// Map the cells where they are in the file, a byte or 16 bits each
+	if (header.GetLayout() == WORD_LAYOUT)
+		cubeArr.reset(new MappedStorage<uint16_t>(rows, cols, deps, fileName, header.GetDataOffset()));
+	else
+		cubeArr.reset(new MappedStorage<uint8_t>(rows, cols, deps, fileName, header.GetDataOffset()));
 
 }// end NDC
 
 
 
+// Pre: orig contains a cube to be copied
+// Post: The cube holds a copy of every cell of orig
+CubeClass::BasicCubeClass(/*IN*/const CubeClass& orig)     // The cube being copied
+	: cubeArr(orig.cubeArr->Clone())
+{
+	rows = orig.rows;
+	cols = orig.cols;
+	deps = orig.deps;
+	storage = orig.storage;
+	checkedAmt = orig.checkedAmt;
+	populatedAmt = orig.populatedAmt.load();
+
+	if (orig.tracker)
+		tracker.reset(new ComponentTrackerClass(*orig.tracker));
+}// end Copy Constructor
+
+
+
+// Pre: None
+// Post: The cube holds no cells
+CubeClass::~BasicCubeClass()
+{
+}// end Destructor
+
+
+
+// Pre: orig contains a cube to be copied
+// Post: The applying cube holds a copy of every cell of orig
+CubeClass& CubeClass::operator = (/*IN*/const CubeClass& orig)    // The cube being copied
+{
+	if (this != &orig)
+	{
+		cubeArr.reset(orig.cubeArr->Clone());
+		rows = orig.rows;
+		cols = orig.cols;
+		deps = orig.deps;
+		storage = orig.storage;
+		checkedAmt = orig.checkedAmt;
+		populatedAmt = orig.populatedAmt.load();
+
+		if (orig.tracker)
+			tracker.reset(new ComponentTrackerClass(*orig.tracker));
+		else
+			tracker.reset();
+	}
+
+	return *this;
+}// end operator =
+
+
+
+// Pre: Cube Exist
+// Post: The storage type of the cube is returned
+StorageEnum CubeClass::GetStorage() const
+{
+	return storage;
+}// end GetStorage
+
+
+
+// Pre: Cube Exist
+// Post: The amount of rows is returned
+int CubeClass::GetRows() const
+{
+	return rows;
+}// end GetRows
+
+
+
+// Pre: Cube Exist
+// Post: The amount of columns is returned
+int CubeClass::GetCols() const
+{
+	return cols;
+}// end GetCols
+
+
+
+// Pre: Cube Exist
+// Post: The amount of faces is returned
+int CubeClass::GetDeps() const
+{
+	return deps;
+}// end GetDeps
+
+
+
+// Pre: Cube Exist
+// Post: rows * cols * deps is returned
+size_t CubeClass::GetCellCount() const
+{
+	return (size_t)rows * (size_t)cols * (size_t)deps;
+}// end GetCellCount
+
+
+
 // Pre: Cube Exist, the location of the cell who's status is being returned
 // Post: Return true if the cell has been checked, otherwise false
 // Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
@@ -49,10 +192,13 @@ bool CubeClass::GetStatus(/*IN*/const LocationRec& cell) const   // The desired
 {
 	// Check to see if the cell location is valid
 	if (InvalidLocation(cell))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
 		throw OutOfBoundsException();
+	}
 
 	// returns the status of the current cell
-	return cubeArr[cell.x][cell.y][cell.z].status;
+	return cubeArr->GetStatus(cell);
 }// end GetStatus
 
 
@@ -66,10 +212,19 @@ void CubeClass::SetStatus(/*IN*/const LocationRec& cell,    // The desired cell
 {
 	// Check to see if the cell location is valid
 	if (InvalidLocation(cell))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
 		throw OutOfBoundsException();
-
-	// Set status to the desired value
-	cubeArr[cell.x][cell.y][cell.z].status = stat;
+	}
+
+	// Set status to the desired value, keeping the amount checked current when it changes
+	if (cubeArr->SetStatus(cell, stat))
+	{
+		if (stat)
+			checkedAmt++;
+		else
+			checkedAmt--;
+	}
 }// end SetStatus
 
 
@@ -82,15 +237,18 @@ CellType CubeClass::GetType(/*IN*/const LocationRec& cell) const    // The desir
 {
 	// Check to see if the cell location is valid
 	if (InvalidLocation(cell))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
 		throw OutOfBoundsException();
+	}
 
 	// Check to see if the current cell has a type yet
-	if (cubeArr[cell.x][cell.y][cell.z].populated == false)
+	if (!cubeArr->GetPopulated(cell))
 		throw EmptyTypeException();		// Throw an exception if it doesn't
 
 	// Return the cell's type
 	else
-		return cubeArr[cell.x][cell.y][cell.z].type;
+		return cubeArr->GetType(cell);
 
 }// end GetType
 
@@ -105,32 +263,43 @@ void CubeClass::SetType(/*IN*/const LocationRec& cell,    // The desired cell lo
 {
 	// Check to see if the cell location is valid
 	if (InvalidLocation(cell))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
 		throw OutOfBoundsException();
+	}
+
+	// Count the cell the first time it is given a type
+	if (populatedAmt != UNCOUNTED_CELLS && !cubeArr->GetPopulated(cell))
+		populatedAmt++;
 
 	// Set the cell to the new CellType
-	cubeArr[cell.x][cell.y][cell.z].type = currType;
+	// and update the cell to have a CellType
+	cubeArr->SetType(cell, currType);
 
-	// Update the cell to have a CellType
-	cubeArr[cell.x][cell.y][cell.z].populated = true;
+	// Update the blocks the cell left and joined
+	if (tracker)
+		tracker->SetCellType(((size_t)cell.x * cols + cell.y) * deps + cell.z, (int)currType);
 }// end SetType
 
 
 
+// Pre: No other thread is using the cube
+// Post: Status is set to false in every cell, the types are unchanged
+void CubeClass::ClearStatus()
+{
+	// The storage starts a new generation, no cell is visited
+	cubeArr->ClearStatus();
+	checkedAmt = ZERO;
+}// end ClearStatus
+
+
+
 // Pre: Cube Exist
 // Post: Return true if every cell has been checked, otherwise false
 bool CubeClass::CubeStatus() const
 {
-	// Cycle through each cell
-	for (int i = 0; i < MAX_ROW; i++)
-		for (int j = 0; j < MAX_COL; j++)
-			for (int k = 0; k < MAX_DEP; k++)
-			{
-				// Check to see if the cell has not been checked
-				if (!cubeArr[i][j][k].status)
-					return false;	// return false, the cube is not fully checked yet!
-			}
-	// Every cell has been checked
-	return true;
+	// Every cell has been checked when the amount checked is the amount of cells
+	return checkedAmt == GetCellCount();
 }// end CubeStatus
 
 
@@ -139,29 +308,220 @@ bool CubeClass::CubeStatus() const
 // Post: Return true if every cell has been populated, otherwise false
 bool CubeClass::CubePopStatus() const
 {
-	// Cycle through each cell
-	for (int i = 0; i < MAX_ROW; i++)
-		for (int j = 0; j < MAX_COL; j++)
-			for (int k = 0; k < MAX_DEP; k++)
-			{
-				// Check to see if the cell has not been populated
-				if (!cubeArr[i][j][k].populated)
-					return false;	// return false, the cube is not fully poulated yet!
-			}
-	// Every cell has been populated
-	return true;
+	// A mapped cube is counted once, every later type set keeps the amount current
+	if (populatedAmt == UNCOUNTED_CELLS)
+		populatedAmt = cubeArr->CountPopulated();
 
+	// Every cell has been populated when the amount populated is the amount of cells
+	return populatedAmt == GetCellCount();
 }// end CubePopStatus
 
 
 
+// Pre: No other thread is using the cube
+// Post: Every cell holds what it held, any other storage is unchanged
+void CubeClass::Compact()
+{
+	cubeArr->Compact();
+}// end Compact
+
+
+
+// Pre: Cube Exist
+// Post: Return false if no cell of the row has a type. Every other storage returns true
+// Exception: OutOfBoundsException is thrown if the row is not within the cube
+bool CubeClass::RowHasTypes(/*IN*/const int& x,          // The row of the desired cells
+							/*IN*/const int& y) const    // The column of the desired cells
+{
+	LocationRec rowStart;	// The first cell of the row
+
+	rowStart.x = x;
+	rowStart.y = y;
+	rowStart.z = ZERO;
+
+	// Check to see if the row is valid
+	if (InvalidLocation(rowStart))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	return cubeArr->RowHasTypes(x, y);
+
+}// end RowHasTypes
+
+
+
+// Pre: Cube Exist
+// Post: The integer index of the type of every cell of the chunk of CHUNK_EDGE^3 cells
+//       holding the cell is returned, EMPTY_CELL if they differ or have no type.
+//       A storage that keeps no chunks returns EMPTY_CELL
+// Exception: OutOfBoundsException is thrown if the cell is not within the cube
+int CubeClass::GetChunkType(/*IN*/const int& x,          // The row of the cell
+							/*IN*/const int& y,          // The column of the cell
+							/*IN*/const int& z) const    // The face of the cell
+{
+	LocationRec cell;	// The cell whose chunk is read
+
+	cell.x = x;
+	cell.y = y;
+	cell.z = z;
+
+	// Check to see if the cell is valid
+	if (InvalidLocation(cell))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	return cubeArr->GetChunkType(x, y, z);
+
+}// end GetChunkType
+
+
+
+// Pre: Cube Exist, rowTypes can hold GetDeps() values
+// Post: rowTypes[z] holds the integer index of the CellType of cell (x, y, z),
+//       or EMPTY_CELL if the cell has no type
+// Exception: OutOfBoundsException is thrown if the row is not within the cube
+void CubeClass::GetRowTypes(/*IN*/const int& x,          // The row of the desired cells
+							/*IN*/const int& y,          // The column of the desired cells
+							/*OUT*/int rowTypes[]) const // The type of each cell in the row
+{
+	LocationRec rowStart;	// The first cell of the row
+
+	rowStart.x = x;
+	rowStart.y = y;
+	rowStart.z = ZERO;
+
+	// Check to see if the row is valid
+	if (InvalidLocation(rowStart))
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	// The storage copies the row
+	cubeArr->GetRowTypes(x, y, rowTypes);
+
+}// end GetRowTypes
+
+
+
+// Pre: Cube Exist, cellTypes holds amount types that are not EMPTY_CELL
+// Post: The cell with linear index first + i holds type cellTypes[i] and is populated.
+//       Ranges that start on a multiple of CELL_RANGE_ALIGN and do not overlap may be
+//       set by separate threads at once
+// Exception: OutOfBoundsException is thrown if the range is not within the cube
+void CubeClass::SetCellTypes(/*IN*/const size_t& first,           // The linear index of the first cell
+							 /*IN*/const size_t& amount,          // The amount of cells
+							 /*IN*/const int cellTypes[])         // The type of each cell
+{
+	size_t newAmt;	// The amount of cells of the range populated for the first time
+
+	// Check to see if the range is valid
+	if (first > GetCellCount() || amount > GetCellCount() - first)
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	// The storage sets the range and counts the cells it populated
+	newAmt = cubeArr->SetCellTypes(first, amount, cellTypes);
+
+	if (populatedAmt != UNCOUNTED_CELLS)
+		populatedAmt += newAmt;
+
+	// Update the blocks a cell at a time
+	if (tracker)
+		for (size_t i = 0; i < amount; i++)
+			tracker->SetCellType(first + i, cellTypes[i]);
+
+}// end SetCellTypes
+
+
+
+// Pre: Cube Exist
+// Post: Every contiguous block is labeled, every later type set updates the blocks
+//       it touches. Nothing changes if the blocks are already kept
+void CubeClass::EnableComponents()
+{
+	if (!tracker)
+		tracker.reset(new ComponentTrackerClass(*this));
+}// end EnableComponents
+
+
+
+// Pre: Cube Exist
+// Post: Return true if EnableComponents has been called, otherwise false
+bool CubeClass::HasComponents() const
+{
+	return tracker != nullptr;
+}// end HasComponents
+
+
+
+// Pre: Cube Exist
+// Post: The tracker holding the label of every cell and the details of every block is returned
+// Exception: NoComponentsException is thrown if EnableComponents has not been called
+const ComponentTrackerClass& CubeClass::GetComponents() const
+{
+	if (!tracker)
+		throw NoComponentsException();
+
+	return *tracker;
+}// end GetComponents
+
+
+
 // Pre: Cube Exist
 // Post: Return true if the location is invalid, otherwise false
 bool CubeClass::InvalidLocation(/*IN*/const LocationRec& cell) const   // The desired cell location
 {
-	if (cell.x >= MAX_ROW || cell.x < ZERO || cell.y >= MAX_COL ||
-		cell.y < ZERO || cell.z >= MAX_DEP || cell.z < ZERO)
+	if (cell.x >= rows || cell.x < ZERO || cell.y >= cols ||
+		cell.y < ZERO || cell.z >= deps || cell.z < ZERO)
 		return true;
 
 	return false;
-}// end InvalidLocation
\ No newline at end of file
+}// end InvalidLocation
+
+
+
+// Pre: The desired dimensions, starting cell, storage type and amount of types. The
+//      status of initCell is NO_STAMP or FIRST_STAMP
+// Post: rows, cols, deps and storage are set and every cell holds initCell, the amount
+//       checked and populated count every cell or none
+// Exception: InvalidDimensionException is thrown if a dimension is less than 1
+void CubeClass::Allocate(/*IN*/const int& numRows,             // The desired amount of rows
+						 /*IN*/const int& numCols,             // The desired amount of columns
+						 /*IN*/const int& numDeps,             // The desired amount of faces
+						 /*IN*/const CellRec& initCell,        // The value every cell starts with
+						 /*IN*/const StorageEnum& storeType,   // How the cells are stored
+						 /*IN*/const int& typeAmt)             // The amount of types a cell may hold
+{
+	// Check to see if the dimensions are valid
+	if (numRows < OFFSET || numCols < OFFSET || numDeps < OFFSET)
+		throw InvalidDimensionException();
+
+	rows = numRows;
+	cols = numCols;
+	deps = numDeps;
+	storage = storeType;
+	checkedAmt = initCell.status != NO_STAMP ? GetCellCount() : ZERO;
+	populatedAmt = initCell.populated ? GetCellCount() : ZERO;
+
+	// Allocate every cell in the desired storage, a packed type is a byte while every type fits
+	if (storage == PACKED_STORAGE && typeAmt > BYTE_TYPE_AMT)
+		cubeArr.reset(new PackedStorage<uint16_t>(rows, cols, deps, initCell));
+	else if (storage == PACKED_STORAGE)
+		cubeArr.reset(new PackedStorage<uint8_t>(rows, cols, deps, initCell));
+	else if (storage == TILED_STORAGE)
+		cubeArr.reset(new TiledStorage(rows, cols, deps, initCell));
+	else if (storage == CHUNKED_STORAGE)
+		cubeArr.reset(new ChunkedStorage(rows, cols, deps, initCell));
+	else if (storage == SPARSE_STORAGE)
+		cubeArr.reset(new SparseStorage(rows, cols, deps, initCell));
+	else
+		cubeArr.reset(new RecordStorage(rows, cols, deps, initCell));
+
+}// end Allocate
\ No newline at end of file
@@ -9,6 +9,13 @@
         Contains the specifications for a Cube Class. The struct definition for the
         cube's cells should be placed in the file CellRec.h.
 
+        The cube is a template, BasicCubeClass<Rows, Cols, Deps, Cell>. CubeClass is the
+        form with every extent DYNAMIC_EXTENT, its dimensions and storage are chosen when
+        it is constructed and it is defined here and in Cube.cpp. A cube whose extents are
+        given when compiled is defined in FixedCube.h, its cells are held in place and
+        every method is inlined. Both forms have the same methods for reading and writing
+        cells, only CubeClass opens cube files and keeps its contiguous blocks current.
+
 
     ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
         1 - The definition of the struct CellRec will be supplied by the client
@@ -17,75 +24,267 @@
             type which will be of CellType. CellType should be a typedef found in
             CellRec.h. The component field type will be used to set the type of
             each cell
-        3 - Struct CellRec will contain as its second field a bool named
+        3 - Struct CellRec will contain as its second field a StatusStamp named
             status. The component field status will be used to set the status of
-            the cell
+            the cell, the cell is checked while it holds the generation of the cube
+            (see CellRec.h). ClearStatus starts a new generation, so every cell is
+            unchecked without visiting one
         4 - Struct CubeRec will contain as its third field a component named
             populated which will be a bool. Bool populated is to check on if
             the cell has been given a specific type yet.
-        5 - Must contain a 3 dimensional array of typedef CellRec, named Cube3DArr
+        5 - The dimensions of the cube are chosen at construction, every dimension
+            must be greater than 0. The cells are stored in a single heap allocated
+            buffer. The linear index of a cell, used by SetCellTypes, is row major as
+            ((x * cols) + y) * deps + z whatever the storage
+        6 - How the cells are stored is chosen at construction, see CubeStorage.h.
+            RECORD_STORAGE keeps a CellRec per cell, PACKED_STORAGE keeps a plane
+            of types and a bitset each for status and populated, TILED_STORAGE keeps
+            a CellRec per cell in bricks ordered along a Morton curve, CHUNKED_STORAGE
+            keeps chunks that are a single value while their cells are alike,
+            SPARSE_STORAGE keeps only the chunks unlike the starting cell in a hash
+            table, so a cube of few populated cells is never allocated. Every
+            method behaves the same for each. The plane holds a byte per type when the
+            amount of types given is at most BYTE_TYPE_AMT, otherwise 16 bits
+        7 - A cube opened from a cube file (see CubeFile.h) uses MAPPED_STORAGE, the cells
+            of the file are mapped in place and only read as they are touched, a byte or 16
+            bits per cell as the layout of the file says. Changing a type of the cube
+            never changes the file, use SaveCube to keep the changes
+        8 - Once EnableComponents is called the cube keeps the label and size of every
+            contiguous block current through every SetType and SetCellTypes, at a cost
+            proportional to the blocks touched (see ComponentTracker.h). SetCellTypes
+            may then only be called by one thread at a time
+        9 - The cube keeps the amount of checked and populated cells as they change, so
+            CubeStatus and CubePopStatus do not visit a cell. A cube opened from a cube
+            file counts its populated cells the first time CubePopStatus is called
 
 
     EXCEPTION HANDLING/ERROR CHECKING:
         1 - OutOfBoundsException thrown when invalid location is sent in
         2 - EmptyTypeException thrown when GetType is called on a cell with no specified type
+        3 - InvalidDimensionException thrown when a cube is constructed with a dimension
+            less than 1
+        4 - CubeFileException thrown when a cube file can not be opened or mapped, is not
+            a cube file, or is too short for its dimensions
+        5 - NoComponentsException thrown when the components of a cube are asked for before
+            EnableComponents is called
 
                            SUMMARY OF METHODS:
     PUBLIC METHODS
         CubeClass() - Instantiates the class object to default values.
+                      The cube is DEFAULT_ROW x DEFAULT_COL x DEFAULT_DEP
                       populated and status get set to false in every cell.
-        CubeClass(*IN*const CellType& typeOfCell,
-                  *IN*const bool& state);
-                  -  Instantiates the class object to specified values for every cell's
+        CubeClass(*IN*const int& rows,
+                  *IN*const int& cols,
+                  *IN*const int& deps,
+                  *IN*const StorageEnum& storeType = RECORD_STORAGE,
+                  *IN*const int& typeAmt = BYTE_TYPE_AMT)
+                  -  Instantiates a rows x cols x deps cube
+                     populated and status get set to false in every cell.
+        CubeClass(*IN*const int& rows,
+                  *IN*const int& cols,
+                  *IN*const int& deps,
+                  *IN*const CellType& typeOfCell,
+                  *IN*const bool& state,
+                  *IN*const StorageEnum& storeType = RECORD_STORAGE,
+                  *IN*const int& typeAmt = BYTE_TYPE_AMT);
+                  -  Instantiates a rows x cols x deps cube to specified values for every cell's
                      status and celltype data members
                      Every cell's populated datatype gets set to true
+        CubeClass(*IN*const string& fileName) - Opens a cube file, mapping its cells in place
+        CubeClass(*IN*const CubeClass& orig) - Creates a deep copy of orig
+        ~CubeClass() - Releases the storage and the components
+        CubeClass& operator = (*IN*const CubeClass& orig) - Creates a deep copy of orig
+        StorageEnum GetStorage() const - Gets how the cells of the cube are stored
+        int GetRows() const - Gets the amount of rows in the cube
+        int GetCols() const - Gets the amount of columns in the cube
+        int GetDeps() const - Gets the amount of faces in the cube
+        size_t GetCellCount() const - Gets the amount of cells in the cube
         bool GetStatus(*IN*const LocationRec& cell) const - Gets the status of a cell
         void SetStatus(*IN*const LocationRec& cell,
                        *IN*const bool& stat) - Sets the status of a cell
         CellType GetType(*IN*const LocationRec& cell) const - Gets the CellType of the specified cell
         void SetType(*IN*const LocationRec& cell,
                      *IN*const CellType& currType) - Sets the CellType of the specified cell
+        void ClearStatus() - Sets the status of every cell to unchecked
         bool CubeStatus() const - Checks the status of the cube
         bool CubePopStatus() const - Checks the population status of the cube
+        void Compact() - Collapses the cells that are alike, if the storage can
+        bool RowHasTypes(*IN*const int& x,
+                         *IN*const int& y) const - Checks if any cell along a row may have a type
+        int GetChunkType(*IN*const int& x,
+                         *IN*const int& y,
+                         *IN*const int& z) const - Gets the type of a chunk whose cells all hold it
+        void GetRowTypes(*IN*const int& x,
+                         *IN*const int& y,
+                         *OUT*int rowTypes[]) const
+                  -  Gets the type of every cell along the depth of a row
+        void SetCellTypes(*IN*const size_t& first,
+                          *IN*const size_t& amount,
+                          *IN*const int cellTypes[])
+                  -  Sets the type of a range of cells in row major order
+        void EnableComponents() - Starts keeping every contiguous block of the cube current
+        bool HasComponents() const - Checks if the contiguous blocks are kept current
+        const ComponentTrackerClass& GetComponents() const - Gets the contiguous blocks
 
     PRIVATE MEMBERS:
-        Cube3DArr cubeArr; // The cube containing the cell's information
+        int rows;                           // The amount of rows in the cube
+        int cols;                           // The amount of columns in the cube
+        int deps;                           // The amount of faces in the cube
+        StorageEnum storage;                // How the cells of the cube are stored
+        unique_ptr<CubeStorage> cubeArr;    // The cube containing the cell's information
+        unique_ptr<ComponentTrackerClass> tracker;  // The contiguous blocks, none until enabled
+        size_t checkedAmt;                  // The amount of checked cells
+        mutable atomic<size_t> populatedAmt;    // The amount of populated cells, UNCOUNTED_CELLS
+                                                // until a mapped cube is counted
 
         bool InvalidLocation(*IN*const LocationRec& cell) const - Checks if the cell location is valid
+        void Allocate(*IN*const int& numRows,
+                      *IN*const int& numCols,
+                      *IN*const int& numDeps,
+                      *IN*const CellRec& initCell,
+                      *IN*const StorageEnum& storeType,
+                      *IN*const int& typeAmt) - Allocates the storage of the cube
 
 */
 
-#include "Cellrec.h"	// SUPPLIED BY THE CLIENT
+#include <memory>    // Gives access to the pointer owning the storage
+#include <atomic>    // Gives access to the amount populated by separate threads
+#include "CellRec.h"	// SUPPLIED BY THE CLIENT
 // Header which contains details of the cube record
+#include "CubeStorage.h"    // For the storage behind the cube
 #include "CubeExceptions.h" // For Cube Exception Classes
 
 using namespace std;
 
 
+class ComponentTrackerClass;    // Keeps the contiguous blocks current, see ComponentTracker.h
+
+
+const int DYNAMIC_EXTENT = -1;  // An extent chosen when the cube is constructed instead of compiled
+const size_t UNCOUNTED_CELLS = ~(size_t)0;  // The amount populated of a cube whose cells have not been counted
+
 
+// A cube of Rows x Cols x Deps cells of Cell, the fixed form is defined in FixedCube.h
+template <int Rows = DYNAMIC_EXTENT, int Cols = DYNAMIC_EXTENT, int Deps = DYNAMIC_EXTENT, class Cell = CellRec>
+class BasicCubeClass;
 
-class CubeClass
+typedef BasicCubeClass<> CubeClass;     // The cube whose dimensions are chosen when constructed
+
+
+
+template <>
+class BasicCubeClass<DYNAMIC_EXTENT, DYNAMIC_EXTENT, DYNAMIC_EXTENT, CellRec>
 {
 public:
 
+    typedef CellType TypeOfCell;    // The type held by every cell
+
+
     // O(N^3) : Default Constructor
     // Purpose: Instantiates the class object to default values.
+    //          The cube is DEFAULT_ROW x DEFAULT_COL x DEFAULT_DEP
     //          populated and status get set to false in every cell.
     // Pre: None
     // Post: Populated is set to false in every cell
     //       Status is set to false in every cell
-    CubeClass();
+    BasicCubeClass();
+
+
+    // O(N^3) : Non-Default Constructor
+    // Purpose: Instantiates a cube of the desired dimensions
+    //          populated and status get set to false in every cell.
+    // Pre: The desired dimensions of the cube
+    // Post: Populated is set to false in every cell
+    //       Status is set to false in every cell
+    // Exception: InvalidDimensionException is thrown if a dimension is less than 1
+    BasicCubeClass(/*IN*/const int& numRows,     // The desired amount of rows
+                   /*IN*/const int& numCols,     // The desired amount of columns
+                   /*IN*/const int& numDeps,     // The desired amount of faces
+                   /*IN*/const StorageEnum& storeType = RECORD_STORAGE,     // How the cells are stored
+                   /*IN*/const int& typeAmt = BYTE_TYPE_AMT);   // The amount of types a cell may hold
 
 
     // O(N^3) : Non-Default Constructor
-    // Purpose: Instantiates the class object to specified values for every cell's
-    //          status and celltype data members
+    // Purpose: Instantiates a cube of the desired dimensions to specified values
+    //          for every cell's status and celltype data members
     //          Every cell's populated datatype gets set to true
-    // Pre: The desired values for all cell's CellType and status
+    // Pre: The desired dimensions and the desired values for all cell's CellType and status
     // Post: Populated gets set to true
     //       status and CellType are set to their desired values
-    CubeClass(/*IN*/const CellType& typeOfCell,     // The desired CellType
-              /*IN*/const bool& state);              // The desired status value
+    // Exception: InvalidDimensionException is thrown if a dimension is less than 1
+    BasicCubeClass(/*IN*/const int& numRows,             // The desired amount of rows
+                   /*IN*/const int& numCols,             // The desired amount of columns
+                   /*IN*/const int& numDeps,             // The desired amount of faces
+                   /*IN*/const CellType& typeOfCell,     // The desired CellType
+                   /*IN*/const bool& state,              // The desired status value
+                   /*IN*/const StorageEnum& storeType = RECORD_STORAGE,     // How the cells are stored
+                   /*IN*/const int& typeAmt = BYTE_TYPE_AMT);   // The amount of types a cell may hold
+
+
+    // O(N^3 / 64) : Non-Default Constructor
+    // Purpose: Opens a cube file, mapping its cells in place instead of reading them
+    // Pre: The name of a cube file written by SaveCube or CubeFileWriterClass
+    // Post: The cube holds the dimensions and cells of the file, status is set to false
+    //       in every cell. The storage is MAPPED_STORAGE, no cell has been read yet
+    // Exception: CubeFileException is thrown if the file can not be opened or mapped,
+    //            is not a cube file, or is too short for its dimensions
+    explicit BasicCubeClass(/*IN*/const string& fileName);     // The name of the cube file
+
+
+    // O(N^3) : Copy Constructor
+    // Purpose: Creates a deep copy of orig
+    // Pre: orig contains a cube to be copied
+    // Post: The cube holds a copy of every cell of orig
+    BasicCubeClass(/*IN*/const CubeClass& orig);     // The cube being copied
+
+
+    // O(1) : Destructor
+    // Purpose: Releases the storage and the components
+    // Pre: None
+    // Post: The cube holds no cells
+    ~BasicCubeClass();
+
+
+    // O(N^3) : Overloaded Operator
+    // Purpose: Creates a deep copy of orig
+    // Pre: orig contains a cube to be copied
+    // Post: The applying cube holds a copy of every cell of orig
+    CubeClass& operator = (/*IN*/const CubeClass& orig);    // The cube being copied
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets how the cells of the cube are stored
+    // Pre: Cube Exist
+    // Post: The storage type of the cube is returned
+    StorageEnum GetStorage() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of rows in the cube
+    // Pre: Cube Exist
+    // Post: The amount of rows is returned
+    int GetRows() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of columns in the cube
+    // Pre: Cube Exist
+    // Post: The amount of columns is returned
+    int GetCols() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of faces in the cube
+    // Pre: Cube Exist
+    // Post: The amount of faces is returned
+    int GetDeps() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of cells in the cube
+    // Pre: Cube Exist
+    // Post: rows * cols * deps is returned
+    size_t GetCellCount() const;
 
 
     // O(1) : Observer Accessor
@@ -125,24 +324,123 @@ public:
                 /*IN*/const CellType& currType); // The desired type of the cell
 
 
-    // O(N^3) : Observer Summarizer
+    // O(1) : Mutator
+    // Purpose: Sets the status of every cell to unchecked, so the cube can be searched again.
+    //          The storage starts a new generation instead of visiting every cell, every
+    //          255th clear resets the stamps
+    // Pre: No other thread is using the cube
+    // Post: Status is set to false in every cell, the types are unchanged
+    void ClearStatus();
+
+
+    // O(1) : Observer Summarizer
     // Purpose: Checks the status of the cube
     // Pre: Cube Exist
     // Post: Return true if every cell has been checked, otherwise false
     bool CubeStatus() const;
 
 
-    // O(N^3) : Observer Summarizer
-    // Purpose: Check the population status of the cube
+    // O(1) : Observer Summarizer
+    // Purpose: Check the population status of the cube. A cube opened from a cube file
+    //          counts its cells the first time, O(N^3)
     // Pre: Cube Exist
     // Post: Return true if every cell has been populated, otherwise false
     bool CubePopStatus() const;
 
 
+    // O(N^3) : Mutator
+    // Purpose: Collapses the cells that are alike, if the storage can. A CHUNKED_STORAGE
+    //          cube makes every chunk whose cells hold one type a single value, a
+    //          SPARSE_STORAGE cube also drops the chunks that hold the starting cell again
+    // Pre: No other thread is using the cube
+    // Post: Every cell holds what it held, any other storage is unchanged
+    void Compact();
+
+
+    // O(N) : Observer Predicator
+    // Purpose: Checks if any cell along the depth of a row may have a type, so a reader may
+    //          skip the rows a SPARSE_STORAGE cube knows are empty
+    // Pre: Cube Exist
+    // Post: Return false if no cell of the row has a type. Every other storage returns true
+    // Exception: OutOfBoundsException is thrown if the row is not within the cube
+    bool RowHasTypes(/*IN*/const int& x,          // The row of the desired cells
+                     /*IN*/const int& y) const;   // The column of the desired cells
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type of the chunk holding a cell when every cell of the chunk holds
+    //          it, so the labeler may treat a chunk of a CHUNKED_STORAGE or
+    //          SPARSE_STORAGE cube as one block
+    // Pre: Cube Exist
+    // Post: The integer index of the type of every cell of the chunk of CHUNK_EDGE^3 cells
+    //       holding the cell is returned, EMPTY_CELL if they differ or have no type.
+    //       A storage that keeps no chunks returns EMPTY_CELL
+    // Exception: OutOfBoundsException is thrown if the cell is not within the cube
+    int GetChunkType(/*IN*/const int& x,          // The row of the cell
+                     /*IN*/const int& y,          // The column of the cell
+                     /*IN*/const int& z) const;   // The face of the cell
+
+
+    // O(N) : Observer Accessor
+    // Purpose: Gets the type of every cell along the depth of a row, so that a whole
+    //          row can be read without a bounds check per cell
+    // Pre: Cube Exist, rowTypes can hold GetDeps() values
+    // Post: rowTypes[z] holds the integer index of the CellType of cell (x, y, z),
+    //       or EMPTY_CELL if the cell has no type
+    // Exception: OutOfBoundsException is thrown if the row is not within the cube
+    void GetRowTypes(/*IN*/const int& x,          // The row of the desired cells
+                     /*IN*/const int& y,          // The column of the desired cells
+                     /*OUT*/int rowTypes[]) const; // The type of each cell in the row
+
+
+    // O(N) : Mutator
+    // Purpose: Sets the type of a range of cells in row major order, so that a cube can be
+    //          filled without a bounds check per cell
+    // Pre: Cube Exist, cellTypes holds amount types that are not EMPTY_CELL
+    // Post: The cell with linear index first + i holds type cellTypes[i] and is populated.
+    //       Ranges that start on a multiple of CELL_RANGE_ALIGN and do not overlap may be
+    //       set by separate threads at once
+    // Exception: OutOfBoundsException is thrown if the range is not within the cube
+    void SetCellTypes(/*IN*/const size_t& first,           // The linear index of the first cell
+                      /*IN*/const size_t& amount,          // The amount of cells
+                      /*IN*/const int cellTypes[]);        // The type of each cell
+
+
+    // O(N^3) : Mutator
+    // Purpose: Starts keeping every contiguous block of the cube current
+    // Pre: Cube Exist
+    // Post: Every contiguous block is labeled, every later type set updates the blocks
+    //       it touches. Nothing changes if the blocks are already kept
+    void EnableComponents();
+
+
+    // O(1) : Observer Predicator
+    // Purpose: Checks if the contiguous blocks are kept current
+    // Pre: Cube Exist
+    // Post: Return true if EnableComponents has been called, otherwise false
+    bool HasComponents() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the contiguous blocks of the cube
+    // Pre: Cube Exist
+    // Post: The tracker holding the label of every cell and the details of every block is returned
+    // Exception: NoComponentsException is thrown if EnableComponents has not been called
+    const ComponentTrackerClass& GetComponents() const;
+
+
 private:
 
     // PDMs
-    Cube3DArr cubeArr; // The cube containing the cell's information
+    int rows;                           // The amount of rows in the cube
+    int cols;                           // The amount of columns in the cube
+    int deps;                           // The amount of faces in the cube
+    StorageEnum storage;                // How the cells of the cube are stored
+    unique_ptr<CubeStorage> cubeArr;    // The cube containing the cell's information
+    unique_ptr<ComponentTrackerClass> tracker;  // The contiguous blocks, none until enabled
+    size_t checkedAmt;                  // The amount of checked cells
+    mutable atomic<size_t> populatedAmt;    // The amount of populated cells, UNCOUNTED_CELLS
+                                            // until a mapped cube is counted
 
 
     // O(1) : Observer Predicator
@@ -151,4 +449,19 @@ private:
     // Post: Return true if the location is invalid, otherwise false
     bool InvalidLocation(/*IN*/const LocationRec& cell) const;   // The desired cell location
 
+
+    // O(N^3) : Mutator
+    // Purpose: Allocates the storage of the cube with every cell holding initCell
+    // Pre: The desired dimensions, starting cell, storage type and amount of types. The
+    //      status of initCell is NO_STAMP or FIRST_STAMP
+    // Post: rows, cols, deps and storage are set and every cell holds initCell, the amount
+    //       checked and populated count every cell or none
+    // Exception: InvalidDimensionException is thrown if a dimension is less than 1
+    void Allocate(/*IN*/const int& numRows,             // The desired amount of rows
+                  /*IN*/const int& numCols,             // The desired amount of columns
+                  /*IN*/const int& numDeps,             // The desired amount of faces
+                  /*IN*/const CellRec& initCell,        // The value every cell starts with
+                  /*IN*/const StorageEnum& storeType,   // How the cells are stored
+                  /*IN*/const int& typeAmt);            // The amount of types a cell may hold
+
 }; // end CubeClass
\ No newline at end of file
@@ -15,4 +15,20 @@ class OutOfBoundsException
 
 // Exception for getting the type of cell, when the cell has no type
 class EmptyTypeException
-{};
\ No newline at end of file
+{};
+
+// Exception for constructing a cube with a dimension less than 1
+class InvalidDimensionException
+{};
+
+// Exception for a cube file that can not be opened, read or written, or is not a cube file
+class CubeFileException
+{};
+
+// Exception for asking for the contiguous blocks of a cube that does not keep them
+class NoComponentsException
+{};
+
+// Exception for a palette with too few or too many colors, or a palette file that can not be read
+class PaletteException
+{};
@@ -0,0 +1,281 @@
+#include "CubeFile.h"	// Specification file for the Cube File classes
+#include <cstring>		// Gives access to memcmp for the magic
+#include <algorithm>	// Gives access to min
+
+
+// O(1)
+// Purpose: Gets where the cells start for a palette of a size
+// Pre: The amount of palette entries
+// Post: The first multiple of DATA_ALIGNMENT after the header and palette is returned
+static size_t DataOffset(/*IN*/const size_t& paletteAmt)	// The amount of palette entries
+{
+	size_t headerSize = sizeof(CubeHeaderRec) + paletteAmt * PALETTE_NAME_SIZE;	// Bytes before the cells
+
+	return (headerSize + DATA_ALIGNMENT - OFFSET) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+}// end DataOffset
+
+
+
+// O(1)
+// Purpose: Gets the bytes a cell takes in a layout
+// Pre: A known layout
+// Post: 2 is returned for WORD_LAYOUT, 1 for BYTE_LAYOUT
+static size_t CellBytes(/*IN*/const CubeLayoutEnum& layout)	// How the cells are stored
+{
+	return layout == WORD_LAYOUT ? sizeof(uint16_t) : sizeof(uint8_t);
+}// end CellBytes
+
+
+
+// O(N^2)
+// Purpose: Packs the types of a plane into the cells of a layout
+// Pre: amount types, EMPTY_CELL for a cell with no type, room for amount cells of TypeInt
+// Post: cells holds each type as a TypeInt, EmptyType for a cell with no type
+// Exception: CubeFileException is thrown if a type does not fit below EmptyType
+template <class TypeInt>
+static void PackPlane(/*IN*/const int planeTypes[],	// The types of the plane
+					  /*OUT*/TypeInt cells[],		// The cells of the plane
+					  /*IN*/const size_t& amount)	// The amount of cells in the plane
+{
+	for (size_t i = 0; i < amount; i++)
+	{
+		if (planeTypes[i] == EMPTY_CELL)
+			cells[i] = EmptyType<TypeInt>();
+		else if (planeTypes[i] < ZERO || planeTypes[i] >= (int)EmptyType<TypeInt>())
+			throw CubeFileException();
+		else
+			cells[i] = (TypeInt)planeTypes[i];
+	}
+}// end PackPlane
+
+
+
+// O(N^2)
+// Purpose: Unpacks the cells of a layout into the types of a plane
+// Pre: amount cells of TypeInt, room for amount types
+// Post: planeTypes holds the type of each cell, EMPTY_CELL for a cell with no type
+template <class TypeInt>
+static void UnpackPlane(/*IN*/const TypeInt cells[],	// The cells of the plane
+						/*OUT*/int planeTypes[],		// The types of the plane
+						/*IN*/const size_t& amount)		// The amount of cells in the plane
+{
+	for (size_t i = 0; i < amount; i++)
+	{
+		if (cells[i] == EmptyType<TypeInt>())
+			planeTypes[i] = EMPTY_CELL;
+		else
+			planeTypes[i] = cells[i];
+	}
+}// end UnpackPlane
+
+
+// -------------------------------- CubeFileWriterClass ---------------------------------
+
+
+
+// Pre: The name of the file, every dimension is greater than 0 and the name of every type
+// Post: The file holds the header and palette, no planes are written. The layout is
+//       WORD_LAYOUT if the palette has more than BYTE_TYPE_AMT entries, else BYTE_LAYOUT
+// Exception: CubeFileException is thrown if the file can not be created
+CubeFileWriterClass::CubeFileWriterClass(/*IN*/const string& fileName,   // The name of the file
+										 /*IN*/const int& numRows,       // The amount of rows
+										 /*IN*/const int& numCols,       // The amount of columns
+										 /*IN*/const int& numDeps,       // The amount of faces
+										 /*IN*/const vector<string>& palette)   // The name of every type
+{
+	CubeHeaderRec header;	// The fixed part of the header
+	char name[PALETTE_NAME_SIZE];	// A palette name padded with zeros
+
+	rows = numRows;
+	cols = numCols;
+	deps = numDeps;
+	planeAmt = ZERO;
+	layout = palette.size() > (size_t)BYTE_TYPE_AMT ? WORD_LAYOUT : BYTE_LAYOUT;
+	planeBytes.resize((size_t)cols * deps * CellBytes(layout));
+
+	file.open(fileName, ios::binary | ios::trunc);
+	if (!file)
+		throw CubeFileException();
+
+	memcpy(header.magic, CUBE_FILE_MAGIC, MAGIC_SIZE);
+	header.version = CUBE_FILE_VERSION;
+	header.layout = (uint16_t)layout;
+	header.rows = rows;
+	header.cols = cols;
+	header.deps = deps;
+	header.paletteAmt = (uint32_t)palette.size();
+	header.dataOffset = DataOffset(palette.size());
+
+	file.write((const char*)&header, sizeof(header));
+
+	// Write each palette name cut or padded to its fixed size
+	for (size_t i = 0; i < palette.size(); i++)
+	{
+		memset(name, ZERO, PALETTE_NAME_SIZE);
+		memcpy(name, palette[i].c_str(), min(palette[i].size(), (size_t)PALETTE_NAME_SIZE - OFFSET));
+		file.write(name, PALETTE_NAME_SIZE);
+	}
+
+	// Pad with zeros up to the aligned start of the cells
+	vector<char> padding((size_t)header.dataOffset - sizeof(header) - palette.size() * PALETTE_NAME_SIZE, '\0');
+	file.write(padding.data(), padding.size());
+
+	if (!file)
+		throw CubeFileException();
+}// end Constructor
+
+
+
+// Pre: Fewer than rows planes have been written, cols * deps types in storage order,
+//      EMPTY_CELL for a cell with no type
+// Post: The plane is appended to the file
+// Exception: CubeFileException is thrown if every plane is written, a type does not fit
+//            the layout or the write fails
+void CubeFileWriterClass::WritePlane(/*IN*/const int planeTypes[])      // The types of the plane
+{
+	if (planeAmt >= rows)
+		throw CubeFileException();
+
+	// Pack each type into the cell of the layout
+	if (layout == WORD_LAYOUT)
+		PackPlane(planeTypes, (uint16_t*)planeBytes.data(), (size_t)cols * deps);
+	else
+		PackPlane(planeTypes, (uint8_t*)planeBytes.data(), (size_t)cols * deps);
+
+	file.write((const char*)planeBytes.data(), planeBytes.size());
+
+	if (!file)
+		throw CubeFileException();
+
+	planeAmt++;
+}// end WritePlane
+
+
+
+// Pre: Every plane has been written
+// Post: The file is flushed and closed
+// Exception: CubeFileException is thrown if a plane is missing or the flush fails
+void CubeFileWriterClass::Close()
+{
+	file.close();
+
+	if (planeAmt != rows || !file)
+		throw CubeFileException();
+}// end Close
+
+
+
+// -------------------------------- CubeFileReaderClass ---------------------------------
+
+
+
+// Pre: The name of a cube file
+// Post: The dimensions and palette are read, the next plane is x = 0
+// Exception: CubeFileException is thrown if the file can not be opened, is not a cube file,
+//            or is of an unknown version or layout
+CubeFileReaderClass::CubeFileReaderClass(/*IN*/const string& fileName)  // The name of the file
+{
+	CubeHeaderRec header;	// The fixed part of the header
+	char name[PALETTE_NAME_SIZE];	// A palette name padded with zeros
+
+	file.open(fileName, ios::binary);
+	if (!file)
+		throw CubeFileException();
+
+	file.read((char*)&header, sizeof(header));
+
+	if (!file || memcmp(header.magic, CUBE_FILE_MAGIC, MAGIC_SIZE) != ZERO ||
+		header.version < OFFSET || header.version > CUBE_FILE_VERSION ||
+		(header.layout != BYTE_LAYOUT && header.layout != WORD_LAYOUT) ||
+		header.rows < OFFSET || header.cols < OFFSET || header.deps < OFFSET ||
+		header.dataOffset < DataOffset(header.paletteAmt))
+		throw CubeFileException();
+
+	// Read each palette name, the zeros padding it are dropped
+	for (uint32_t i = 0; i < header.paletteAmt; i++)
+	{
+		file.read(name, PALETTE_NAME_SIZE);
+		name[PALETTE_NAME_SIZE - OFFSET] = '\0';
+		palette.push_back(name);
+	}
+
+	file.seekg((streamoff)header.dataOffset);
+
+	if (!file)
+		throw CubeFileException();
+
+	rows = header.rows;
+	cols = header.cols;
+	deps = header.deps;
+	dataOffset = (size_t)header.dataOffset;
+	planeAmt = ZERO;
+	layout = (CubeLayoutEnum)header.layout;
+	planeBytes.resize((size_t)cols * deps * CellBytes(layout));
+}// end Constructor
+
+
+
+int CubeFileReaderClass::GetRows() const
+{
+	return rows;
+}// end GetRows
+
+
+
+int CubeFileReaderClass::GetCols() const
+{
+	return cols;
+}// end GetCols
+
+
+
+int CubeFileReaderClass::GetDeps() const
+{
+	return deps;
+}// end GetDeps
+
+
+
+const vector<string>& CubeFileReaderClass::GetPalette() const
+{
+	return palette;
+}// end GetPalette
+
+
+
+size_t CubeFileReaderClass::GetDataOffset() const
+{
+	return dataOffset;
+}// end GetDataOffset
+
+
+
+CubeLayoutEnum CubeFileReaderClass::GetLayout() const
+{
+	return layout;
+}// end GetLayout
+
+
+
+// Pre: Fewer than rows planes have been read, room for cols * deps types
+// Post: planeTypes holds the types of the plane in storage order, EMPTY_CELL for a
+//       cell with no type
+// Exception: CubeFileException is thrown if every plane is read or the read fails
+void CubeFileReaderClass::ReadPlane(/*OUT*/int planeTypes[])            // The types of the plane
+{
+	if (planeAmt >= rows)
+		throw CubeFileException();
+
+	file.read((char*)planeBytes.data(), planeBytes.size());
+
+	if (!file)
+		throw CubeFileException();
+
+	// Unpack the cell of the layout into each type
+	if (layout == WORD_LAYOUT)
+		UnpackPlane((const uint16_t*)planeBytes.data(), planeTypes, (size_t)cols * deps);
+	else
+		UnpackPlane((const uint8_t*)planeBytes.data(), planeTypes, (size_t)cols * deps);
+
+	planeAmt++;
+}// end ReadPlane
@@ -0,0 +1,328 @@
+#pragma once
+/*
+    FileName : CubeFile.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for the Cube File Reader and Writer Classes. A cube
+        file holds a cube on disk so it can be saved and loaded again, worked on one x
+        plane at a time without ever holding the whole cube in memory, or mapped into
+        a CubeClass without being read at all.
+
+        The file is laid out as a CubeHeaderRec followed by the palette and the cells:
+            "CUBE"                      - 4 byte magic
+            version                     - 16 bit, CUBE_FILE_VERSION
+            layout                      - 16 bit CubeLayoutEnum, how the cells are stored
+            rows, cols, deps            - 32 bit integers
+            paletteAmt                  - 32 bit, the amount of palette entries
+            dataOffset                  - 64 bit, where the cells start
+            palette                     - PALETTE_NAME_SIZE bytes per entry, the name of each
+                                          type padded with zeros, entry i names type i
+            padding                     - zeros up to dataOffset, a multiple of DATA_ALIGNMENT
+            cells                       - BYTE_LAYOUT: one byte per cell in storage order
+                                          (x, y, z), the integer index of the CellType or EMPTY_BYTE
+                                          WORD_LAYOUT: 16 bits per cell in storage order, the
+                                          integer index of the CellType or EMPTY_WORD
+
+        A file is written in BYTE_LAYOUT unless its palette has more than BYTE_TYPE_AMT
+        entries, so a cube of a large palette takes 2 bytes per cell and any other 1.
+
+        A plane is every cell with the same x, cols * deps cells stored one after another.
+        The cells start on a DATA_ALIGNMENT boundary so they can be mapped and used in place.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Every CellType is an entry of the palette, or below EMPTY_BYTE when no palette
+            is given
+        2 - The file is written and read on machines with the same byte order
+        3 - Planes are written and read in order, starting with x = 0
+        4 - A palette name is shorter than PALETTE_NAME_SIZE, longer names are cut
+        5 - A file of a newer version or an unknown layout is rejected, not guessed at
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - CubeFileException thrown when a file can not be opened, read or written, when it
+            does not start with the magic, is of an unknown version or layout, or when its
+            dimensions are less than 1. Writing a type that does not fit the layout throws
+
+                           SUMMARY OF METHODS:
+    CubeFileWriterClass
+        CubeFileWriterClass(*IN*const string& fileName,
+                            *IN*const int& numRows,
+                            *IN*const int& numCols,
+                            *IN*const int& numDeps,
+                            *IN*const vector<string>& palette) - Creates a cube file and writes its header
+        void WritePlane(*IN*const int planeTypes[]) - Writes the next plane of the cube
+        void Close() - Finishes the file
+
+    CubeFileReaderClass
+        CubeFileReaderClass(*IN*const string& fileName) - Opens a cube file and reads its header
+        int GetRows() const - Gets the amount of rows in the cube
+        int GetCols() const - Gets the amount of columns in the cube
+        int GetDeps() const - Gets the amount of faces in the cube
+        const vector<string>& GetPalette() const - Gets the name of every type
+        size_t GetDataOffset() const - Gets where the cells start in the file
+        CubeLayoutEnum GetLayout() const - Gets how the cells of the file are stored
+        void ReadPlane(*OUT*int planeTypes[]) - Reads the next plane of the cube
+
+    FUNCTIONS
+        void SaveCube<Cube>(*IN*const Cube& colCube,
+                            *IN*const string& fileName,
+                      *IN*const vector<string>& palette) - Writes a cube to a cube file
+        void LoadCube<Cube>(*IN/OUT*Cube& colCube,
+                            *IN*const string& fileName) - Reads a cube file into a cube of any storage
+
+    PRIVATE MEMBERS:
+        ofstream / ifstream file;           // The cube file
+        int rows;                           // The amount of rows in the cube
+        int cols;                           // The amount of columns in the cube
+        int deps;                           // The amount of faces in the cube
+        int planeAmt;                       // The amount of planes written or read so far
+        CubeLayoutEnum layout;              // How the cells of the file are stored
+        vector<unsigned char> planeBytes;   // The bytes of the current plane
+        vector<string> palette;             // The name of every type, reader only
+        size_t dataOffset;                  // Where the cells start in the file, reader only
+*/
+
+#include <fstream>      // Gives access to the file streams
+#include <vector>       // Gives access to the vector holding a plane
+#include <cstdint>      // Gives access to the fixed width header fields
+#include <string>       // Gives access to the palette names
+#include "Cube.h"       // Grants Access to Cube Class
+
+using namespace std;
+
+
+const char CUBE_FILE_MAGIC[] = "CUBE";      // The first bytes of every cube file
+const int MAGIC_SIZE = 4;                   // The amount of bytes in the magic
+const uint16_t CUBE_FILE_VERSION = 1;       // The version written, older versions are still read
+const int PALETTE_NAME_SIZE = 8;            // The bytes stored for the name of each type
+const int DATA_ALIGNMENT = 64;              // The cells start on a multiple of this many bytes
+
+
+// Enumerated type for how the cells of a cube file are stored
+enum CubeLayoutEnum { BYTE_LAYOUT, WORD_LAYOUT };
+
+
+// The fixed part of the header at the start of every cube file
+struct CubeHeaderRec
+{
+    char magic[MAGIC_SIZE];     // CUBE_FILE_MAGIC
+    uint16_t version;           // The version the file was written with
+    uint16_t layout;            // The CubeLayoutEnum the cells are stored in
+    int32_t rows;               // The amount of rows in the cube
+    int32_t cols;               // The amount of columns in the cube
+    int32_t deps;               // The amount of faces in the cube
+    uint32_t paletteAmt;        // The amount of palette entries after the header
+    uint64_t dataOffset;        // Where the cells start in the file
+};
+
+
+
+class CubeFileWriterClass
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Creates a cube file and writes its header
+    // Pre: The name of the file, every dimension is greater than 0 and the name of every type
+    // Post: The file holds the header and palette, no planes are written. The layout is
+    //       WORD_LAYOUT if the palette has more than BYTE_TYPE_AMT entries, else BYTE_LAYOUT
+    // Exception: CubeFileException is thrown if the file can not be created
+    CubeFileWriterClass(/*IN*/const string& fileName,   // The name of the file
+                        /*IN*/const int& numRows,       // The amount of rows
+                        /*IN*/const int& numCols,       // The amount of columns
+                        /*IN*/const int& numDeps,       // The amount of faces
+                        /*IN*/const vector<string>& palette = vector<string>());   // The name of every type
+
+
+    // O(N^2) : Mutator
+    // Purpose: Writes the next plane of the cube
+    // Pre: Fewer than rows planes have been written, cols * deps types in storage order,
+    //      EMPTY_CELL for a cell with no type
+    // Post: The plane is appended to the file
+    // Exception: CubeFileException is thrown if every plane is written, a type does not fit
+    //            the layout or the write fails
+    void WritePlane(/*IN*/const int planeTypes[]);      // The types of the plane
+
+
+    // O(1) : Mutator
+    // Purpose: Finishes the file
+    // Pre: Every plane has been written
+    // Post: The file is flushed and closed
+    // Exception: CubeFileException is thrown if a plane is missing or the flush fails
+    void Close();
+
+
+private:
+
+    // PDMs
+    ofstream file;                      // The cube file
+    int rows;                           // The amount of rows in the cube
+    int cols;                           // The amount of columns in the cube
+    int deps;                           // The amount of faces in the cube
+    int planeAmt;                       // The amount of planes written so far
+    CubeLayoutEnum layout;              // How the cells of the file are stored
+    vector<unsigned char> planeBytes;   // The bytes of the current plane
+
+}; // end CubeFileWriterClass
+
+
+
+class CubeFileReaderClass
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Opens a cube file and reads its header
+    // Pre: The name of a cube file
+    // Post: The dimensions and palette are read, the next plane is x = 0
+    // Exception: CubeFileException is thrown if the file can not be opened, is not a cube file,
+    //            or is of an unknown version or layout
+    CubeFileReaderClass(/*IN*/const string& fileName);  // The name of the file
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the dimensions of the cube
+    // Pre: None
+    // Post: The amount of rows, columns or faces is returned
+    int GetRows() const;
+    int GetCols() const;
+    int GetDeps() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the name of every type
+    // Pre: None
+    // Post: The palette is returned, entry i names type i
+    const vector<string>& GetPalette() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets where the cells start in the file
+    // Pre: None
+    // Post: The offset of the first cell byte is returned
+    size_t GetDataOffset() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets how the cells of the file are stored
+    // Pre: None
+    // Post: The layout of the file is returned
+    CubeLayoutEnum GetLayout() const;
+
+
+    // O(N^2) : Mutator
+    // Purpose: Reads the next plane of the cube
+    // Pre: Fewer than rows planes have been read, room for cols * deps types
+    // Post: planeTypes holds the types of the plane in storage order, EMPTY_CELL for a
+    //       cell with no type
+    // Exception: CubeFileException is thrown if every plane is read or the read fails
+    void ReadPlane(/*OUT*/int planeTypes[]);            // The types of the plane
+
+
+private:
+
+    // PDMs
+    ifstream file;                      // The cube file
+    int rows;                           // The amount of rows in the cube
+    int cols;                           // The amount of columns in the cube
+    int deps;                           // The amount of faces in the cube
+    int planeAmt;                       // The amount of planes read so far
+    CubeLayoutEnum layout;              // How the cells of the file are stored
+    vector<unsigned char> planeBytes;   // The bytes of the current plane
+    vector<string> palette;             // The name of every type
+    size_t dataOffset;                  // Where the cells start in the file
+
+}; // end CubeFileReaderClass
+
+
+
+// O(N^3)
+// Purpose: Writes a cube to a cube file
+// Pre: The cube, of either form, the name of the file and the name of every type
+// Post: The file holds every cell of the cube, it can be loaded with CubeClass(fileName)
+// Exception: CubeFileException is thrown if the file can not be written
+template <class Cube>
+void SaveCube(/*IN*/const Cube& colCube,           // The cube being saved
+              /*IN*/const string& fileName,        // The name of the file
+              /*IN*/const vector<string>& palette = vector<string>());  // The name of every type
+
+
+
+// O(N^3)
+// Purpose: Reads a cube file into a cube of any storage, instead of mapping it
+// Pre: The cube, of either form, has the dimensions of the file, the name of the file
+// Post: Every cell of the file with a type holds it in the cube, the other cells are unchanged
+// Exception: CubeFileException is thrown if the file can not be read or its dimensions
+//            are not the cube's
+template <class Cube>
+void LoadCube(/*IN/OUT*/Cube& colCube,             // The cube being loaded
+              /*IN*/const string& fileName);       // The name of the file
+
+
+
+// Pre: The cube, of either form, the name of the file and the name of every type
+// Post: The file holds every cell of the cube, it can be loaded with CubeClass(fileName)
+// Exception: CubeFileException is thrown if the file can not be written
+template <class Cube>
+void SaveCube(/*IN*/const Cube& colCube,           // The cube being saved
+              /*IN*/const string& fileName,        // The name of the file
+              /*IN*/const vector<string>& palette) // The name of every type
+{
+    CubeFileWriterClass writer(fileName, colCube.GetRows(), colCube.GetCols(), colCube.GetDeps(), palette);
+    vector<int> planeTypes((size_t)colCube.GetCols() * colCube.GetDeps());    // The types of a plane
+
+    // Write the cube a plane at a time
+    for (int i = 0; i < colCube.GetRows(); i++)
+    {
+        for (int j = 0; j < colCube.GetCols(); j++)
+            colCube.GetRowTypes(i, j, &planeTypes[(size_t)j * colCube.GetDeps()]);
+
+        writer.WritePlane(planeTypes.data());
+    }
+
+    writer.Close();
+}// end SaveCube
+
+
+
+// Pre: The cube, of either form, has the dimensions of the file, the name of the file
+// Post: Every cell of the file with a type holds it in the cube, the other cells are unchanged
+// Exception: CubeFileException is thrown if the file can not be read or its dimensions
+//            are not the cube's
+template <class Cube>
+void LoadCube(/*IN/OUT*/Cube& colCube,             // The cube being loaded
+              /*IN*/const string& fileName)        // The name of the file
+{
+    CubeFileReaderClass reader(fileName);   // Reads the cube file
+    vector<int> planeTypes((size_t)colCube.GetCols() * colCube.GetDeps());    // The types of a plane
+    size_t planeStart;  // The linear index of the first cell of the plane
+    size_t runStart;    // The first cell of the current run of cells with a type
+
+    if (reader.GetRows() != colCube.GetRows() || reader.GetCols() != colCube.GetCols()
+        || reader.GetDeps() != colCube.GetDeps())
+        throw CubeFileException();
+
+    // Read the cube a plane at a time, setting each run of cells that have a type
+    for (int i = 0; i < colCube.GetRows(); i++)
+    {
+        reader.ReadPlane(planeTypes.data());
+        planeStart = (size_t)i * planeTypes.size();
+
+        for (size_t cell = 0; cell < planeTypes.size(); )
+        {
+            if (planeTypes[cell] == EMPTY_CELL)
+            {
+                cell++;
+                continue;
+            }
+
+            runStart = cell;
+            while (cell < planeTypes.size() && planeTypes[cell] != EMPTY_CELL)
+                cell++;
+
+            colCube.SetCellTypes(planeStart + runStart, cell - runStart, &planeTypes[runStart]);
+        }
+    }
+}// end LoadCube
@@ -0,0 +1,1637 @@
+#include "CubeStorage.h"	// Specification file for the Cube storage classes
+#include <algorithm>	// Gives access to the smaller of two faces
+
+
+const int WORD_BITS = 64;	// The amount of cells tracked by a single bitset word
+const int WORD_SHIFT = 6;	// Shifting a cell index by this gives its bitset word
+const uint64_t WORD_MASK = 63;	// Masking a cell index by this gives its bit within a word
+
+
+
+// O(1)
+// Purpose: Counts the bits that are set in a bitset word
+// Pre: The word being counted
+// Post: The amount of set bits is returned
+static int CountBits(/*IN*/uint64_t word)	// The word being counted
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(word);
+#else
+	// Add the bits in pairs, then nibbles, then bytes
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+}// end CountBits
+
+
+
+// ---------------------------------- CubeStorage ---------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0
+// Post: rows, cols and deps hold the dimensions of the cube, the generation is FIRST_STAMP
+CubeStorage::CubeStorage(/*IN*/const int& numRows,      // The amount of rows
+						 /*IN*/const int& numCols,      // The amount of columns
+						 /*IN*/const int& numDeps)      // The amount of faces
+{
+	rows = numRows;
+	cols = numCols;
+	deps = numDeps;
+	generation = FIRST_STAMP;
+}// end Constructor
+
+
+
+CubeStorage::~CubeStorage()
+{
+}// end Destructor
+
+
+
+// Pre: No other thread is using the storage
+// Post: No cell is checked, the types are unchanged
+void CubeStorage::ClearStatus()
+{
+	// Every stamp is of an earlier generation, once the stamps wrap they are reset so none
+	// is taken for the generation started again
+	if (++generation == NO_STAMP)
+	{
+		ResetStamps();
+		generation = FIRST_STAMP;
+	}
+}// end ClearStatus
+
+
+
+// Pre: No other thread is using the storage
+// Post: Every cell holds what it held, a storage that can not collapse is unchanged
+void CubeStorage::Compact()
+{
+}// end Compact
+
+
+
+// Pre: The row is within the cube
+// Post: Return false if no cell of the row has a type. A storage that does not keep
+//       track of where its types are returns true
+bool CubeStorage::RowHasTypes(/*IN*/const int& /*x*/, /*IN*/const int& /*y*/) const
+{
+	return true;
+}// end RowHasTypes
+
+
+
+// Pre: The cell is within the cube
+// Post: The integer index of the type of every cell of the chunk within the cube is
+//       returned, EMPTY_CELL if they differ or have no type. A storage that keeps no
+//       chunks returns EMPTY_CELL
+int CubeStorage::GetChunkType(/*IN*/const int& /*x*/, /*IN*/const int& /*y*/, /*IN*/const int& /*z*/) const
+{
+	return EMPTY_CELL;
+}// end GetChunkType
+
+
+
+// --------------------------------- RecordStorage --------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the value every cell starts with
+// Post: Every cell holds initCell
+RecordStorage::RecordStorage(/*IN*/const int& numRows,        // The amount of rows
+							 /*IN*/const int& numCols,        // The amount of columns
+							 /*IN*/const int& numDeps,        // The amount of faces
+							 /*IN*/const CellRec& initCell)   // The value every cell starts with
+	: CubeStorage(numRows, numCols, numDeps)
+{
+	// Allocate every cell in a single buffer
+	cubeArr.assign((size_t)rows * (size_t)cols * (size_t)deps, initCell);
+}// end Constructor
+
+
+
+bool RecordStorage::GetStatus(/*IN*/const LocationRec& cell) const
+{
+	return cubeArr[CellIndex(cell)].status == generation;
+}// end GetStatus
+
+
+
+bool RecordStorage::SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat)
+{
+	CellRec& currCell = cubeArr[CellIndex(cell)];	// The cell being set
+	bool changed = (currCell.status == generation) != stat;	// True if the status of the cell changes
+
+	currCell.status = stat ? generation : NO_STAMP;
+	return changed;
+}// end SetStatus
+
+
+
+bool RecordStorage::GetPopulated(/*IN*/const LocationRec& cell) const
+{
+	return cubeArr[CellIndex(cell)].populated;
+}// end GetPopulated
+
+
+
+CellType RecordStorage::GetType(/*IN*/const LocationRec& cell) const
+{
+	return cubeArr[CellIndex(cell)].type;
+}// end GetType
+
+
+
+void RecordStorage::SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType)
+{
+	// Set the cell to the new CellType and update the cell to have a CellType
+	cubeArr[CellIndex(cell)].type = currType;
+	cubeArr[CellIndex(cell)].populated = true;
+}// end SetType
+
+
+
+void RecordStorage::GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const
+{
+	LocationRec rowStart;	// The first cell of the row
+
+	rowStart.x = x;
+	rowStart.y = y;
+	rowStart.z = ZERO;
+
+	const CellRec* row = &cubeArr[CellIndex(rowStart)];	// The cells of the row
+
+	// Copy the type of each cell along the depth
+	for (int k = 0; k < deps; k++)
+	{
+		if (row[k].populated)
+			rowTypes[k] = (int)row[k].type;
+		else
+			rowTypes[k] = EMPTY_CELL;
+	}
+}// end GetRowTypes
+
+
+
+size_t RecordStorage::SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[])
+{
+	size_t newAmt = ZERO;	// The amount of cells populated by the range
+
+	for (size_t i = 0; i < amount; i++)
+	{
+		if (!cubeArr[first + i].populated)
+			newAmt++;
+
+		cubeArr[first + i].type = (CellType)cellTypes[i];
+		cubeArr[first + i].populated = true;
+	}
+
+	return newAmt;
+}// end SetCellTypes
+
+
+
+size_t RecordStorage::CountChecked() const
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+
+	for (size_t i = 0; i < cubeArr.size(); i++)
+		if (cubeArr[i].status == generation)
+			checkedAmt++;
+
+	return checkedAmt;
+}// end CountChecked
+
+
+
+size_t RecordStorage::CountPopulated() const
+{
+	size_t popAmt = ZERO;	// The amount of populated cells
+
+	for (size_t i = 0; i < cubeArr.size(); i++)
+		if (cubeArr[i].populated)
+			popAmt++;
+
+	return popAmt;
+}// end CountPopulated
+
+
+
+CubeStorage* RecordStorage::Clone() const
+{
+	return new RecordStorage(*this);
+}// end Clone
+
+
+
+void RecordStorage::ResetStamps()
+{
+	for (size_t i = 0; i < cubeArr.size(); i++)
+		cubeArr[i].status = NO_STAMP;
+}// end ResetStamps
+
+
+
+// --------------------------------- PackedStorage --------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the value every cell starts with
+// Post: Every cell holds initCell
+template <class TypeInt>
+PackedStorage<TypeInt>::PackedStorage(/*IN*/const int& numRows,        // The amount of rows
+									  /*IN*/const int& numCols,        // The amount of columns
+									  /*IN*/const int& numDeps,        // The amount of faces
+									  /*IN*/const CellRec& initCell)   // The value every cell starts with
+	: CubeStorage(numRows, numCols, numDeps)
+{
+	size_t cellAmt = (size_t)rows * (size_t)cols * (size_t)deps;	// The amount of cells
+	size_t wordAmt = (cellAmt + WORD_MASK) >> WORD_SHIFT;			// The amount of bitset words
+	uint64_t lastMask;	// The bits of the last word that belong to a cell
+
+	typePlane.assign(cellAmt, (TypeInt)initCell.type);
+	statusBits.assign(wordAmt, initCell.status != NO_STAMP ? ~(uint64_t)ZERO : (uint64_t)ZERO);
+	wordStamps.assign(wordAmt, generation);
+	popBits.assign(wordAmt, initCell.populated ? ~(uint64_t)ZERO : (uint64_t)ZERO);
+
+	// Bits past the last cell are kept clear so whole words can be counted
+	if (cellAmt & WORD_MASK)
+	{
+		lastMask = ((uint64_t)OFFSET << (cellAmt & WORD_MASK)) - OFFSET;
+		statusBits.back() &= lastMask;
+		popBits.back() &= lastMask;
+	}
+}// end Constructor
+
+
+
+template <class TypeInt>
+bool PackedStorage<TypeInt>::GetStatus(/*IN*/const LocationRec& cell) const
+{
+	size_t index = CellIndex(cell);			// The linear index of the cell
+	size_t word = index >> WORD_SHIFT;		// The status word of the cell
+
+	// A word of an earlier generation holds no checked cell
+	return wordStamps[word] == generation && ((statusBits[word] >> (index & WORD_MASK)) & OFFSET);
+}// end GetStatus
+
+
+
+template <class TypeInt>
+bool PackedStorage<TypeInt>::SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat)
+{
+	size_t index = CellIndex(cell);			// The linear index of the cell
+	size_t word = index >> WORD_SHIFT;		// The status word of the cell
+	uint64_t bit = (uint64_t)OFFSET << (index & WORD_MASK);	// The bit of the cell
+	bool changed;	// True if the status of the cell changes
+
+	// A word of an earlier generation is cleared before its first status of this one is set
+	if (wordStamps[word] != generation)
+	{
+		statusBits[word] = ZERO;
+		wordStamps[word] = generation;
+	}
+
+	changed = ((statusBits[word] & bit) != ZERO) != stat;
+
+	if (stat)
+		statusBits[word] |= bit;
+	else
+		statusBits[word] &= ~bit;
+
+	return changed;
+}// end SetStatus
+
+
+
+template <class TypeInt>
+bool PackedStorage<TypeInt>::GetPopulated(/*IN*/const LocationRec& cell) const
+{
+	size_t index = CellIndex(cell);	// The linear index of the cell
+
+	return (popBits[index >> WORD_SHIFT] >> (index & WORD_MASK)) & OFFSET;
+}// end GetPopulated
+
+
+
+template <class TypeInt>
+CellType PackedStorage<TypeInt>::GetType(/*IN*/const LocationRec& cell) const
+{
+	return (CellType)typePlane[CellIndex(cell)];
+}// end GetType
+
+
+
+template <class TypeInt>
+void PackedStorage<TypeInt>::SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType)
+{
+	size_t index = CellIndex(cell);	// The linear index of the cell
+
+	// Set the cell to the new CellType and update the cell to have a CellType
+	typePlane[index] = (TypeInt)currType;
+	popBits[index >> WORD_SHIFT] |= (uint64_t)OFFSET << (index & WORD_MASK);
+}// end SetType
+
+
+
+template <class TypeInt>
+void PackedStorage<TypeInt>::GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const
+{
+	LocationRec rowStart;	// The first cell of the row
+
+	rowStart.x = x;
+	rowStart.y = y;
+	rowStart.z = ZERO;
+
+	size_t index = CellIndex(rowStart);				// The linear index of the first cell
+	const TypeInt* row = &typePlane[index];			// The types of the row
+
+	// Copy the type of each cell along the depth
+	for (int k = 0; k < deps; k++, index++)
+	{
+		if ((popBits[index >> WORD_SHIFT] >> (index & WORD_MASK)) & OFFSET)
+			rowTypes[k] = (int)row[k];
+		else
+			rowTypes[k] = EMPTY_CELL;
+	}
+}// end GetRowTypes
+
+
+
+template <class TypeInt>
+size_t PackedStorage<TypeInt>::SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[])
+{
+	size_t index = first;	// The linear index of the current cell
+	size_t newAmt = ZERO;	// The amount of cells populated by the range
+	uint64_t bit;			// The populated bit of the current cell
+
+	// The range only shares a bitset word with another range if it does not start on a word
+	for (size_t i = 0; i < amount; i++, index++)
+	{
+		bit = (uint64_t)OFFSET << (index & WORD_MASK);
+
+		if (!(popBits[index >> WORD_SHIFT] & bit))
+			newAmt++;
+
+		typePlane[index] = (TypeInt)cellTypes[i];
+		popBits[index >> WORD_SHIFT] |= bit;
+	}
+
+	return newAmt;
+}// end SetCellTypes
+
+
+
+template <class TypeInt>
+size_t PackedStorage<TypeInt>::CountChecked() const
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+
+	// Count 64 cells at a time, a word of an earlier generation holds none
+	for (size_t i = 0; i < statusBits.size(); i++)
+		if (wordStamps[i] == generation)
+			checkedAmt += CountBits(statusBits[i]);
+
+	return checkedAmt;
+}// end CountChecked
+
+
+
+template <class TypeInt>
+size_t PackedStorage<TypeInt>::CountPopulated() const
+{
+	size_t popAmt = ZERO;	// The amount of populated cells
+
+	// Count 64 cells at a time
+	for (size_t i = 0; i < popBits.size(); i++)
+		popAmt += CountBits(popBits[i]);
+
+	return popAmt;
+}// end CountPopulated
+
+
+
+template <class TypeInt>
+CubeStorage* PackedStorage<TypeInt>::Clone() const
+{
+	return new PackedStorage(*this);
+}// end Clone
+
+
+
+template <class TypeInt>
+void PackedStorage<TypeInt>::ResetStamps()
+{
+	fill(wordStamps.begin(), wordStamps.end(), NO_STAMP);
+}// end ResetStamps
+
+
+
+// --------------------------------- MappedStorage --------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the name of the file and where its
+//      rows * cols * deps cells of a TypeInt each start, a multiple of sizeof(TypeInt)
+// Post: Every cell holds the type in the file and is unchecked
+// Exception: CubeFileException is thrown if the file can not be mapped or is too short
+template <class TypeInt>
+MappedStorage<TypeInt>::MappedStorage(/*IN*/const int& numRows,        // The amount of rows
+									  /*IN*/const int& numCols,        // The amount of columns
+									  /*IN*/const int& numDeps,        // The amount of faces
+									  /*IN*/const string& fileName,    // The cube file
+									  /*IN*/const size_t& dataOffset)  // Where the cells start in the file
+	: CubeStorage(numRows, numCols, numDeps), mapping(new MappedFileClass(fileName))
+{
+	size_t cellAmt = (size_t)rows * (size_t)cols * (size_t)deps;	// The amount of cells
+
+	// Every cell must be within the file
+	if (dataOffset > mapping->GetSize() || (mapping->GetSize() - dataOffset) / sizeof(TypeInt) < cellAmt)
+		throw CubeFileException();
+
+	// The types are used where they are mapped, no cell is read here
+	typePlane = (TypeInt*)(mapping->GetData() + dataOffset);
+	statusBits.assign((cellAmt + WORD_MASK) >> WORD_SHIFT, (uint64_t)ZERO);
+	wordStamps.assign(statusBits.size(), generation);
+}// end Constructor
+
+
+
+// Pre: orig holds the cells to be copied
+// Post: The types are copied into memory, the copy does not map the file
+template <class TypeInt>
+MappedStorage<TypeInt>::MappedStorage(/*IN*/const MappedStorage& orig)    // The storage being copied
+	: CubeStorage(orig), statusBits(orig.statusBits), wordStamps(orig.wordStamps)
+{
+	copiedTypes.assign(orig.typePlane, orig.typePlane + (size_t)rows * (size_t)cols * (size_t)deps);
+	typePlane = copiedTypes.data();
+}// end Copy Constructor
+
+
+
+template <class TypeInt>
+bool MappedStorage<TypeInt>::GetStatus(/*IN*/const LocationRec& cell) const
+{
+	size_t index = CellIndex(cell);			// The linear index of the cell
+	size_t word = index >> WORD_SHIFT;		// The status word of the cell
+
+	// A word of an earlier generation holds no checked cell
+	return wordStamps[word] == generation && ((statusBits[word] >> (index & WORD_MASK)) & OFFSET);
+}// end GetStatus
+
+
+
+template <class TypeInt>
+bool MappedStorage<TypeInt>::SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat)
+{
+	size_t index = CellIndex(cell);			// The linear index of the cell
+	size_t word = index >> WORD_SHIFT;		// The status word of the cell
+	uint64_t bit = (uint64_t)OFFSET << (index & WORD_MASK);	// The bit of the cell
+	bool changed;	// True if the status of the cell changes
+
+	// A word of an earlier generation is cleared before its first status of this one is set
+	if (wordStamps[word] != generation)
+	{
+		statusBits[word] = ZERO;
+		wordStamps[word] = generation;
+	}
+
+	changed = ((statusBits[word] & bit) != ZERO) != stat;
+
+	if (stat)
+		statusBits[word] |= bit;
+	else
+		statusBits[word] &= ~bit;
+
+	return changed;
+}// end SetStatus
+
+
+
+template <class TypeInt>
+bool MappedStorage<TypeInt>::GetPopulated(/*IN*/const LocationRec& cell) const
+{
+	return typePlane[CellIndex(cell)] != EmptyType<TypeInt>();
+}// end GetPopulated
+
+
+
+template <class TypeInt>
+CellType MappedStorage<TypeInt>::GetType(/*IN*/const LocationRec& cell) const
+{
+	return (CellType)typePlane[CellIndex(cell)];
+}// end GetType
+
+
+
+template <class TypeInt>
+void MappedStorage<TypeInt>::SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType)
+{
+	// Only the page in memory is changed, the mapping is copy on write
+	typePlane[CellIndex(cell)] = (TypeInt)currType;
+}// end SetType
+
+
+
+template <class TypeInt>
+void MappedStorage<TypeInt>::GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const
+{
+	LocationRec rowStart;	// The first cell of the row
+
+	rowStart.x = x;
+	rowStart.y = y;
+	rowStart.z = ZERO;
+
+	const TypeInt* row = typePlane + CellIndex(rowStart);	// The types of the row
+
+	// Copy the type of each cell along the depth
+	for (int k = 0; k < deps; k++)
+	{
+		if (row[k] != EmptyType<TypeInt>())
+			rowTypes[k] = (int)row[k];
+		else
+			rowTypes[k] = EMPTY_CELL;
+	}
+}// end GetRowTypes
+
+
+
+template <class TypeInt>
+size_t MappedStorage<TypeInt>::SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[])
+{
+	size_t newAmt = ZERO;	// The amount of cells populated by the range
+
+	// Only the pages in memory are changed, the mapping is copy on write
+	for (size_t i = 0; i < amount; i++)
+	{
+		if (typePlane[first + i] == EmptyType<TypeInt>())
+			newAmt++;
+
+		typePlane[first + i] = (TypeInt)cellTypes[i];
+	}
+
+	return newAmt;
+}// end SetCellTypes
+
+
+
+template <class TypeInt>
+size_t MappedStorage<TypeInt>::CountChecked() const
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+
+	// Count 64 cells at a time, a word of an earlier generation holds none
+	for (size_t i = 0; i < statusBits.size(); i++)
+		if (wordStamps[i] == generation)
+			checkedAmt += CountBits(statusBits[i]);
+
+	return checkedAmt;
+}// end CountChecked
+
+
+
+template <class TypeInt>
+size_t MappedStorage<TypeInt>::CountPopulated() const
+{
+	size_t cellAmt = (size_t)rows * (size_t)cols * (size_t)deps;	// The amount of cells
+	size_t popAmt = ZERO;	// The amount of populated cells
+
+	for (size_t i = 0; i < cellAmt; i++)
+		if (typePlane[i] != EmptyType<TypeInt>())
+			popAmt++;
+
+	return popAmt;
+}// end CountPopulated
+
+
+
+template <class TypeInt>
+CubeStorage* MappedStorage<TypeInt>::Clone() const
+{
+	return new MappedStorage(*this);
+}// end Clone
+
+
+
+template <class TypeInt>
+void MappedStorage<TypeInt>::ResetStamps()
+{
+	fill(wordStamps.begin(), wordStamps.end(), NO_STAMP);
+}// end ResetStamps
+
+
+
+// --------------------------------- TiledStorage ---------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the value every cell starts with
+// Post: Every cell holds initCell, the cells past the cube are unchecked and unpopulated
+TiledStorage::TiledStorage(/*IN*/const int& numRows,         // The amount of rows
+						   /*IN*/const int& numCols,         // The amount of columns
+						   /*IN*/const int& numDeps,         // The amount of faces
+						   /*IN*/const CellRec& initCell)    // The value every cell starts with
+	: CubeStorage(numRows, numCols, numDeps)
+{
+	size_t brickRows = (size_t)(rows + BRICK_MASK) >> BRICK_SHIFT;	// The amount of bricks along the rows
+	CellRec padCell = initCell;	// The value of every cell past the cube
+
+	brickCols = (size_t)(cols + BRICK_MASK) >> BRICK_SHIFT;
+	brickDeps = (size_t)(deps + BRICK_MASK) >> BRICK_SHIFT;
+
+	// A cube whose dimensions fill its bricks has no cells past it
+	if (((rows | cols | deps) & BRICK_MASK) == ZERO)
+	{
+		cubeArr.assign((brickRows * brickCols * brickDeps) << BRICK_CELL_SHIFT, initCell);
+		return;
+	}
+
+	padCell.status = NO_STAMP;
+	padCell.populated = false;
+	cubeArr.assign((brickRows * brickCols * brickDeps) << BRICK_CELL_SHIFT, padCell);
+
+	for (int i = 0; i < rows; i++)
+		for (int j = 0; j < cols; j++)
+			for (int k = 0; k < deps; k++)
+				cubeArr[TiledIndex(i, j, k)] = initCell;
+}// end Constructor
+
+
+
+bool TiledStorage::GetStatus(/*IN*/const LocationRec& cell) const
+{
+	return cubeArr[TiledIndex(cell.x, cell.y, cell.z)].status == generation;
+}// end GetStatus
+
+
+
+bool TiledStorage::SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat)
+{
+	CellRec& currCell = cubeArr[TiledIndex(cell.x, cell.y, cell.z)];	// The cell being set
+	bool changed = (currCell.status == generation) != stat;	// True if the status of the cell changes
+
+	currCell.status = stat ? generation : NO_STAMP;
+	return changed;
+}// end SetStatus
+
+
+
+bool TiledStorage::GetPopulated(/*IN*/const LocationRec& cell) const
+{
+	return cubeArr[TiledIndex(cell.x, cell.y, cell.z)].populated;
+}// end GetPopulated
+
+
+
+CellType TiledStorage::GetType(/*IN*/const LocationRec& cell) const
+{
+	return cubeArr[TiledIndex(cell.x, cell.y, cell.z)].type;
+}// end GetType
+
+
+
+void TiledStorage::SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType)
+{
+	CellRec& currCell = cubeArr[TiledIndex(cell.x, cell.y, cell.z)];	// The cell being set
+
+	// Set the cell to the new CellType and update the cell to have a CellType
+	currCell.type = currType;
+	currCell.populated = true;
+}// end SetType
+
+
+
+void TiledStorage::GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const
+{
+	const CellRec* brick = &cubeArr[TiledIndex(x, y, ZERO)];	// The row within the current brick
+	int brickEnd;	// The face after the last of the row in the current brick
+
+	// The bricks along the depth of a row are next to each other, the row is read a brick at a time
+	for (int k = 0; k < deps; brick += (size_t)OFFSET << BRICK_CELL_SHIFT)
+	{
+		brickEnd = min(k + BRICK_EDGE, deps);
+
+		for (int b = 0; k < brickEnd; k++, b++)
+		{
+			if (brick[MORTON_SPREAD[b]].populated)
+				rowTypes[k] = (int)brick[MORTON_SPREAD[b]].type;
+			else
+				rowTypes[k] = EMPTY_CELL;
+		}
+	}
+}// end GetRowTypes
+
+
+
+size_t TiledStorage::SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[])
+{
+	int x = (int)(first / deps / cols);	// The row of the current cell
+	int y = (int)(first / deps % cols);	// The column of the current cell
+	int z = (int)(first % deps);		// The face of the current cell
+	CellRec* brick;		// The row within the brick of the current cell
+	size_t brickEnd;	// The index after the last cell of the range in the brick
+	size_t newAmt = ZERO;	// The amount of cells populated by the range
+
+	// Walk the range in row major order, the part of a row in a brick at a time
+	for (size_t i = 0; i < amount; )
+	{
+		brick = &cubeArr[TiledIndex(x, y, z & ~BRICK_MASK)];
+		brickEnd = min(amount, i + (size_t)(min((z | BRICK_MASK) + OFFSET, deps) - z));
+
+		for (; i < brickEnd; i++, z++)
+		{
+			if (!brick[MORTON_SPREAD[z & BRICK_MASK]].populated)
+				newAmt++;
+
+			brick[MORTON_SPREAD[z & BRICK_MASK]].type = (CellType)cellTypes[i];
+			brick[MORTON_SPREAD[z & BRICK_MASK]].populated = true;
+		}
+
+		if (z == deps)
+		{
+			z = ZERO;
+
+			if (++y == cols)
+			{
+				y = ZERO;
+				x++;
+			}
+		}
+	}
+
+	return newAmt;
+}// end SetCellTypes
+
+
+
+size_t TiledStorage::CountChecked() const
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+
+	for (size_t i = 0; i < cubeArr.size(); i++)
+		if (cubeArr[i].status == generation)
+			checkedAmt++;
+
+	return checkedAmt;
+}// end CountChecked
+
+
+
+size_t TiledStorage::CountPopulated() const
+{
+	size_t popAmt = ZERO;	// The amount of populated cells
+
+	for (size_t i = 0; i < cubeArr.size(); i++)
+		if (cubeArr[i].populated)
+			popAmt++;
+
+	return popAmt;
+}// end CountPopulated
+
+
+
+CubeStorage* TiledStorage::Clone() const
+{
+	return new TiledStorage(*this);
+}// end Clone
+
+
+
+void TiledStorage::ResetStamps()
+{
+	for (size_t i = 0; i < cubeArr.size(); i++)
+		cubeArr[i].status = NO_STAMP;
+}// end ResetStamps
+
+
+
+// ------------------------------- ChunkStorageBase -------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the value every cell starts with
+// Post: initChunk is a single value holding initCell
+ChunkStorageBase::ChunkStorageBase(/*IN*/const int& numRows,        // The amount of rows
+								   /*IN*/const int& numCols,        // The amount of columns
+								   /*IN*/const int& numDeps,        // The amount of faces
+								   /*IN*/const CellRec& initCell)   // The value every cell starts with
+	: CubeStorage(numRows, numCols, numDeps)
+{
+	chunkCols = (cols + CHUNK_MASK) >> CHUNK_SHIFT;
+	chunkDeps = (deps + CHUNK_MASK) >> CHUNK_SHIFT;
+
+	initChunk.uniformType = initCell.populated ? initCell.type : EMPTY_WORD;
+	initChunk.uniformStatus = initCell.status != NO_STAMP;
+	initChunk.statusStamp = generation;
+}// end Constructor
+
+
+
+// Pre: The chunk is within the cube
+// Post: Each amount is CHUNK_EDGE, less for the last chunk of a dimension it does not fill
+void ChunkStorageBase::ChunkExtents(/*IN*/const size_t& chunkIndex,      // The index of the chunk
+									/*OUT*/int& rowAmt,                  // The rows of the chunk within the cube
+									/*OUT*/int& colAmt,                  // The columns of the chunk within the cube
+									/*OUT*/int& depAmt) const            // The faces of the chunk within the cube
+{
+	int ck = (int)(chunkIndex % (size_t)chunkDeps);	// The chunk along the faces
+	int cj = (int)(chunkIndex / (size_t)chunkDeps % (size_t)chunkCols);	// The chunk along the columns
+	int ci = (int)(chunkIndex / (size_t)chunkDeps / (size_t)chunkCols);	// The chunk along the rows
+
+	rowAmt = min(CHUNK_EDGE, rows - (ci << CHUNK_SHIFT));
+	colAmt = min(CHUNK_EDGE, cols - (cj << CHUNK_SHIFT));
+	depAmt = min(CHUNK_EDGE, deps - (ck << CHUNK_SHIFT));
+}// end ChunkExtents
+
+
+
+// Pre: The place of the cell within the chunk
+// Post: Return true if the cell is checked in the current generation
+bool ChunkStorageBase::ChunkStatus(/*IN*/const ChunkRec& chunk,          // The chunk of the cell
+								   /*IN*/const size_t& place) const     // The place of the cell within the chunk
+{
+	// A chunk of an earlier generation holds no checked cell
+	if (chunk.statusStamp != generation)
+		return false;
+
+	if (chunk.statusBits.empty())
+		return chunk.uniformStatus;
+
+	return (chunk.statusBits[place >> WORD_SHIFT] >> (place & WORD_MASK)) & OFFSET;
+}// end ChunkStatus
+
+
+
+// Pre: The place of the cell within the chunk
+// Post: The cell holds stat in the current generation, the chunk only gets a bitset
+//       once a cell differs. Return true if the status of the cell changed
+bool ChunkStorageBase::WriteStatus(/*IN/OUT*/ChunkRec& chunk,            // The chunk of the cell
+								   /*IN*/const size_t& place,           // The place of the cell within the chunk
+								   /*IN*/const bool& stat)              // The status of the cell
+{
+	uint64_t bit = (uint64_t)OFFSET << (place & WORD_MASK);	// The bit of the cell
+	bool changed;	// True if the status of the cell changes
+
+	RefreshStatus(chunk);
+
+	// A chunk of one status only gets a bitset once a cell differs
+	if (chunk.statusBits.empty())
+	{
+		if (stat == chunk.uniformStatus)
+			return false;
+
+		ExpandStatus(chunk);
+	}
+
+	changed = ((chunk.statusBits[place >> WORD_SHIFT] & bit) != ZERO) != stat;
+
+	if (stat)
+		chunk.statusBits[place >> WORD_SHIFT] |= bit;
+	else
+		chunk.statusBits[place >> WORD_SHIFT] &= ~bit;
+
+	return changed;
+}// end WriteStatus
+
+
+
+// Pre: The place of the cell within the chunk
+// Post: The type of the cell is returned, EMPTY_WORD if it has none
+CellType ChunkStorageBase::ChunkType(/*IN*/const ChunkRec& chunk,        // The chunk of the cell
+									 /*IN*/const size_t& place) const   // The place of the cell within the chunk
+{
+	if (chunk.types.empty())
+		return chunk.uniformType;
+
+	return chunk.types[place];
+}// end ChunkType
+
+
+
+// Pre: The place of the cell within the chunk
+// Post: The cell holds currType, the chunk only gets a type per cell once a cell differs
+void ChunkStorageBase::WriteType(/*IN/OUT*/ChunkRec& chunk,              // The chunk of the cell
+								 /*IN*/const size_t& place,             // The place of the cell within the chunk
+								 /*IN*/const CellType& currType)        // The type of the cell
+{
+	// A chunk of one type only gets a type per cell once a cell differs
+	if (chunk.types.empty())
+	{
+		if (currType == chunk.uniformType)
+			return;
+
+		ExpandTypes(chunk);
+	}
+
+	chunk.types[place] = currType;
+}// end WriteType
+
+
+
+// Pre: None
+// Post: The integer index of the type of the chunk is returned, EMPTY_CELL if it is not a
+//       single type or has no type
+int ChunkStorageBase::UniformType(/*IN*/const ChunkRec& chunk) const    // The chunk being read
+{
+	// Only a collapsed chunk is known to hold one type, Compact collapses every chunk that can
+	if (!chunk.types.empty() || chunk.uniformType == EMPTY_WORD)
+		return EMPTY_CELL;
+
+	return (int)chunk.uniformType;
+}// end UniformType
+
+
+
+// Pre: The place of the first cell of the part, k < partEnd <= deps
+// Post: rowTypes[k] to rowTypes[partEnd - 1] hold the types of the part, EMPTY_CELL
+//       for a cell with no type
+void ChunkStorageBase::ReadRowPart(/*IN*/const ChunkRec& chunk,          // The chunk of the part
+								   /*IN*/const size_t& place,           // The place of the first cell of the part
+								   /*IN*/const int& k,                  // The face of the first cell of the part
+								   /*IN*/const int& partEnd,            // The face after the last cell of the part
+								   /*OUT*/int rowTypes[]) const         // The types of the row
+{
+	const CellType* row;	// The types of the part
+
+	// A chunk of one type fills its part of the row at once
+	if (chunk.types.empty())
+	{
+		fill(rowTypes + k, rowTypes + partEnd, chunk.uniformType == EMPTY_WORD ? EMPTY_CELL : (int)chunk.uniformType);
+		return;
+	}
+
+	row = &chunk.types[place];
+
+	for (int z = k, c = 0; z < partEnd; z++, c++)
+	{
+		if (row[c] != EMPTY_WORD)
+			rowTypes[z] = (int)row[c];
+		else
+			rowTypes[z] = EMPTY_CELL;
+	}
+}// end ReadRowPart
+
+
+
+// Pre: The types of the part
+// Post: Return true if the chunk is a single type and every type of the part is it
+bool ChunkStorageBase::PartAlike(/*IN*/const ChunkRec& chunk,            // The chunk of the part
+								 /*IN*/const int cellTypes[],           // The types of the part
+								 /*IN*/const size_t& partAmt) const     // The amount of cells in the part
+{
+	bool alike = chunk.types.empty();	// True while the part matches a chunk of one type
+
+	for (size_t c = 0; alike && c < partAmt; c++)
+		alike = (CellType)cellTypes[c] == chunk.uniformType;
+
+	return alike;
+}// end PartAlike
+
+
+
+// Pre: The chunk holds a type per cell, the place of the first cell of the part
+// Post: The cells of the part hold their types, the amount of them that had no type
+//       is returned
+size_t ChunkStorageBase::WritePart(/*IN/OUT*/ChunkRec& chunk,            // The chunk of the part
+								   /*IN*/const size_t& place,           // The place of the first cell of the part
+								   /*IN*/const int cellTypes[],         // The types of the part
+								   /*IN*/const size_t& partAmt)         // The amount of cells in the part
+{
+	CellType* row = &chunk.types[place];	// The types of the part
+	size_t newAmt = ZERO;	// The amount of cells populated by the part
+
+	for (size_t c = 0; c < partAmt; c++)
+	{
+		if (row[c] == EMPTY_WORD)
+			newAmt++;
+
+		row[c] = (CellType)cellTypes[c];
+	}
+
+	return newAmt;
+}// end WritePart
+
+
+
+// Pre: The chunk is within the cube
+// Post: The amount of cells of the chunk checked in the current generation is returned
+size_t ChunkStorageBase::CountChunkChecked(/*IN*/const ChunkRec& chunk,              // The chunk being counted
+										   /*IN*/const size_t& chunkIndex) const    // The index of the chunk
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+	size_t place;				// The place of the current cell within the chunk
+	int rowAmt, colAmt, depAmt;	// The cells of the chunk within the cube
+
+	// A chunk of an earlier generation holds no checked cell
+	if (chunk.statusStamp != generation)
+		return ZERO;
+
+	ChunkExtents(chunkIndex, rowAmt, colAmt, depAmt);
+
+	if (chunk.statusBits.empty())
+		return chunk.uniformStatus ? (size_t)rowAmt * (size_t)colAmt * (size_t)depAmt : ZERO;
+
+	// Only the cells within the cube are counted
+	for (int i = 0; i < rowAmt; i++)
+		for (int j = 0; j < colAmt; j++)
+			for (int k = 0; k < depAmt; k++)
+			{
+				place = PlaceIndex(i, j, k);
+				checkedAmt += (chunk.statusBits[place >> WORD_SHIFT] >> (place & WORD_MASK)) & OFFSET;
+			}
+
+	return checkedAmt;
+}// end CountChunkChecked
+
+
+
+// Pre: The chunk is within the cube
+// Post: The amount of cells of the chunk that have a type is returned
+size_t ChunkStorageBase::CountChunkPopulated(/*IN*/const ChunkRec& chunk,            // The chunk being counted
+											 /*IN*/const size_t& chunkIndex) const  // The index of the chunk
+{
+	size_t popAmt = ZERO;		// The amount of populated cells
+	int rowAmt, colAmt, depAmt;	// The cells of the chunk within the cube
+
+	ChunkExtents(chunkIndex, rowAmt, colAmt, depAmt);
+
+	if (chunk.types.empty())
+		return chunk.uniformType != EMPTY_WORD ? (size_t)rowAmt * (size_t)colAmt * (size_t)depAmt : ZERO;
+
+	// Only the cells within the cube are counted
+	for (int i = 0; i < rowAmt; i++)
+		for (int j = 0; j < colAmt; j++)
+			for (int k = 0; k < depAmt; k++)
+				if (chunk.types[PlaceIndex(i, j, k)] != EMPTY_WORD)
+					popAmt++;
+
+	return popAmt;
+}// end CountChunkPopulated
+
+
+
+// Pre: The chunk is within the cube
+// Post: If the cells of the chunk within the cube hold one type the chunk is a single
+//       type, if they hold one status a single status, and their memory is released
+void ChunkStorageBase::CompactChunk(/*IN/OUT*/ChunkRec& chunk,           // The chunk being collapsed
+									/*IN*/const size_t& chunkIndex)     // The index of the chunk
+{
+	size_t place;				// The place of the current cell within the chunk
+	bool typesAlike;			// True while every cell of the chunk holds the first cell's type
+	bool statusAlike;			// True while every cell of the chunk holds the first cell's status
+	bool firstStatus;			// The status of the first cell of the chunk
+	int rowAmt, colAmt, depAmt;	// The cells of the chunk within the cube
+
+	ChunkExtents(chunkIndex, rowAmt, colAmt, depAmt);
+	RefreshStatus(chunk);
+
+	typesAlike = !chunk.types.empty();
+	statusAlike = !chunk.statusBits.empty();
+	firstStatus = statusAlike && (chunk.statusBits[ZERO] & OFFSET);
+
+	// The first cell is always within the cube, the cells past it are never read
+	for (int i = 0; i < rowAmt && (typesAlike || statusAlike); i++)
+		for (int j = 0; j < colAmt; j++)
+			for (int k = 0; k < depAmt; k++)
+			{
+				place = PlaceIndex(i, j, k);
+
+				if (typesAlike && chunk.types[place] != chunk.types[ZERO])
+					typesAlike = false;
+				if (statusAlike && (bool)((chunk.statusBits[place >> WORD_SHIFT] >> (place & WORD_MASK)) & OFFSET) != firstStatus)
+					statusAlike = false;
+			}
+
+	if (typesAlike)
+	{
+		chunk.uniformType = chunk.types[ZERO];
+		vector<CellType>().swap(chunk.types);
+	}
+
+	if (statusAlike)
+	{
+		chunk.uniformStatus = firstStatus;
+		vector<uint64_t>().swap(chunk.statusBits);
+	}
+}// end CompactChunk
+
+
+
+// Pre: The chunk is a single type
+// Post: types holds the single type for every cell of the chunk
+void ChunkStorageBase::ExpandTypes(/*IN/OUT*/ChunkRec& chunk)           // The chunk being expanded
+{
+	chunk.types.assign(CHUNK_CELLS, chunk.uniformType);
+}// end ExpandTypes
+
+
+
+// Pre: The chunk is a single status
+// Post: statusBits holds the single status for every cell of the chunk
+void ChunkStorageBase::ExpandStatus(/*IN/OUT*/ChunkRec& chunk)          // The chunk being expanded
+{
+	chunk.statusBits.assign(CHUNK_CELLS >> WORD_SHIFT, chunk.uniformStatus ? ~(uint64_t)ZERO : (uint64_t)ZERO);
+}// end ExpandStatus
+
+
+
+// Pre: None
+// Post: The chunk is a single status, unchecked in the current generation, if its
+//       status was of an earlier one. Otherwise it is unchanged
+void ChunkStorageBase::RefreshStatus(/*IN/OUT*/ChunkRec& chunk)         // The chunk being refreshed
+{
+	if (chunk.statusStamp == generation)
+		return;
+
+	vector<uint64_t>().swap(chunk.statusBits);
+	chunk.uniformStatus = false;
+	chunk.statusStamp = generation;
+}// end RefreshStatus
+
+
+
+// -------------------------------- ChunkedStorage --------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the value every cell starts with
+// Post: Every cell holds initCell, every chunk is a single value
+ChunkedStorage::ChunkedStorage(/*IN*/const int& numRows,       // The amount of rows
+							   /*IN*/const int& numCols,       // The amount of columns
+							   /*IN*/const int& numDeps,       // The amount of faces
+							   /*IN*/const CellRec& initCell)  // The value every cell starts with
+	: ChunkStorageBase(numRows, numCols, numDeps, initCell)
+{
+	int chunkRows = (rows + CHUNK_MASK) >> CHUNK_SHIFT;	// The amount of chunks along the rows
+
+	chunks.assign((size_t)chunkRows * (size_t)chunkCols * (size_t)chunkDeps, initChunk);
+	chunkLocks.reset(new mutex[chunks.size()]);
+}// end Constructor
+
+
+
+// Pre: orig holds the cells to be copied
+// Post: The chunks are copied, each with a lock of its own
+ChunkedStorage::ChunkedStorage(/*IN*/const ChunkedStorage& orig)  // The storage being copied
+	: ChunkStorageBase(orig), chunks(orig.chunks), chunkLocks(new mutex[orig.chunks.size()])
+{
+}// end Copy Constructor
+
+
+
+bool ChunkedStorage::GetStatus(/*IN*/const LocationRec& cell) const
+{
+	return ChunkStatus(chunks[ChunkIndex(cell.x, cell.y, cell.z)], PlaceIndex(cell.x, cell.y, cell.z));
+}// end GetStatus
+
+
+
+bool ChunkedStorage::SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat)
+{
+	return WriteStatus(chunks[ChunkIndex(cell.x, cell.y, cell.z)], PlaceIndex(cell.x, cell.y, cell.z), stat);
+}// end SetStatus
+
+
+
+bool ChunkedStorage::GetPopulated(/*IN*/const LocationRec& cell) const
+{
+	return ChunkType(chunks[ChunkIndex(cell.x, cell.y, cell.z)], PlaceIndex(cell.x, cell.y, cell.z)) != EMPTY_WORD;
+}// end GetPopulated
+
+
+
+int ChunkedStorage::GetChunkType(/*IN*/const int& x, /*IN*/const int& y, /*IN*/const int& z) const
+{
+	return UniformType(chunks[ChunkIndex(x, y, z)]);
+}// end GetChunkType
+
+
+
+CellType ChunkedStorage::GetType(/*IN*/const LocationRec& cell) const
+{
+	return ChunkType(chunks[ChunkIndex(cell.x, cell.y, cell.z)], PlaceIndex(cell.x, cell.y, cell.z));
+}// end GetType
+
+
+
+void ChunkedStorage::SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType)
+{
+	WriteType(chunks[ChunkIndex(cell.x, cell.y, cell.z)], PlaceIndex(cell.x, cell.y, cell.z), currType);
+}// end SetType
+
+
+
+void ChunkedStorage::GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const
+{
+	size_t chunkIndex = ChunkIndex(x, y, ZERO);		// The chunk of the current part of the row
+	size_t place = PlaceIndex(x, y, ZERO);			// The place of the row within each chunk
+	int chunkEnd;			// The face after the last of the row in the current chunk
+
+	// The chunks along the depth of a row are next to each other, the row is read a chunk at a time
+	for (int k = 0; k < deps; k = chunkEnd, chunkIndex++)
+	{
+		chunkEnd = min(k + CHUNK_EDGE, deps);
+		ReadRowPart(chunks[chunkIndex], place, k, chunkEnd, rowTypes);
+	}
+}// end GetRowTypes
+
+
+
+size_t ChunkedStorage::SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[])
+{
+	int x = (int)(first / deps / cols);	// The row of the current cell
+	int y = (int)(first / deps % cols);	// The column of the current cell
+	int z = (int)(first % deps);		// The face of the current cell
+	size_t partEnd;		// The index after the last cell of the range in the chunk
+	size_t i = ZERO;	// The index of the current cell within the range
+	size_t newAmt = ZERO;	// The amount of cells populated by the range
+
+	// Walk the range in row major order, the part of a row in a chunk at a time
+	while (i < amount)
+	{
+		partEnd = min(amount, i + (size_t)(min((z | CHUNK_MASK) + OFFSET, deps) - z));
+
+		{
+			size_t chunkIndex = ChunkIndex(x, y, z);	// The chunk of the part
+			lock_guard<mutex> chunkLock(chunkLocks[chunkIndex]);	// Another range may share the chunk
+			ChunkRec& chunk = chunks[chunkIndex];		// The chunk of the part
+
+			if (!PartAlike(chunk, cellTypes + i, partEnd - i))
+			{
+				if (chunk.types.empty())
+					ExpandTypes(chunk);
+
+				newAmt += WritePart(chunk, PlaceIndex(x, y, z), cellTypes + i, partEnd - i);
+			}
+		}
+
+		z += (int)(partEnd - i);
+		i = partEnd;
+
+		if (z == deps)
+		{
+			z = ZERO;
+
+			if (++y == cols)
+			{
+				y = ZERO;
+				x++;
+			}
+		}
+	}
+
+	return newAmt;
+}// end SetCellTypes
+
+
+
+size_t ChunkedStorage::CountChecked() const
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+
+	for (size_t chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex++)
+		checkedAmt += CountChunkChecked(chunks[chunkIndex], chunkIndex);
+
+	return checkedAmt;
+}// end CountChecked
+
+
+
+size_t ChunkedStorage::CountPopulated() const
+{
+	size_t popAmt = ZERO;		// The amount of populated cells
+
+	for (size_t chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex++)
+		popAmt += CountChunkPopulated(chunks[chunkIndex], chunkIndex);
+
+	return popAmt;
+}// end CountPopulated
+
+
+
+CubeStorage* ChunkedStorage::Clone() const
+{
+	return new ChunkedStorage(*this);
+}// end Clone
+
+
+
+void ChunkedStorage::ResetStamps()
+{
+	for (size_t i = 0; i < chunks.size(); i++)
+		chunks[i].statusStamp = NO_STAMP;
+}// end ResetStamps
+
+
+
+// Pre: No other thread is using the storage
+// Post: A chunk whose cells within the cube hold one type is a single type, a chunk whose
+//       cells hold one status is a single status, and their memory is released
+void ChunkedStorage::Compact()
+{
+	for (size_t chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex++)
+		CompactChunk(chunks[chunkIndex], chunkIndex);
+}// end Compact
+
+
+
+// --------------------------------- SparseStorage --------------------------------------
+
+
+
+// Pre: Every dimension is greater than 0, the value every cell starts with
+// Post: Every cell holds initCell, the table holds no chunk
+SparseStorage::SparseStorage(/*IN*/const int& numRows,        // The amount of rows
+							 /*IN*/const int& numCols,        // The amount of columns
+							 /*IN*/const int& numDeps,        // The amount of faces
+							 /*IN*/const CellRec& initCell)   // The value every cell starts with
+	: ChunkStorageBase(numRows, numCols, numDeps, initCell)
+{
+}// end Constructor
+
+
+
+// Pre: orig holds the cells to be copied
+// Post: The table is copied, with a lock of its own
+SparseStorage::SparseStorage(/*IN*/const SparseStorage& orig)    // The storage being copied
+	: ChunkStorageBase(orig), chunks(orig.chunks)
+{
+}// end Copy Constructor
+
+
+
+bool SparseStorage::GetStatus(/*IN*/const LocationRec& cell) const
+{
+	return ChunkStatus(FindChunk(ChunkIndex(cell.x, cell.y, cell.z)), PlaceIndex(cell.x, cell.y, cell.z));
+}// end GetStatus
+
+
+
+bool SparseStorage::SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat)
+{
+	size_t chunkIndex = ChunkIndex(cell.x, cell.y, cell.z);	// The chunk of the cell
+	const ChunkRec& found = FindChunk(chunkIndex);			// The chunk of the cell, in the table or not
+	bool current = found.statusStamp == generation;			// False while every cell of the chunk is unchecked
+
+	// A chunk only joins the table once a cell differs
+	if ((!current || found.statusBits.empty()) && stat == (current && found.uniformStatus))
+		return false;
+
+	return WriteStatus(AddChunk(chunkIndex), PlaceIndex(cell.x, cell.y, cell.z), stat);
+}// end SetStatus
+
+
+
+bool SparseStorage::GetPopulated(/*IN*/const LocationRec& cell) const
+{
+	return ChunkType(FindChunk(ChunkIndex(cell.x, cell.y, cell.z)), PlaceIndex(cell.x, cell.y, cell.z)) != EMPTY_WORD;
+}// end GetPopulated
+
+
+
+// Pre: The row is within the cube
+// Post: Return false if no cell of the row has a type
+bool SparseStorage::RowHasTypes(/*IN*/const int& x, /*IN*/const int& y) const
+{
+	size_t chunkIndex = ChunkIndex(x, y, ZERO);		// The chunk of the current part of the row
+	size_t place = PlaceIndex(x, y, ZERO);			// The place of the row within each chunk
+	int partAmt;	// The faces of the row in the current chunk
+
+	// Only the chunks of the table along the row are read
+	for (int k = 0; k < deps; k += CHUNK_EDGE, chunkIndex++)
+	{
+		const ChunkRec& chunk = FindChunk(chunkIndex);	// The current chunk
+
+		if (chunk.types.empty())
+		{
+			if (chunk.uniformType != EMPTY_WORD)
+				return true;
+			continue;
+		}
+
+		partAmt = min(CHUNK_EDGE, deps - k);
+
+		for (int c = 0; c < partAmt; c++)
+			if (chunk.types[place + c] != EMPTY_WORD)
+				return true;
+	}
+
+	return false;
+}// end RowHasTypes
+
+
+
+int SparseStorage::GetChunkType(/*IN*/const int& x, /*IN*/const int& y, /*IN*/const int& z) const
+{
+	return UniformType(FindChunk(ChunkIndex(x, y, z)));
+}// end GetChunkType
+
+
+
+CellType SparseStorage::GetType(/*IN*/const LocationRec& cell) const
+{
+	return ChunkType(FindChunk(ChunkIndex(cell.x, cell.y, cell.z)), PlaceIndex(cell.x, cell.y, cell.z));
+}// end GetType
+
+
+
+void SparseStorage::SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType)
+{
+	size_t chunkIndex = ChunkIndex(cell.x, cell.y, cell.z);	// The chunk of the cell
+
+	// A chunk only joins the table once a cell differs
+	if (FindChunk(chunkIndex).types.empty() && currType == FindChunk(chunkIndex).uniformType)
+		return;
+
+	WriteType(AddChunk(chunkIndex), PlaceIndex(cell.x, cell.y, cell.z), currType);
+}// end SetType
+
+
+
+void SparseStorage::GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const
+{
+	size_t chunkIndex = ChunkIndex(x, y, ZERO);		// The chunk of the current part of the row
+	size_t place = PlaceIndex(x, y, ZERO);			// The place of the row within each chunk
+	int chunkEnd;			// The face after the last of the row in the current chunk
+
+	// The chunks along the depth of a row have indexes next to each other, the row is read a
+	// chunk at a time, a chunk not in the table is the starting value
+	for (int k = 0; k < deps; k = chunkEnd, chunkIndex++)
+	{
+		chunkEnd = min(k + CHUNK_EDGE, deps);
+		ReadRowPart(FindChunk(chunkIndex), place, k, chunkEnd, rowTypes);
+	}
+}// end GetRowTypes
+
+
+
+size_t SparseStorage::SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[])
+{
+	int x = (int)(first / deps / cols);	// The row of the current cell
+	int y = (int)(first / deps % cols);	// The column of the current cell
+	int z = (int)(first % deps);		// The face of the current cell
+	size_t partEnd;		// The index after the last cell of the range in the chunk
+	size_t i = ZERO;	// The index of the current cell within the range
+	size_t newAmt = ZERO;	// The amount of cells populated by the range
+	ChunkRec* chunk;	// The chunk of the part, none while the part matches a chunk of one type
+
+	// Walk the range in row major order, the part of a row in a chunk at a time
+	while (i < amount)
+	{
+		partEnd = min(amount, i + (size_t)(min((z | CHUNK_MASK) + OFFSET, deps) - z));
+
+		{
+			size_t chunkIndex = ChunkIndex(x, y, z);	// The chunk of the part
+			lock_guard<mutex> tableLock(chunksLock);	// Another range may add to the table
+
+			chunk = nullptr;
+			if (!PartAlike(FindChunk(chunkIndex), cellTypes + i, partEnd - i))
+			{
+				chunk = &AddChunk(chunkIndex);
+
+				if (chunk->types.empty())
+					ExpandTypes(*chunk);
+			}
+		}
+
+		// The chunk stays where it is in the table, its part is written outside the lock
+		if (chunk != nullptr)
+			newAmt += WritePart(*chunk, PlaceIndex(x, y, z), cellTypes + i, partEnd - i);
+
+		z += (int)(partEnd - i);
+		i = partEnd;
+
+		if (z == deps)
+		{
+			z = ZERO;
+
+			if (++y == cols)
+			{
+				y = ZERO;
+				x++;
+			}
+		}
+	}
+
+	return newAmt;
+}// end SetCellTypes
+
+
+
+size_t SparseStorage::CountChecked() const
+{
+	size_t checkedAmt = ZERO;	// The amount of checked cells
+	size_t tableAmt = ZERO;		// The amount of cells of the cube in the table
+	int rowAmt, colAmt, depAmt;	// The cells of the current chunk within the cube
+
+	for (unordered_map<size_t, ChunkRec>::const_iterator it = chunks.begin(); it != chunks.end(); it++)
+	{
+		ChunkExtents(it->first, rowAmt, colAmt, depAmt);
+		tableAmt += (size_t)rowAmt * (size_t)colAmt * (size_t)depAmt;
+		checkedAmt += CountChunkChecked(it->second, it->first);
+	}
+
+	// Every cell outside the table holds the starting status, unless it is of an earlier generation
+	if (initChunk.statusStamp == generation && initChunk.uniformStatus)
+		checkedAmt += (size_t)rows * (size_t)cols * (size_t)deps - tableAmt;
+
+	return checkedAmt;
+}// end CountChecked
+
+
+
+size_t SparseStorage::CountPopulated() const
+{
+	size_t popAmt = ZERO;		// The amount of populated cells
+	size_t tableAmt = ZERO;		// The amount of cells of the cube in the table
+	int rowAmt, colAmt, depAmt;	// The cells of the current chunk within the cube
+
+	for (unordered_map<size_t, ChunkRec>::const_iterator it = chunks.begin(); it != chunks.end(); it++)
+	{
+		ChunkExtents(it->first, rowAmt, colAmt, depAmt);
+		tableAmt += (size_t)rowAmt * (size_t)colAmt * (size_t)depAmt;
+		popAmt += CountChunkPopulated(it->second, it->first);
+	}
+
+	// Every cell outside the table holds the starting type
+	if (initChunk.uniformType != EMPTY_WORD)
+		popAmt += (size_t)rows * (size_t)cols * (size_t)deps - tableAmt;
+
+	return popAmt;
+}// end CountPopulated
+
+
+
+CubeStorage* SparseStorage::Clone() const
+{
+	return new SparseStorage(*this);
+}// end Clone
+
+
+
+void SparseStorage::ResetStamps()
+{
+	initChunk.statusStamp = NO_STAMP;
+
+	for (unordered_map<size_t, ChunkRec>::iterator it = chunks.begin(); it != chunks.end(); it++)
+		it->second.statusStamp = NO_STAMP;
+}// end ResetStamps
+
+
+
+// Pre: No other thread is using the storage
+// Post: A chunk of the table whose cells within the cube hold one type or one status is a
+//       single value, a chunk holding only the starting value is no longer in the table
+void SparseStorage::Compact()
+{
+	// A chunk is compared to the starting value of the current generation
+	RefreshStatus(initChunk);
+
+	for (unordered_map<size_t, ChunkRec>::iterator it = chunks.begin(); it != chunks.end(); )
+	{
+		ChunkRec& chunk = it->second;	// The current chunk
+
+		CompactChunk(chunk, it->first);
+
+		// A chunk of the starting value needs no place in the table
+		if (chunk.types.empty() && chunk.statusBits.empty() &&
+			chunk.uniformType == initChunk.uniformType && chunk.uniformStatus == initChunk.uniformStatus)
+			it = chunks.erase(it);
+		else
+			it++;
+	}
+}// end Compact
+
+
+
+// Pre: The chunk is within the cube
+// Post: The chunk of the table is returned, initChunk if it is not in the table
+const ChunkRec& SparseStorage::FindChunk(/*IN*/const size_t& chunkIndex) const   // The index of the chunk
+{
+	unordered_map<size_t, ChunkRec>::const_iterator found = chunks.find(chunkIndex);	// The entry of the chunk
+
+	if (found == chunks.end())
+		return initChunk;
+
+	return found->second;
+}// end FindChunk
+
+
+
+// Pre: The chunk is within the cube
+// Post: The chunk of the table is returned, added as initChunk if it was not in the table
+ChunkRec& SparseStorage::AddChunk(/*IN*/const size_t& chunkIndex)                // The index of the chunk
+{
+	return chunks.insert(make_pair(chunkIndex, initChunk)).first->second;
+}// end AddChunk
+
+
+
+// The type planes a cube chooses from, see Cube.cpp
+template class PackedStorage<uint8_t>;
+template class PackedStorage<uint16_t>;
+template class MappedStorage<uint8_t>;
+template class MappedStorage<uint16_t>;
@@ -0,0 +1,837 @@
+#pragma once
+/*
+    FileName : CubeStorage.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for the storage behind a Cube Class. A CubeClass
+        checks every location it is given and then hands the cell to its storage, so
+        the way cells are laid out in memory can change without changing the cube.
+
+        RecordStorage - Every cell is a CellRec, stored in a single row major buffer.
+        PackedStorage - The cells are split into planes. The type of each cell is a
+                        TypeInt in a dense type plane, status and populated are each a
+                        bitset with one bit per cell. With a byte per type a cell takes
+                        1.25 bytes instead of the 4 bytes of a CellRec, and counting
+                        checked or populated cells is a popcount over 64 cells at a time.
+        MappedStorage - The types are the cells of a cube file mapped into memory, a
+                        TypeInt per cell. The cube is never read or copied, a page is
+                        loaded the first time it is touched. A cell of EmptyType has
+                        no type. Status is a bitset like PackedStorage. Setting a type
+                        only changes the copy in memory, never the file.
+        TiledStorage  - Every cell is a CellRec, the cube is split into bricks of
+                        BRICK_EDGE^3 cells. The bricks are row major and the cells of a
+                        brick follow a Morton (Z) curve, so a cell's neighbors along x and
+                        y are usually in the same brick instead of a plane or a row apart.
+                        The index of a cell is found with a table lookup per coordinate.
+        ChunkedStorage - The cube is split into chunks of CHUNK_EDGE^3 cells. A chunk whose
+                        cells all hold the same type is a single value, otherwise it holds
+                        a 16 bit type per cell. Status is likewise a single value or a
+                        bitset per chunk. Compact collapses every chunk that has come to
+                        hold a single type, so a cube of large regions of one color takes
+                        a few bytes per chunk instead of a record per cell. GetChunkType
+                        tells the labeler which chunks are a single type, so it labels
+                        each as one block and only compares the cells on its faces.
+        SparseStorage - The chunks of ChunkedStorage kept in a hash table by their index.
+                        Only a chunk holding a cell unlike the value every cell started
+                        with is in the table, so a cube of a few populated cells takes
+                        memory for the chunks around them alone. A row crossing no chunk
+                        of the table is known to hold no type without reading it.
+                        Both share ChunkStorageBase, which reads, writes, counts and
+                        collapses a chunk, and differ only in how a chunk is found.
+
+        Status is kept as a generation stamp. A storage starts in generation FIRST_STAMP and
+        a cell is checked while its stamp is the current generation, so ClearStatus leaves
+        every cell unchecked by moving to the next generation. RecordStorage and
+        TiledStorage stamp every cell, PackedStorage and MappedStorage stamp every word of
+        64 status bits and ChunkedStorage and SparseStorage every chunk, a bitset or chunk
+        of an earlier generation reads as unchecked and is cleared the first time a status
+        in it is set. Once the stamps wrap every stamp is reset to NO_STAMP, once every 255
+        clears.
+
+        PackedStorage and MappedStorage are templates on TypeInt, the unsigned integer
+        holding the type of a cell. They are built for uint8_t, used while every type fits
+        below EMPTY_BYTE, and uint16_t for larger palettes (see Palette.h).
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Every location sent to a storage is within the cube, the CubeClass checks them
+        2 - GetType is only called on cells that are populated
+        3 - The linear index of a cell is row major, ((x * cols) + y) * deps + z, for
+            every storage. TiledStorage keeps its cells in brick order but is still
+            handed ranges of cells by their linear index
+        4 - The integer index of every CellType is below EmptyType<TypeInt>() for
+            PackedStorage and MappedStorage, BYTE_TYPE_AMT types for uint8_t
+        5 - A cube file is not changed on disk while a MappedStorage maps it
+        6 - TiledStorage rounds every dimension up to a multiple of BRICK_EDGE, the cells
+            past the cube are never populated or checked
+        7 - ChunkedStorage is only changed by one thread at a time, except SetCellTypes,
+            which locks each chunk it writes. A chunk is only collapsed by Compact
+        8 - SparseStorage is only changed by one thread at a time, except SetCellTypes,
+            which locks the table while it finds or adds a chunk. A chunk is only removed
+            from the table by Compact
+        9 - The status of initCell is NO_STAMP for unchecked or FIRST_STAMP for checked,
+            ClearStatus is only called by one thread at a time
+
+
+                           SUMMARY OF METHODS:
+    CubeStorage (abstract)
+        bool GetStatus(*IN*const LocationRec& cell) const - Gets the status of a cell
+        bool SetStatus(*IN*const LocationRec& cell,
+                       *IN*const bool& stat) - Sets the status of a cell, telling if it changed
+        bool GetPopulated(*IN*const LocationRec& cell) const - Checks if a cell has a type
+        bool RowHasTypes(*IN*const int& x,
+                         *IN*const int& y) const - Checks if any cell along a row may have a type
+        int GetChunkType(*IN*const int& x,
+                         *IN*const int& y,
+                         *IN*const int& z) const - Gets the type of a chunk whose cells all hold it
+        CellType GetType(*IN*const LocationRec& cell) const - Gets the CellType of a cell
+        void SetType(*IN*const LocationRec& cell,
+                     *IN*const CellType& currType) - Sets the CellType of a cell and populates it
+        void GetRowTypes(*IN*const int& x,
+                         *IN*const int& y,
+                         *OUT*int rowTypes[]) const - Gets the type of every cell along a row
+        size_t SetCellTypes(*IN*const size_t& first,
+                            *IN*const size_t& amount,
+                            *IN*const int cellTypes[]) - Sets the type of a range of cells
+        void ClearStatus() - Sets every cell to unchecked by starting a new generation
+        size_t CountChecked() const - Counts the cells that have been checked
+        size_t CountPopulated() const - Counts the cells that have a type
+        CubeStorage* Clone() const - Creates a deep copy of the storage
+        void Compact() - Collapses the cells that are alike, if the storage can
+
+    FUNCTIONS
+        TypeInt EmptyType<TypeInt>() - Gets the type stored for a cell with no type
+
+    TiledStorage
+        size_t TiledIndex(*IN*const int& x,
+                          *IN*const int& y,
+                          *IN*const int& z) const - Gets where a cell is kept in brick order
+
+    ChunkStorageBase
+        size_t ChunkIndex(*IN*const int& x,
+                          *IN*const int& y,
+                          *IN*const int& z) const - Gets the chunk of a cell
+        size_t PlaceIndex(*IN*const int& x,
+                          *IN*const int& y,
+                          *IN*const int& z) const - Gets the place of a cell within its chunk
+        void ChunkExtents(*IN*const size_t& chunkIndex,
+                          *OUT*int& rowAmt,
+                          *OUT*int& colAmt,
+                          *OUT*int& depAmt) const - Gets the cells of a chunk within the cube
+        bool ChunkStatus(*IN*const ChunkRec& chunk,
+                         *IN*const size_t& place) const - Gets the status of a cell of a chunk
+        bool WriteStatus(*IN/OUT*ChunkRec& chunk,
+                         *IN*const size_t& place,
+                         *IN*const bool& stat) - Sets the status of a cell of a chunk
+        CellType ChunkType(*IN*const ChunkRec& chunk,
+                           *IN*const size_t& place) const - Gets the type of a cell of a chunk
+        void WriteType(*IN/OUT*ChunkRec& chunk,
+                       *IN*const size_t& place,
+                       *IN*const CellType& currType) - Sets the type of a cell of a chunk
+        int UniformType(*IN*const ChunkRec& chunk) const - Gets the type every cell of a chunk holds
+        void ReadRowPart(*IN*const ChunkRec& chunk,
+                         *IN*const size_t& place,
+                         *IN*const int& k,
+                         *IN*const int& partEnd,
+                         *OUT*int rowTypes[]) const - Gets the types of the part of a row within a chunk
+        bool PartAlike(*IN*const ChunkRec& chunk,
+                       *IN*const int cellTypes[],
+                       *IN*const size_t& partAmt) const - Checks if a part of a range leaves a chunk unchanged
+        size_t WritePart(*IN/OUT*ChunkRec& chunk,
+                         *IN*const size_t& place,
+                         *IN*const int cellTypes[],
+                         *IN*const size_t& partAmt) - Sets the types of the part of a range within a chunk
+        size_t CountChunkChecked(*IN*const ChunkRec& chunk,
+                                 *IN*const size_t& chunkIndex) const - Counts the checked cells of a chunk
+        size_t CountChunkPopulated(*IN*const ChunkRec& chunk,
+                                   *IN*const size_t& chunkIndex) const - Counts the cells of a chunk with a type
+        void CompactChunk(*IN/OUT*ChunkRec& chunk,
+                          *IN*const size_t& chunkIndex) - Collapses a chunk whose cells are alike
+        void ExpandTypes(*IN/OUT*ChunkRec& chunk) - Gives every cell of a chunk its own type
+        void ExpandStatus(*IN/OUT*ChunkRec& chunk) - Gives every cell of a chunk its own status
+        void RefreshStatus(*IN/OUT*ChunkRec& chunk) - Makes a chunk of an earlier generation unchecked
+
+    ChunkedStorage
+        void Compact() - Collapses every chunk whose cells are alike
+
+    SparseStorage
+        void Compact() - Collapses every chunk whose cells are alike, and removes the chunks
+                         that came to hold the starting value
+        const ChunkRec& FindChunk(*IN*const size_t& chunkIndex) const - Gets a chunk, in the table or not
+        ChunkRec& AddChunk(*IN*const size_t& chunkIndex) - Gets a chunk of the table, adding it if needed
+
+    PROTECTED MEMBERS:
+        int rows;   // The amount of rows in the cube
+        int cols;   // The amount of columns in the cube
+        int deps;   // The amount of faces in the cube
+        StatusStamp generation;     // The stamp of a cell checked since the last ClearStatus
+
+        size_t CellIndex(*IN*const LocationRec& cell) const - Gets the linear index of a cell
+        void ResetStamps() - Sets every stamp of the storage to NO_STAMP
+*/
+
+#include <vector>       // Gives access to the vectors holding the cells
+#include <cstdint>      // Gives access to fixed width words for the bitsets
+#include <memory>       // Gives access to the pointer owning the mapping
+#include <string>       // Gives access to the name of a mapped file
+#include <mutex>        // Gives access to the lock of each chunk
+#include <unordered_map>    // Gives access to the table of sparse chunks
+#include "CellRec.h"    // SUPPLIED BY THE CLIENT
+#include "MappedFile.h" // Grants Access to Mapped File Class
+
+using namespace std;
+
+
+// Enumerated type to choose how the cells of a cube are stored
+enum StorageEnum { RECORD_STORAGE, PACKED_STORAGE, MAPPED_STORAGE, TILED_STORAGE, CHUNKED_STORAGE,
+                   SPARSE_STORAGE };
+
+
+const unsigned char EMPTY_BYTE = 0xFF;      // The type byte stored for a cell with no type
+const uint16_t EMPTY_WORD = 0xFFFF;         // The 16 bit type stored for a cell with no type
+const int BYTE_TYPE_AMT = EMPTY_BYTE;       // The most types a plane of bytes can hold
+const size_t CELL_RANGE_ALIGN = 64;         // Ranges of cells starting on a multiple of this
+                                            // may be set by separate threads at once
+const int BRICK_SHIFT = 3;                  // Shifting a coordinate by this gives its brick
+const int BRICK_EDGE = 1 << BRICK_SHIFT;    // The cells along each edge of a brick
+const int BRICK_MASK = BRICK_EDGE - 1;      // Masking a coordinate by this gives its place in a brick
+const int BRICK_CELL_SHIFT = 3 * BRICK_SHIFT;   // Shifting a brick by this gives its first cell
+const size_t MORTON_SPREAD[BRICK_EDGE] = { 0, 1, 8, 9, 64, 65, 72, 73 };
+                                            // The bits of a place in a brick spread 3 apart
+const int CHUNK_SHIFT = 4;                  // Shifting a coordinate by this gives its chunk
+const int CHUNK_EDGE = 1 << CHUNK_SHIFT;    // The cells along each edge of a chunk
+const int CHUNK_MASK = CHUNK_EDGE - 1;      // Masking a coordinate by this gives its place in a chunk
+const size_t CHUNK_CELLS = (size_t)1 << (3 * CHUNK_SHIFT);  // The amount of cells in a chunk
+
+
+
+class CubeStorage
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Records the dimensions of the cube being stored
+    // Pre: Every dimension is greater than 0
+    // Post: rows, cols and deps hold the dimensions of the cube
+    CubeStorage(/*IN*/const int& numRows,      // The amount of rows
+                /*IN*/const int& numCols,      // The amount of columns
+                /*IN*/const int& numDeps);     // The amount of faces
+
+    virtual ~CubeStorage();
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the status of a cell
+    // Pre: The cell location is valid
+    // Post: Return true if the cell has been checked, otherwise false
+    virtual bool GetStatus(/*IN*/const LocationRec& cell) const = 0;     // The desired cell location
+
+    // O(1) : Mutator
+    // Purpose: Sets the status of a cell
+    // Pre: The cell location is valid, the desired status
+    // Post: Sets the status of the cell to the desired status. Return true if the status
+    //       of the cell changed, so a cube can keep its amount checked without reading it
+    virtual bool SetStatus(/*IN*/const LocationRec& cell,     // The desired cell location
+                           /*IN*/const bool& stat) = 0;       // The desired status
+
+    // O(1) : Observer Predicator
+    // Purpose: Checks if a cell has been given a type
+    // Pre: The cell location is valid
+    // Post: Return true if the cell has been populated, otherwise false
+    virtual bool GetPopulated(/*IN*/const LocationRec& cell) const = 0;  // The desired cell location
+
+    // O(N) : Observer Predicator
+    // Purpose: Checks if any cell along the depth of a row may have a type, so a reader may
+    //          skip the rows it knows are empty
+    // Pre: The row is within the cube
+    // Post: Return false if no cell of the row has a type. A storage that does not keep
+    //       track of where its types are returns true
+    virtual bool RowHasTypes(/*IN*/const int& x,              // The row of the desired cells
+                             /*IN*/const int& y) const;       // The column of the desired cells
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type of the chunk holding a cell when every cell of the chunk holds
+    //          it, so a reader may treat the chunk as a single block
+    // Pre: The cell is within the cube
+    // Post: The integer index of the type of every cell of the chunk within the cube is
+    //       returned, EMPTY_CELL if they differ or have no type. A storage that keeps no
+    //       chunks returns EMPTY_CELL
+    virtual int GetChunkType(/*IN*/const int& x,              // The row of the cell
+                             /*IN*/const int& y,              // The column of the cell
+                             /*IN*/const int& z) const;       // The face of the cell
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the CellType of a cell
+    // Pre: The cell location is valid and the cell is populated
+    // Post: The cell's CellType is returned
+    virtual CellType GetType(/*IN*/const LocationRec& cell) const = 0;   // The desired cell location
+
+    // O(1) : Mutator
+    // Purpose: Sets the CellType of a cell
+    // Pre: The cell location is valid, the desired CellType
+    // Post: The cell's CellType is updated and the cell is populated
+    virtual void SetType(/*IN*/const LocationRec& cell,       // The desired cell location
+                         /*IN*/const CellType& currType) = 0; // The desired type of the cell
+
+    // O(N) : Observer Accessor
+    // Purpose: Gets the type of every cell along the depth of a row
+    // Pre: The row is within the cube, rowTypes can hold deps values
+    // Post: rowTypes[z] holds the integer index of the CellType of cell (x, y, z),
+    //       or EMPTY_CELL if the cell has no type
+    virtual void GetRowTypes(/*IN*/const int& x,              // The row of the desired cells
+                             /*IN*/const int& y,              // The column of the desired cells
+                             /*OUT*/int rowTypes[]) const = 0; // The type of each cell in the row
+
+    // O(N) : Mutator
+    // Purpose: Sets the type of a range of cells in row major order
+    // Pre: The range is within the cube, cellTypes holds amount types that are not EMPTY_CELL
+    // Post: Cell first + i holds type cellTypes[i] and is populated, the amount of cells of the
+    //       range that were not populated before is returned. Ranges that start on a multiple
+    //       of CELL_RANGE_ALIGN and do not overlap may be set by separate threads
+    virtual size_t SetCellTypes(/*IN*/const size_t& first,           // The linear index of the first cell
+                                /*IN*/const size_t& amount,          // The amount of cells
+                                /*IN*/const int cellTypes[]) = 0;    // The type of each cell
+
+    // O(1) : Mutator, O(N^3) once every 255 calls
+    // Purpose: Sets every cell to unchecked by starting a new generation
+    // Pre: No other thread is using the storage
+    // Post: No cell is checked, the types are unchanged
+    void ClearStatus();
+
+    // O(N^3) : Observer Summarizer
+    // Purpose: Counts the cells that have been checked
+    // Pre: None
+    // Post: The amount of checked cells is returned
+    virtual size_t CountChecked() const = 0;
+
+    // O(N^3) : Observer Summarizer
+    // Purpose: Counts the cells that have been given a type
+    // Pre: None
+    // Post: The amount of populated cells is returned
+    virtual size_t CountPopulated() const = 0;
+
+    // O(N^3) : Observer Accessor
+    // Purpose: Creates a deep copy of the storage
+    // Pre: None
+    // Post: A new storage holding the same cells is returned, the caller owns it
+    virtual CubeStorage* Clone() const = 0;
+
+    // O(N^3) : Mutator
+    // Purpose: Collapses the cells that are alike, if the storage can
+    // Pre: No other thread is using the storage
+    // Post: Every cell holds what it held, a storage that can not collapse is unchanged
+    virtual void Compact();
+
+protected:
+
+    // PDMs
+    int rows;   // The amount of rows in the cube
+    int cols;   // The amount of columns in the cube
+    int deps;   // The amount of faces in the cube
+    StatusStamp generation;     // The stamp of a cell checked since the last ClearStatus
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the linear index of a cell
+    // Pre: The cell location is valid
+    // Post: ((x * cols) + y) * deps + z is returned
+    size_t CellIndex(/*IN*/const LocationRec& cell) const    // The desired cell location
+    {
+        return ((size_t)cell.x * (size_t)cols + (size_t)cell.y) * (size_t)deps + (size_t)cell.z;
+    }
+
+    // O(N^3) : Mutator
+    // Purpose: Sets every stamp of the storage to NO_STAMP, so none is the generation
+    //          ClearStatus starts again from once the stamps wrap
+    // Pre: No other thread is using the storage
+    // Post: No cell is checked in any generation
+    virtual void ResetStamps() = 0;
+
+}; // end CubeStorage
+
+
+
+// Every cell is a CellRec, stored in a single row major buffer
+class RecordStorage : public CubeStorage
+{
+public:
+
+    // O(N^3) : Constructor
+    // Purpose: Allocates every cell with the desired starting values
+    // Pre: Every dimension is greater than 0, the value every cell starts with
+    // Post: Every cell holds initCell
+    RecordStorage(/*IN*/const int& numRows,        // The amount of rows
+                  /*IN*/const int& numCols,        // The amount of columns
+                  /*IN*/const int& numDeps,        // The amount of faces
+                  /*IN*/const CellRec& initCell);  // The value every cell starts with
+
+    bool GetStatus(/*IN*/const LocationRec& cell) const;
+    bool SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat);
+    bool GetPopulated(/*IN*/const LocationRec& cell) const;
+    CellType GetType(/*IN*/const LocationRec& cell) const;
+    void SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType);
+    void GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const;
+    size_t SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[]);
+    size_t CountChecked() const;
+    size_t CountPopulated() const;
+    CubeStorage* Clone() const;
+
+protected:
+
+    void ResetStamps();
+
+private:
+
+    vector<CellRec> cubeArr;    // The cube containing the cell's information
+
+}; // end RecordStorage
+
+
+
+// O(1)
+// Purpose: Gets the type stored for a cell with no type
+// Pre: None
+// Post: The largest value of TypeInt is returned, EMPTY_BYTE or EMPTY_WORD
+template <class TypeInt>
+inline TypeInt EmptyType()
+{
+    return (TypeInt)~(TypeInt)ZERO;
+}// end EmptyType
+
+
+
+// The types are a dense plane of TypeInt, status and populated are bitsets
+template <class TypeInt>
+class PackedStorage : public CubeStorage
+{
+public:
+
+    // O(N^3) : Constructor
+    // Purpose: Allocates every plane with the desired starting values
+    // Pre: Every dimension is greater than 0, the value every cell starts with
+    // Post: Every cell holds initCell
+    PackedStorage(/*IN*/const int& numRows,        // The amount of rows
+                  /*IN*/const int& numCols,        // The amount of columns
+                  /*IN*/const int& numDeps,        // The amount of faces
+                  /*IN*/const CellRec& initCell);  // The value every cell starts with
+
+    bool GetStatus(/*IN*/const LocationRec& cell) const;
+    bool SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat);
+    bool GetPopulated(/*IN*/const LocationRec& cell) const;
+    CellType GetType(/*IN*/const LocationRec& cell) const;
+    void SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType);
+    void GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const;
+    size_t SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[]);
+    size_t CountChecked() const;
+    size_t CountPopulated() const;
+    CubeStorage* Clone() const;
+
+protected:
+
+    void ResetStamps();
+
+private:
+
+    vector<TypeInt> typePlane;          // The integer index of the CellType of every cell
+    vector<uint64_t> statusBits;        // One bit per cell, set when the cell is checked
+    vector<StatusStamp> wordStamps;     // The generation of each status word, unchecked if not current
+    vector<uint64_t> popBits;           // One bit per cell, set when the cell is populated
+
+}; // end PackedStorage
+
+
+
+// The types are the cells of a mapped cube file, status is a bitset
+template <class TypeInt>
+class MappedStorage : public CubeStorage
+{
+public:
+
+    // O(N^3 / 64) : Constructor
+    // Purpose: Maps the cells of a cube file, only the status bits are allocated
+    // Pre: Every dimension is greater than 0, the name of the file and where its
+    //      rows * cols * deps cells of a TypeInt each start, a multiple of sizeof(TypeInt)
+    // Post: Every cell holds the type in the file and is unchecked
+    // Exception: CubeFileException is thrown if the file can not be mapped or is too short
+    MappedStorage(/*IN*/const int& numRows,        // The amount of rows
+                  /*IN*/const int& numCols,        // The amount of columns
+                  /*IN*/const int& numDeps,        // The amount of faces
+                  /*IN*/const string& fileName,    // The cube file
+                  /*IN*/const size_t& dataOffset); // Where the cells start in the file
+
+    // O(N^3) : Copy Constructor
+    // Purpose: Creates a deep copy of orig
+    // Pre: orig holds the cells to be copied
+    // Post: The types are copied into memory, the copy does not map the file
+    MappedStorage(/*IN*/const MappedStorage& orig);    // The storage being copied
+
+    bool GetStatus(/*IN*/const LocationRec& cell) const;
+    bool SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat);
+    bool GetPopulated(/*IN*/const LocationRec& cell) const;
+    CellType GetType(/*IN*/const LocationRec& cell) const;
+    void SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType);
+    void GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const;
+    size_t SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[]);
+    size_t CountChecked() const;
+    size_t CountPopulated() const;
+    CubeStorage* Clone() const;
+
+protected:
+
+    void ResetStamps();
+
+private:
+
+    unique_ptr<MappedFileClass> mapping;    // The mapped file, none once copied
+    vector<TypeInt> copiedTypes;            // The types once copied out of a mapping
+    TypeInt* typePlane;                     // The integer index of the CellType of every cell
+    vector<uint64_t> statusBits;            // One bit per cell, set when the cell is checked
+    vector<StatusStamp> wordStamps;         // The generation of each status word, unchecked if not current
+
+}; // end MappedStorage
+
+
+
+// Every cell is a CellRec, kept in bricks whose cells follow a Morton curve
+class TiledStorage : public CubeStorage
+{
+public:
+
+    // O(N^3) : Constructor
+    // Purpose: Allocates every brick with the desired starting values
+    // Pre: Every dimension is greater than 0, the value every cell starts with
+    // Post: Every cell holds initCell, the cells past the cube are unchecked and unpopulated
+    TiledStorage(/*IN*/const int& numRows,         // The amount of rows
+                 /*IN*/const int& numCols,         // The amount of columns
+                 /*IN*/const int& numDeps,         // The amount of faces
+                 /*IN*/const CellRec& initCell);   // The value every cell starts with
+
+    bool GetStatus(/*IN*/const LocationRec& cell) const;
+    bool SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat);
+    bool GetPopulated(/*IN*/const LocationRec& cell) const;
+    CellType GetType(/*IN*/const LocationRec& cell) const;
+    void SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType);
+    void GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const;
+    size_t SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[]);
+    size_t CountChecked() const;
+    size_t CountPopulated() const;
+    CubeStorage* Clone() const;
+
+protected:
+
+    void ResetStamps();
+
+private:
+
+    vector<CellRec> cubeArr;    // The cells of every brick, brick by brick
+    size_t brickCols;           // The amount of bricks along the columns
+    size_t brickDeps;           // The amount of bricks along the faces
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets where a cell is kept in brick order
+    // Pre: The cell is within the cube
+    // Post: The first cell of the cell's brick plus the Morton index of the cell within
+    //       the brick, x then y then z bits from the highest, is returned
+    size_t TiledIndex(/*IN*/const int& x,          // The row of the cell
+                      /*IN*/const int& y,          // The column of the cell
+                      /*IN*/const int& z) const    // The face of the cell
+    {
+        return ((((size_t)(x >> BRICK_SHIFT) * brickCols + (size_t)(y >> BRICK_SHIFT)) * brickDeps
+                 + (size_t)(z >> BRICK_SHIFT)) << BRICK_CELL_SHIFT)
+               | MORTON_SPREAD[x & BRICK_MASK] << 2 | MORTON_SPREAD[y & BRICK_MASK] << 1
+               | MORTON_SPREAD[z & BRICK_MASK];
+    }
+
+}; // end TiledStorage
+
+
+
+// Struct to contain a chunk of a ChunkedStorage, a single value while its cells are alike
+struct ChunkRec
+{
+    CellType uniformType;           // The type of every cell while types is empty, EMPTY_WORD for none
+    bool uniformStatus;             // The status of every cell while statusBits is empty
+    StatusStamp statusStamp;        // The generation of the status, every cell unchecked if not current
+    vector<CellType> types;         // The type of every cell of the chunk, EMPTY_WORD for none
+    vector<uint64_t> statusBits;    // One bit per cell of the chunk, set when the cell is checked
+};
+
+
+
+// The cells of a cube split into chunks, how the chunks are kept is left to the storage
+class ChunkStorageBase : public CubeStorage
+{
+protected:
+
+    // O(1) : Constructor
+    // Purpose: Records the chunks along each dimension and the value every chunk starts with
+    // Pre: Every dimension is greater than 0, the value every cell starts with
+    // Post: initChunk is a single value holding initCell
+    ChunkStorageBase(/*IN*/const int& numRows,        // The amount of rows
+                     /*IN*/const int& numCols,        // The amount of columns
+                     /*IN*/const int& numDeps,        // The amount of faces
+                     /*IN*/const CellRec& initCell);  // The value every cell starts with
+
+    ChunkRec initChunk;     // The value every chunk starts with
+    int chunkCols;          // The amount of chunks along the columns
+    int chunkDeps;          // The amount of chunks along the faces
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the chunk of a cell
+    // Pre: The cell is within the cube
+    // Post: The row major index of the chunk holding the cell is returned
+    size_t ChunkIndex(/*IN*/const int& x,          // The row of the cell
+                      /*IN*/const int& y,          // The column of the cell
+                      /*IN*/const int& z) const    // The face of the cell
+    {
+        return ((size_t)(x >> CHUNK_SHIFT) * (size_t)chunkCols + (size_t)(y >> CHUNK_SHIFT))
+               * (size_t)chunkDeps + (size_t)(z >> CHUNK_SHIFT);
+    }
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the place of a cell within its chunk
+    // Pre: The cell is within the cube
+    // Post: The row major index of the cell within its chunk is returned
+    size_t PlaceIndex(/*IN*/const int& x,          // The row of the cell
+                      /*IN*/const int& y,          // The column of the cell
+                      /*IN*/const int& z) const    // The face of the cell
+    {
+        return (size_t)((x & CHUNK_MASK) << (2 * CHUNK_SHIFT) | (y & CHUNK_MASK) << CHUNK_SHIFT
+                        | (z & CHUNK_MASK));
+    }
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the cells of a chunk within the cube along each dimension
+    // Pre: The chunk is within the cube
+    // Post: Each amount is CHUNK_EDGE, less for the last chunk of a dimension it does not fill
+    void ChunkExtents(/*IN*/const size_t& chunkIndex,      // The index of the chunk
+                      /*OUT*/int& rowAmt,                  // The rows of the chunk within the cube
+                      /*OUT*/int& colAmt,                  // The columns of the chunk within the cube
+                      /*OUT*/int& depAmt) const;           // The faces of the chunk within the cube
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the status of a cell of a chunk
+    // Pre: The place of the cell within the chunk
+    // Post: Return true if the cell is checked in the current generation
+    bool ChunkStatus(/*IN*/const ChunkRec& chunk,          // The chunk of the cell
+                     /*IN*/const size_t& place) const;     // The place of the cell within the chunk
+
+    // O(CHUNK_CELLS / 64) : Mutator
+    // Purpose: Sets the status of a cell of a chunk
+    // Pre: The place of the cell within the chunk
+    // Post: The cell holds stat in the current generation, the chunk only gets a bitset
+    //       once a cell differs. Return true if the status of the cell changed
+    bool WriteStatus(/*IN/OUT*/ChunkRec& chunk,            // The chunk of the cell
+                     /*IN*/const size_t& place,           // The place of the cell within the chunk
+                     /*IN*/const bool& stat);              // The status of the cell
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type of a cell of a chunk
+    // Pre: The place of the cell within the chunk
+    // Post: The type of the cell is returned, EMPTY_WORD if it has none
+    CellType ChunkType(/*IN*/const ChunkRec& chunk,        // The chunk of the cell
+                       /*IN*/const size_t& place) const;   // The place of the cell within the chunk
+
+    // O(CHUNK_CELLS) : Mutator
+    // Purpose: Sets the type of a cell of a chunk
+    // Pre: The place of the cell within the chunk
+    // Post: The cell holds currType, the chunk only gets a type per cell once a cell differs
+    void WriteType(/*IN/OUT*/ChunkRec& chunk,              // The chunk of the cell
+                   /*IN*/const size_t& place,             // The place of the cell within the chunk
+                   /*IN*/const CellType& currType);       // The type of the cell
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type every cell of a chunk holds
+    // Pre: None
+    // Post: The integer index of the type of the chunk is returned, EMPTY_CELL if it is not a
+    //       single type or has no type
+    int UniformType(/*IN*/const ChunkRec& chunk) const;    // The chunk being read
+
+    // O(CHUNK_EDGE) : Observer Accessor
+    // Purpose: Gets the types of the part of a row within a chunk
+    // Pre: The place of the first cell of the part, k < partEnd <= deps
+    // Post: rowTypes[k] to rowTypes[partEnd - 1] hold the types of the part, EMPTY_CELL
+    //       for a cell with no type
+    void ReadRowPart(/*IN*/const ChunkRec& chunk,          // The chunk of the part
+                     /*IN*/const size_t& place,           // The place of the first cell of the part
+                     /*IN*/const int& k,                  // The face of the first cell of the part
+                     /*IN*/const int& partEnd,            // The face after the last cell of the part
+                     /*OUT*/int rowTypes[]) const;        // The types of the row
+
+    // O(CHUNK_EDGE) : Observer Predicator
+    // Purpose: Checks if the part of a range of types within a chunk leaves it unchanged
+    // Pre: The types of the part
+    // Post: Return true if the chunk is a single type and every type of the part is it
+    bool PartAlike(/*IN*/const ChunkRec& chunk,            // The chunk of the part
+                   /*IN*/const int cellTypes[],           // The types of the part
+                   /*IN*/const size_t& partAmt) const;    // The amount of cells in the part
+
+    // O(CHUNK_EDGE) : Mutator
+    // Purpose: Sets the types of the part of a range within a chunk
+    // Pre: The chunk holds a type per cell, the place of the first cell of the part
+    // Post: The cells of the part hold their types, the amount of them that had no type
+    //       is returned
+    size_t WritePart(/*IN/OUT*/ChunkRec& chunk,            // The chunk of the part
+                     /*IN*/const size_t& place,           // The place of the first cell of the part
+                     /*IN*/const int cellTypes[],         // The types of the part
+                     /*IN*/const size_t& partAmt);        // The amount of cells in the part
+
+    // O(CHUNK_CELLS) : Observer Accessor
+    // Purpose: Counts the checked cells of a chunk within the cube
+    // Pre: The chunk is within the cube
+    // Post: The amount of cells of the chunk checked in the current generation is returned
+    size_t CountChunkChecked(/*IN*/const ChunkRec& chunk,              // The chunk being counted
+                             /*IN*/const size_t& chunkIndex) const;    // The index of the chunk
+
+    // O(CHUNK_CELLS) : Observer Accessor
+    // Purpose: Counts the cells of a chunk within the cube that have a type
+    // Pre: The chunk is within the cube
+    // Post: The amount of cells of the chunk that have a type is returned
+    size_t CountChunkPopulated(/*IN*/const ChunkRec& chunk,            // The chunk being counted
+                               /*IN*/const size_t& chunkIndex) const;  // The index of the chunk
+
+    // O(CHUNK_CELLS) : Mutator
+    // Purpose: Collapses a chunk whose cells are alike
+    // Pre: The chunk is within the cube
+    // Post: If the cells of the chunk within the cube hold one type the chunk is a single
+    //       type, if they hold one status a single status, and their memory is released
+    void CompactChunk(/*IN/OUT*/ChunkRec& chunk,           // The chunk being collapsed
+                      /*IN*/const size_t& chunkIndex);    // The index of the chunk
+
+    // O(CHUNK_CELLS) : Mutator
+    // Purpose: Gives every cell of a chunk its own type
+    // Pre: The chunk is a single type
+    // Post: types holds the single type for every cell of the chunk
+    void ExpandTypes(/*IN/OUT*/ChunkRec& chunk);           // The chunk being expanded
+
+    // O(CHUNK_CELLS / 64) : Mutator
+    // Purpose: Gives every cell of a chunk its own status
+    // Pre: The chunk is a single status
+    // Post: statusBits holds the single status for every cell of the chunk
+    void ExpandStatus(/*IN/OUT*/ChunkRec& chunk);          // The chunk being expanded
+
+    // O(1) : Mutator
+    // Purpose: Makes a chunk whose status is of an earlier generation unchecked
+    // Pre: None
+    // Post: The chunk is a single status, unchecked in the current generation, if its
+    //       status was of an earlier one. Otherwise it is unchanged
+    void RefreshStatus(/*IN/OUT*/ChunkRec& chunk);         // The chunk being refreshed
+
+}; // end ChunkStorageBase
+
+
+
+// The cells are chunks that are a single value while their cells are alike
+class ChunkedStorage : public ChunkStorageBase
+{
+public:
+
+    // O(N^3 / CHUNK_CELLS) : Constructor
+    // Purpose: Allocates every chunk as a single value
+    // Pre: Every dimension is greater than 0, the value every cell starts with
+    // Post: Every cell holds initCell, every chunk is a single value
+    ChunkedStorage(/*IN*/const int& numRows,       // The amount of rows
+                   /*IN*/const int& numCols,       // The amount of columns
+                   /*IN*/const int& numDeps,       // The amount of faces
+                   /*IN*/const CellRec& initCell); // The value every cell starts with
+
+    // O(N^3) : Copy Constructor
+    // Purpose: Creates a deep copy of orig
+    // Pre: orig holds the cells to be copied
+    // Post: The chunks are copied, each with a lock of its own
+    ChunkedStorage(/*IN*/const ChunkedStorage& orig);  // The storage being copied
+
+    bool GetStatus(/*IN*/const LocationRec& cell) const;
+    bool SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat);
+    bool GetPopulated(/*IN*/const LocationRec& cell) const;
+    int GetChunkType(/*IN*/const int& x, /*IN*/const int& y, /*IN*/const int& z) const;
+    CellType GetType(/*IN*/const LocationRec& cell) const;
+    void SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType);
+    void GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const;
+    size_t SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[]);
+    size_t CountChecked() const;
+    size_t CountPopulated() const;
+    CubeStorage* Clone() const;
+
+    // O(N^3) : Mutator
+    // Purpose: Collapses every chunk whose cells are alike
+    // Pre: No other thread is using the storage
+    // Post: A chunk whose cells within the cube hold one type is a single type, a chunk whose
+    //       cells hold one status is a single status, and their memory is released
+    void Compact();
+
+protected:
+
+    void ResetStamps();
+
+private:
+
+    vector<ChunkRec> chunks;            // Every chunk of the cube, row major
+    unique_ptr<mutex[]> chunkLocks;     // The lock of each chunk, held while SetCellTypes writes it
+
+}; // end ChunkedStorage
+
+
+
+// The chunks of a ChunkedStorage that hold a cell unlike the starting value, in a hash table
+class SparseStorage : public ChunkStorageBase
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Records the starting value, no chunk is allocated
+    // Pre: Every dimension is greater than 0, the value every cell starts with
+    // Post: Every cell holds initCell, the table holds no chunk
+    SparseStorage(/*IN*/const int& numRows,        // The amount of rows
+                  /*IN*/const int& numCols,        // The amount of columns
+                  /*IN*/const int& numDeps,        // The amount of faces
+                  /*IN*/const CellRec& initCell);  // The value every cell starts with
+
+    // O(M) : Copy Constructor, M the amount of cells in the table
+    // Purpose: Creates a deep copy of orig
+    // Pre: orig holds the cells to be copied
+    // Post: The table is copied, with a lock of its own
+    SparseStorage(/*IN*/const SparseStorage& orig);    // The storage being copied
+
+    bool GetStatus(/*IN*/const LocationRec& cell) const;
+    bool SetStatus(/*IN*/const LocationRec& cell, /*IN*/const bool& stat);
+    bool GetPopulated(/*IN*/const LocationRec& cell) const;
+    bool RowHasTypes(/*IN*/const int& x, /*IN*/const int& y) const;
+    int GetChunkType(/*IN*/const int& x, /*IN*/const int& y, /*IN*/const int& z) const;
+    CellType GetType(/*IN*/const LocationRec& cell) const;
+    void SetType(/*IN*/const LocationRec& cell, /*IN*/const CellType& currType);
+    void GetRowTypes(/*IN*/const int& x, /*IN*/const int& y, /*OUT*/int rowTypes[]) const;
+    size_t SetCellTypes(/*IN*/const size_t& first, /*IN*/const size_t& amount, /*IN*/const int cellTypes[]);
+    size_t CountChecked() const;
+    size_t CountPopulated() const;
+    CubeStorage* Clone() const;
+
+    // O(M) : Mutator, M the amount of cells in the table
+    // Purpose: Collapses every chunk whose cells are alike, and removes the chunks that
+    //          came to hold the starting value
+    // Pre: No other thread is using the storage
+    // Post: A chunk of the table whose cells within the cube hold one type or one status is a
+    //       single value, a chunk holding only the starting value is no longer in the table
+    void Compact();
+
+protected:
+
+    void ResetStamps();
+
+private:
+
+    unordered_map<size_t, ChunkRec> chunks;     // Every chunk unlike initChunk, by its row major index
+    mutex chunksLock;                           // Held while SetCellTypes finds or adds a chunk
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets a chunk, in the table or not
+    // Pre: The chunk is within the cube
+    // Post: The chunk of the table is returned, initChunk if it is not in the table
+    const ChunkRec& FindChunk(/*IN*/const size_t& chunkIndex) const;   // The index of the chunk
+
+    // O(1) : Mutator
+    // Purpose: Gets a chunk of the table, adding it if needed
+    // Pre: The chunk is within the cube
+    // Post: The chunk of the table is returned, added as initChunk if it was not in the table
+    ChunkRec& AddChunk(/*IN*/const size_t& chunkIndex);                // The index of the chunk
+
+}; // end SparseStorage
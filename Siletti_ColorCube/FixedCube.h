@@ -0,0 +1,751 @@
+#pragma once
+/*
+    FileName : FixedCube.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications and the definitions of the fixed form of the Cube Class,
+        BasicCubeClass<Rows, Cols, Deps, Cell>. Its dimensions and cell record are chosen
+        when the program is compiled, so the cells are held in place inside the object
+        and every method is defined here, inline. Indexing is folded into constants and
+        a bounds check is three compares against constants, with no call through the
+        storage. It is meant for the many small cubes of a batch or of the default size.
+
+        The dynamic form, CubeClass, is BasicCubeClass with every extent DYNAMIC_EXTENT
+        (see Cube.h). Both forms have the same methods for reading and writing cells, so
+        the client's populate and search functions are templates that take either.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Every extent is greater than 0. Fixed and dynamic extents can not be mixed
+        2 - Cell holds the fields type, status and populated, as CellRec does (see Cube.h).
+            status is a StatusStamp, a cell is checked while it holds the generation of
+            the cube, so ClearStatus only starts a new generation
+        3 - The cells are inside the object, a cube of many cells should be allocated
+            with new rather than on the stack
+        4 - The cells are always records, so a constructor takes no storage type or amount
+            of types as CubeClass's do. GetStorage returns RECORD_STORAGE
+        5 - A fixed cube is never opened from a cube file and never keeps its contiguous
+            blocks current, those need CubeClass
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - OutOfBoundsException thrown when invalid location is sent in
+        2 - EmptyTypeException thrown when GetType is called on a cell with no specified type
+        3 - InvalidDimensionException thrown when a cube is constructed with dimensions other
+            than its extents
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        BasicCubeClass() - Instantiates a Rows x Cols x Deps cube,
+                           populated and status get set to false in every cell
+        BasicCubeClass(*IN*const int& numRows,
+                       *IN*const int& numCols,
+                       *IN*const int& numDeps)
+                  -  Instantiates the cube after checking the dimensions are its extents
+        BasicCubeClass(*IN*const int& numRows,
+                       *IN*const int& numCols,
+                       *IN*const int& numDeps,
+                       *IN*const TypeOfCell& typeOfCell,
+                       *IN*const bool& state)
+                  -  Instantiates the cube to specified values for every cell's status and type
+        BasicCubeClass(*IN*const BasicCubeClass& orig) - Creates a copy of orig
+        BasicCubeClass& operator = (*IN*const BasicCubeClass& orig) - Creates a copy of orig
+        StorageEnum GetStorage() const - Gets how the cells of the cube are stored
+        int GetRows() const - Gets the amount of rows in the cube
+        int GetCols() const - Gets the amount of columns in the cube
+        int GetDeps() const - Gets the amount of faces in the cube
+        size_t GetCellCount() const - Gets the amount of cells in the cube
+        bool GetStatus(*IN*const LocationRec& cell) const - Gets the status of a cell
+        void SetStatus(*IN*const LocationRec& cell,
+                       *IN*const bool& stat) - Sets the status of a cell
+        TypeOfCell GetType(*IN*const LocationRec& cell) const - Gets the type of the specified cell
+        void SetType(*IN*const LocationRec& cell,
+                     *IN*const TypeOfCell& currType) - Sets the type of the specified cell
+        void ClearStatus() - Sets the status of every cell to unchecked
+        bool CubeStatus() const - Checks the status of the cube
+        bool CubePopStatus() const - Checks the population status of the cube
+        void Compact() - Does nothing, the cells are always records
+        bool RowHasTypes(*IN*const int& x,
+                         *IN*const int& y) const - Returns true, every row is read
+        int GetChunkType(*IN*const int& x,
+                         *IN*const int& y,
+                         *IN*const int& z) const - Returns EMPTY_CELL, no chunk is kept
+        void GetRowTypes(*IN*const int& x,
+                         *IN*const int& y,
+                         *OUT*int rowTypes[]) const
+                  -  Gets the type of every cell along the depth of a row
+        void SetCellTypes(*IN*const size_t& first,
+                          *IN*const size_t& amount,
+                          *IN*const int cellTypes[])
+                  -  Sets the type of a range of cells in storage order
+
+    PRIVATE MEMBERS:
+        Cell cells[CELL_AMT];               // Every cell of the cube, in storage order
+        StatusStamp generation;             // The stamp of a cell checked since the last ClearStatus
+        size_t checkedAmt;                  // The amount of checked cells
+        atomic<size_t> populatedAmt;        // The amount of populated cells
+
+        bool InvalidLocation(*IN*const LocationRec& cell) const - Checks if the cell location is valid
+        size_t CellIndex(*IN*const LocationRec& cell) const - Gets the linear index of a cell
+        void Fill(*IN*const Cell& initCell) - Sets every cell to initCell
+*/
+
+#include "Cube.h"   // Grants Access to the dynamic Cube Class and the cube exceptions
+#include "Instrument.h" // Grants Access to the instrumentation counters
+#include <algorithm>    // Gives access to the copy of the cells
+
+using namespace std;
+
+
+
+template <int Rows, int Cols, int Deps, class Cell>
+class BasicCubeClass
+{
+    static_assert(Rows > ZERO && Cols > ZERO && Deps > ZERO,
+                  "A fixed cube needs every extent, fixed and dynamic extents can not be mixed");
+
+public:
+
+    typedef decltype(Cell::type) TypeOfCell;    // The type held by every cell
+
+    static const size_t CELL_AMT = (size_t)Rows * Cols * Deps;     // The amount of cells in the cube
+
+
+    // O(N^3) : Default Constructor
+    // Purpose: Instantiates a Rows x Cols x Deps cube
+    //          populated and status get set to false in every cell.
+    // Pre: None
+    // Post: Populated is set to false in every cell
+    //       Status is set to false in every cell
+    BasicCubeClass();
+
+
+    // O(N^3) : Non-Default Constructor
+    // Purpose: Instantiates the cube after checking the dimensions are its extents
+    //          populated and status get set to false in every cell.
+    // Pre: The dimensions of the cube
+    // Post: Populated is set to false in every cell
+    //       Status is set to false in every cell
+    // Exception: InvalidDimensionException is thrown if the dimensions are not Rows, Cols and Deps
+    BasicCubeClass(/*IN*/const int& numRows,     // The desired amount of rows
+                   /*IN*/const int& numCols,     // The desired amount of columns
+                   /*IN*/const int& numDeps);    // The desired amount of faces
+
+
+    // O(N^3) : Non-Default Constructor
+    // Purpose: Instantiates the cube to specified values for every cell's status and type
+    //          Every cell's populated datatype gets set to true
+    // Pre: The dimensions of the cube and the desired values for all cell's type and status
+    // Post: Populated gets set to true
+    //       status and type are set to their desired values
+    // Exception: InvalidDimensionException is thrown if the dimensions are not Rows, Cols and Deps
+    BasicCubeClass(/*IN*/const int& numRows,             // The desired amount of rows
+                   /*IN*/const int& numCols,             // The desired amount of columns
+                   /*IN*/const int& numDeps,             // The desired amount of faces
+                   /*IN*/const TypeOfCell& typeOfCell,   // The desired type
+                   /*IN*/const bool& state);             // The desired status value
+
+
+    // O(N^3) : Copy Constructor
+    // Purpose: Creates a copy of orig
+    // Pre: orig contains a cube to be copied
+    // Post: The cube holds a copy of every cell of orig
+    BasicCubeClass(/*IN*/const BasicCubeClass& orig);     // The cube being copied
+
+
+    // O(N^3) : Overloaded Operator
+    // Purpose: Creates a copy of orig
+    // Pre: orig contains a cube to be copied
+    // Post: The applying cube holds a copy of every cell of orig
+    BasicCubeClass& operator = (/*IN*/const BasicCubeClass& orig);    // The cube being copied
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets how the cells of the cube are stored
+    // Pre: Cube Exist
+    // Post: RECORD_STORAGE is returned
+    StorageEnum GetStorage() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of rows in the cube
+    // Pre: Cube Exist
+    // Post: Rows is returned
+    int GetRows() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of columns in the cube
+    // Pre: Cube Exist
+    // Post: Cols is returned
+    int GetCols() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of faces in the cube
+    // Pre: Cube Exist
+    // Post: Deps is returned
+    int GetDeps() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of cells in the cube
+    // Pre: Cube Exist
+    // Post: CELL_AMT is returned
+    size_t GetCellCount() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Checks the status of a cell
+    // Pre: Cube Exist, the location of the cell who's status is being returned
+    // Post: Return true if the cell has been checked, otherwise false
+    // Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+    bool GetStatus(/*IN*/const LocationRec& cell) const;    // The desired cell location
+
+
+    // O(1) : Mutator
+    // Purpose: Sets the status of a cell
+    // Pre: Cube Exist, the location of the cell who's status is being changed,
+    //                  the desired status
+    // Post: Sets the status of the cell to the desired status
+    // Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+    void SetStatus(/*IN*/const LocationRec& cell,    // The desired cell location
+                   /*IN*/const bool& stat);          // The desired status
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type of the specified cell
+    // Pre: Cube Exist, the location of the cell
+    // Post: The cell's type is returned
+    // Exception: EmptyTypeException is thrown if the cell has no current type
+    //            OutOfBoundsException is thrown if the desired cell location is not within the cube
+    TypeOfCell GetType(/*IN*/const LocationRec& cell) const;    // The desired cell location
+
+
+    // O(1) : Mutator
+    // Purpose: Sets the type of the specified cell
+    // Pre: Cube Exist, the desired cell and the type
+    // Post: The cell's type is updated to the desired type,
+    //       if the cell had no prior type, populated gets set to true for that cell
+    // Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+    void SetType(/*IN*/const LocationRec& cell,         // The desired cell location
+                 /*IN*/const TypeOfCell& currType);    // The desired type of the cell
+
+
+    // O(1) : Mutator
+    // Purpose: Sets the status of every cell to unchecked by starting a new generation,
+    //          every 255th clear resets the stamps
+    // Pre: No other thread is using the cube
+    // Post: Status is set to false in every cell, the types are unchanged
+    void ClearStatus();
+
+
+    // O(1) : Observer Summarizer
+    // Purpose: Checks the status of the cube
+    // Pre: Cube Exist
+    // Post: Return true if every cell has been checked, otherwise false
+    bool CubeStatus() const;
+
+
+    // O(1) : Observer Summarizer
+    // Purpose: Check the population status of the cube
+    // Pre: Cube Exist
+    // Post: Return true if every cell has been populated, otherwise false
+    bool CubePopStatus() const;
+
+
+    // O(1) : Mutator
+    // Purpose: Matches CubeClass::Compact, the cells are always records
+    // Pre: None
+    // Post: The cube is unchanged
+    void Compact();
+
+
+    // O(1) : Observer Predicator
+    // Purpose: Matches CubeClass::RowHasTypes, a row of records is always read
+    // Pre: The row is within the cube
+    // Post: Return true
+    bool RowHasTypes(/*IN*/const int& x,          // The row of the desired cells
+                     /*IN*/const int& y) const;   // The column of the desired cells
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Matches CubeClass::GetChunkType, the records are not kept in chunks
+    // Pre: The cell is within the cube
+    // Post: Return EMPTY_CELL
+    int GetChunkType(/*IN*/const int& x,          // The row of the cell
+                     /*IN*/const int& y,          // The column of the cell
+                     /*IN*/const int& z) const;   // The face of the cell
+
+
+    // O(N) : Observer Accessor
+    // Purpose: Gets the type of every cell along the depth of a row
+    // Pre: Cube Exist, rowTypes can hold Deps values
+    // Post: rowTypes[z] holds the integer index of the type of cell (x, y, z),
+    //       or EMPTY_CELL if the cell has no type
+    // Exception: OutOfBoundsException is thrown if the row is not within the cube
+    void GetRowTypes(/*IN*/const int& x,          // The row of the desired cells
+                     /*IN*/const int& y,          // The column of the desired cells
+                     /*OUT*/int rowTypes[]) const; // The type of each cell in the row
+
+
+    // O(N) : Mutator
+    // Purpose: Sets the type of a range of cells in storage order
+    // Pre: Cube Exist, cellTypes holds amount types that are not EMPTY_CELL
+    // Post: The cell with linear index first + i holds type cellTypes[i] and is populated.
+    //       Ranges that do not overlap may be set by separate threads at once
+    // Exception: OutOfBoundsException is thrown if the range is not within the cube
+    void SetCellTypes(/*IN*/const size_t& first,           // The linear index of the first cell
+                      /*IN*/const size_t& amount,          // The amount of cells
+                      /*IN*/const int cellTypes[]);        // The type of each cell
+
+
+private:
+
+    // PDMs
+    Cell cells[CELL_AMT];               // Every cell of the cube, in storage order
+    StatusStamp generation;             // The stamp of a cell checked since the last ClearStatus
+    size_t checkedAmt;                  // The amount of checked cells
+    atomic<size_t> populatedAmt;        // The amount of populated cells
+
+
+    // O(1) : Observer Predicator
+    // Purpose: Checks if the cell location is valid
+    // Pre: Cube Exist
+    // Post: Return true if the location is invalid, otherwise false
+    bool InvalidLocation(/*IN*/const LocationRec& cell) const;   // The desired cell location
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the linear index of a cell
+    // Pre: The cell location is valid
+    // Post: ((x * Cols) + y) * Deps + z is returned
+    size_t CellIndex(/*IN*/const LocationRec& cell) const;     // The desired cell location
+
+
+    // O(N^3) : Mutator
+    // Purpose: Sets every cell to initCell
+    // Pre: The status of initCell is NO_STAMP or FIRST_STAMP
+    // Post: Every cell holds initCell, the generation is FIRST_STAMP and the amount
+    //       checked and populated count every cell or none
+    void Fill(/*IN*/const Cell& initCell);     // The value every cell starts with
+
+}; // end BasicCubeClass
+
+
+typedef BasicCubeClass<DEFAULT_ROW, DEFAULT_COL, DEFAULT_DEP> DefaultCubeClass;     // The cube of the default dimensions
+
+
+
+// Pre: None
+// Post: Populated is set to false in every cell
+//       Status is set to false in every cell
+template <int Rows, int Cols, int Deps, class Cell>
+inline BasicCubeClass<Rows, Cols, Deps, Cell>::BasicCubeClass()
+{
+    Cell emptyCell = Cell();    // The value every cell starts with
+
+    // Populated and Status get set to false
+    emptyCell.populated = false;
+    emptyCell.status = NO_STAMP;
+
+    Fill(emptyCell);
+}// end DC
+
+
+
+// Pre: The dimensions of the cube
+// Post: Populated is set to false in every cell
+//       Status is set to false in every cell
+// Exception: InvalidDimensionException is thrown if the dimensions are not Rows, Cols and Deps
+template <int Rows, int Cols, int Deps, class Cell>
+inline BasicCubeClass<Rows, Cols, Deps, Cell>::BasicCubeClass(/*IN*/const int& numRows,     // The desired amount of rows
+                                                               /*IN*/const int& numCols,     // The desired amount of columns
+                                                               /*IN*/const int& numDeps)     // The desired amount of faces
+    : BasicCubeClass()
+{
+    // Check to see if the dimensions are the extents
+    if (numRows != Rows || numCols != Cols || numDeps != Deps)
+        throw InvalidDimensionException();
+}// end NDC
+
+
+
+// Pre: The dimensions of the cube and the desired values for all cell's type and status
+// Post: Populated gets set to true
+//       status and type are set to their desired values
+// Exception: InvalidDimensionException is thrown if the dimensions are not Rows, Cols and Deps
+template <int Rows, int Cols, int Deps, class Cell>
+inline BasicCubeClass<Rows, Cols, Deps, Cell>::BasicCubeClass(/*IN*/const int& numRows,             // The desired amount of rows
+                                                               /*IN*/const int& numCols,             // The desired amount of columns
+                                                               /*IN*/const int& numDeps,             // The desired amount of faces
+                                                               /*IN*/const TypeOfCell& typeOfCell,   // The desired type
+                                                               /*IN*/const bool& state)              // The desired status value
+{
+    Cell fullCell = Cell();     // The value every cell starts with
+
+    // Check to see if the dimensions are the extents
+    if (numRows != Rows || numCols != Cols || numDeps != Deps)
+        throw InvalidDimensionException();
+
+    // Populated gets set to true
+    fullCell.populated = true;
+    // Status and type get their desired values
+    fullCell.status = state ? FIRST_STAMP : NO_STAMP;
+    fullCell.type = typeOfCell;
+
+    Fill(fullCell);
+}// end NDC
+
+
+
+// Pre: orig contains a cube to be copied
+// Post: The cube holds a copy of every cell of orig
+template <int Rows, int Cols, int Deps, class Cell>
+inline BasicCubeClass<Rows, Cols, Deps, Cell>::BasicCubeClass(/*IN*/const BasicCubeClass& orig)     // The cube being copied
+    : generation(orig.generation), checkedAmt(orig.checkedAmt), populatedAmt(orig.populatedAmt.load())
+{
+    copy(orig.cells, orig.cells + CELL_AMT, cells);
+}// end Copy Constructor
+
+
+
+// Pre: orig contains a cube to be copied
+// Post: The applying cube holds a copy of every cell of orig
+template <int Rows, int Cols, int Deps, class Cell>
+inline BasicCubeClass<Rows, Cols, Deps, Cell>&
+BasicCubeClass<Rows, Cols, Deps, Cell>::operator = (/*IN*/const BasicCubeClass& orig)    // The cube being copied
+{
+    if (this != &orig)
+    {
+        copy(orig.cells, orig.cells + CELL_AMT, cells);
+        generation = orig.generation;
+        checkedAmt = orig.checkedAmt;
+        populatedAmt = orig.populatedAmt.load();
+    }
+
+    return *this;
+}// end operator =
+
+
+
+// Pre: Cube Exist
+// Post: RECORD_STORAGE is returned
+template <int Rows, int Cols, int Deps, class Cell>
+inline StorageEnum BasicCubeClass<Rows, Cols, Deps, Cell>::GetStorage() const
+{
+    return RECORD_STORAGE;
+}// end GetStorage
+
+
+
+// Pre: Cube Exist
+// Post: Rows is returned
+template <int Rows, int Cols, int Deps, class Cell>
+inline int BasicCubeClass<Rows, Cols, Deps, Cell>::GetRows() const
+{
+    return Rows;
+}// end GetRows
+
+
+
+// Pre: Cube Exist
+// Post: Cols is returned
+template <int Rows, int Cols, int Deps, class Cell>
+inline int BasicCubeClass<Rows, Cols, Deps, Cell>::GetCols() const
+{
+    return Cols;
+}// end GetCols
+
+
+
+// Pre: Cube Exist
+// Post: Deps is returned
+template <int Rows, int Cols, int Deps, class Cell>
+inline int BasicCubeClass<Rows, Cols, Deps, Cell>::GetDeps() const
+{
+    return Deps;
+}// end GetDeps
+
+
+
+// Pre: Cube Exist
+// Post: CELL_AMT is returned
+template <int Rows, int Cols, int Deps, class Cell>
+inline size_t BasicCubeClass<Rows, Cols, Deps, Cell>::GetCellCount() const
+{
+    return CELL_AMT;
+}// end GetCellCount
+
+
+
+// Pre: Cube Exist, the location of the cell who's status is being returned
+// Post: Return true if the cell has been checked, otherwise false
+// Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+template <int Rows, int Cols, int Deps, class Cell>
+inline bool BasicCubeClass<Rows, Cols, Deps, Cell>::GetStatus(/*IN*/const LocationRec& cell) const   // The desired cell location
+{
+    // Check to see if the cell location is valid
+    if (InvalidLocation(cell))
+    {
+        INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+        throw OutOfBoundsException();
+    }
+
+    return cells[CellIndex(cell)].status == generation;
+}// end GetStatus
+
+
+
+// Pre: Cube Exist, the location of the cell who's status is being changed,
+//                  the desired status
+// Post: Sets the status of the cell to the desired status
+// Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::SetStatus(/*IN*/const LocationRec& cell,    // The desired cell location
+                                                              /*IN*/const bool& stat)          // The desired status
+{
+    // Check to see if the cell location is valid
+    if (InvalidLocation(cell))
+    {
+        INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+        throw OutOfBoundsException();
+    }
+
+    Cell& currCell = cells[CellIndex(cell)];    // The cell being set
+
+    // Keep the amount checked current when the status changes
+    if ((currCell.status == generation) != stat)
+    {
+        if (stat)
+            checkedAmt++;
+        else
+            checkedAmt--;
+    }
+
+    currCell.status = stat ? generation : NO_STAMP;
+}// end SetStatus
+
+
+
+// Pre: Cube Exist, the location of the cell
+// Post: The cell's type is returned
+// Exception: EmptyTypeException is thrown if the cell has no current type
+// Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+template <int Rows, int Cols, int Deps, class Cell>
+inline typename BasicCubeClass<Rows, Cols, Deps, Cell>::TypeOfCell
+BasicCubeClass<Rows, Cols, Deps, Cell>::GetType(/*IN*/const LocationRec& cell) const    // The desired cell location
+{
+    // Check to see if the cell location is valid
+    if (InvalidLocation(cell))
+    {
+        INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+        throw OutOfBoundsException();
+    }
+
+    // Check to see if the current cell has a type yet
+    if (!cells[CellIndex(cell)].populated)
+        throw EmptyTypeException();
+
+    return cells[CellIndex(cell)].type;
+}// end GetType
+
+
+
+// Pre: Cube Exist, the desired cell and the type
+// Post: The cell's type is updated to the desired type,
+//       if the cell had no prior type, populated gets set to true for that cell
+// Exception: OutOfBoundsException is thrown if the desired cell location is not within the cube
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::SetType(/*IN*/const LocationRec& cell,         // The desired cell location
+                                                            /*IN*/const TypeOfCell& currType)    // The desired type of the cell
+{
+    // Check to see if the cell location is valid
+    if (InvalidLocation(cell))
+    {
+        INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+        throw OutOfBoundsException();
+    }
+
+    // Count the cell the first time it is given a type
+    if (!cells[CellIndex(cell)].populated)
+        populatedAmt++;
+
+    cells[CellIndex(cell)].type = currType;
+    cells[CellIndex(cell)].populated = true;
+}// end SetType
+
+
+
+// Pre: No other thread is using the cube
+// Post: Status is set to false in every cell, the types are unchanged
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::ClearStatus()
+{
+    // Every stamp is of an earlier generation, once the stamps wrap they are reset so none
+    // is taken for the generation started again
+    if (++generation == NO_STAMP)
+    {
+        for (size_t i = 0; i < CELL_AMT; i++)
+            cells[i].status = NO_STAMP;
+
+        generation = FIRST_STAMP;
+    }
+
+    checkedAmt = ZERO;
+}// end ClearStatus
+
+
+
+// Pre: Cube Exist
+// Post: Return true if every cell has been checked, otherwise false
+template <int Rows, int Cols, int Deps, class Cell>
+inline bool BasicCubeClass<Rows, Cols, Deps, Cell>::CubeStatus() const
+{
+    return checkedAmt == CELL_AMT;
+}// end CubeStatus
+
+
+
+// Pre: Cube Exist
+// Post: Return true if every cell has been populated, otherwise false
+template <int Rows, int Cols, int Deps, class Cell>
+inline bool BasicCubeClass<Rows, Cols, Deps, Cell>::CubePopStatus() const
+{
+    return populatedAmt == CELL_AMT;
+}// end CubePopStatus
+
+
+
+// Pre: None
+// Post: The cube is unchanged
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::Compact()
+{
+}// end Compact
+
+
+
+// Pre: The row is within the cube
+// Post: Return true
+template <int Rows, int Cols, int Deps, class Cell>
+inline bool BasicCubeClass<Rows, Cols, Deps, Cell>::RowHasTypes(/*IN*/const int& /*x*/,          // The row of the desired cells
+                                                                /*IN*/const int& /*y*/) const    // The column of the desired cells
+{
+    return true;
+}// end RowHasTypes
+
+
+
+// Pre: The cell is within the cube
+// Post: Return EMPTY_CELL
+template <int Rows, int Cols, int Deps, class Cell>
+inline int BasicCubeClass<Rows, Cols, Deps, Cell>::GetChunkType(/*IN*/const int& /*x*/,          // The row of the cell
+                                                                /*IN*/const int& /*y*/,          // The column of the cell
+                                                                /*IN*/const int& /*z*/) const    // The face of the cell
+{
+    return EMPTY_CELL;
+}// end GetChunkType
+
+
+
+// Pre: Cube Exist, rowTypes can hold Deps values
+// Post: rowTypes[z] holds the integer index of the type of cell (x, y, z),
+//       or EMPTY_CELL if the cell has no type
+// Exception: OutOfBoundsException is thrown if the row is not within the cube
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::GetRowTypes(/*IN*/const int& x,          // The row of the desired cells
+                                                                /*IN*/const int& y,          // The column of the desired cells
+                                                                /*OUT*/int rowTypes[]) const // The type of each cell in the row
+{
+    LocationRec rowStart;   // The first cell of the row
+
+    rowStart.x = x;
+    rowStart.y = y;
+    rowStart.z = ZERO;
+
+    // Check to see if the row is valid
+    if (InvalidLocation(rowStart))
+    {
+        INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+        throw OutOfBoundsException();
+    }
+
+    const Cell* row = cells + CellIndex(rowStart);  // The cells of the row
+
+    for (int k = 0; k < Deps; k++)
+        rowTypes[k] = row[k].populated ? (int)row[k].type : EMPTY_CELL;
+}// end GetRowTypes
+
+
+
+// Pre: Cube Exist, cellTypes holds amount types that are not EMPTY_CELL
+// Post: The cell with linear index first + i holds type cellTypes[i] and is populated.
+//       Ranges that do not overlap may be set by separate threads at once
+// Exception: OutOfBoundsException is thrown if the range is not within the cube
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::SetCellTypes(/*IN*/const size_t& first,           // The linear index of the first cell
+                                                                 /*IN*/const size_t& amount,          // The amount of cells
+                                                                 /*IN*/const int cellTypes[])         // The type of each cell
+{
+    // Check to see if the range is valid
+    if (first > CELL_AMT || amount > CELL_AMT - first)
+    {
+        INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+        throw OutOfBoundsException();
+    }
+
+    size_t newAmt = ZERO;   // The amount of cells of the range populated for the first time
+
+    for (size_t i = 0; i < amount; i++)
+    {
+        if (!cells[first + i].populated)
+            newAmt++;
+
+        cells[first + i].type = (TypeOfCell)cellTypes[i];
+        cells[first + i].populated = true;
+    }
+
+    populatedAmt += newAmt;
+}// end SetCellTypes
+
+
+
+// Pre: Cube Exist
+// Post: Return true if the location is invalid, otherwise false
+template <int Rows, int Cols, int Deps, class Cell>
+inline bool BasicCubeClass<Rows, Cols, Deps, Cell>::InvalidLocation(/*IN*/const LocationRec& cell) const   // The desired cell location
+{
+    if (cell.x >= Rows || cell.x < ZERO || cell.y >= Cols ||
+        cell.y < ZERO || cell.z >= Deps || cell.z < ZERO)
+        return true;
+
+    return false;
+}// end InvalidLocation
+
+
+
+// Pre: The cell location is valid
+// Post: ((x * Cols) + y) * Deps + z is returned
+template <int Rows, int Cols, int Deps, class Cell>
+inline size_t BasicCubeClass<Rows, Cols, Deps, Cell>::CellIndex(/*IN*/const LocationRec& cell) const     // The desired cell location
+{
+    return ((size_t)cell.x * Cols + (size_t)cell.y) * Deps + (size_t)cell.z;
+}// end CellIndex
+
+
+
+// Pre: The status of initCell is NO_STAMP or FIRST_STAMP
+// Post: Every cell holds initCell, the generation is FIRST_STAMP and the amount
+//       checked and populated count every cell or none
+template <int Rows, int Cols, int Deps, class Cell>
+inline void BasicCubeClass<Rows, Cols, Deps, Cell>::Fill(/*IN*/const Cell& initCell)     // The value every cell starts with
+{
+    for (size_t i = 0; i < CELL_AMT; i++)
+        cells[i] = initCell;
+
+    generation = FIRST_STAMP;
+    checkedAmt = initCell.status != NO_STAMP ? CELL_AMT : ZERO;
+    populatedAmt = initCell.populated ? CELL_AMT : ZERO;
+}// end Fill
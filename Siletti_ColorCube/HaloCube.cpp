@@ -0,0 +1,35 @@
+#include "HaloCube.h"	// Specification file for the Halo Cube class
+#include "Instrument.h"	// Grants Access to the instrumentation counters
+
+
+// Pre: The location of a cell of the cube, not counting the halo
+// Post: The padded index of the cell is returned
+// Exception: OutOfBoundsException is thrown if the location is not within the cube
+size_t HaloCubeClass::GetIndex(/*IN*/const LocationRec& cell) const     // The desired cell location
+{
+	// Check to see if the cell location is valid
+	if (cell.x >= rows || cell.x < ZERO || cell.y >= cols ||
+		cell.y < ZERO || cell.z >= deps || cell.z < ZERO)
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	return (size_t)(cell.x + HALO_WIDTH) * planeStride + (size_t)(cell.y + HALO_WIDTH) * rowStride
+		+ (size_t)(cell.z + HALO_WIDTH);
+}// end GetIndex
+
+
+
+// Pre: The padded index of a real cell
+// Post: The location of the cell, not counting the halo, is returned
+LocationRec HaloCubeClass::GetLocation(/*IN*/const size_t& index) const   // The padded index
+{
+	LocationRec cell;	// The location of the cell
+
+	cell.x = (int)(index / planeStride) - HALO_WIDTH;
+	cell.y = (int)(index % planeStride / rowStride) - HALO_WIDTH;
+	cell.z = (int)(index % rowStride) - HALO_WIDTH;
+
+	return cell;
+}// end GetLocation
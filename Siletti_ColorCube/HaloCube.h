@@ -0,0 +1,197 @@
+#pragma once
+/*
+    FileName : HaloCube.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Halo Cube Class. A halo cube is a copy of the
+        types of a cube of either form (see Cube.h) surrounded by a one cell border (the
+        halo) on every side.
+        The halo cells hold HALO_CELL, a type no real cell can have, and are marked as
+        checked. A search can then step from any real cell in any direction without
+        checking bounds or catching OutOfBoundsException, the step simply lands on a
+        halo cell that never matches.
+
+        Cells are addressed by their padded linear index. Stepping in a direction is
+        adding that direction's entry of the neighbor offset table to the index.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - The halo cube is a snapshot, later changes to the cube are not seen
+        2 - Indexes given to the unchecked accessors are real cells or halo cells, they
+            are never checked
+        3 - The neighbor offsets are in DirectionEnum order
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - OutOfBoundsException thrown when GetIndex is given a location outside the cube
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        HaloCubeClass<Cube>(*IN*const Cube& colCube) - Copies the types of a cube inside a halo
+        size_t GetIndex(*IN*const LocationRec& cell) const - Gets the padded index of a cell
+        LocationRec GetLocation(*IN*const size_t& index) const - Gets the location of a padded index
+        ptrdiff_t GetNeighborOffset(*IN*const DirectionEnum& dir) const
+                  -  Gets the index offset of a step in a direction
+        int GetTypeAt(*IN*const size_t& index) const - Gets the type of a cell, unchecked
+        bool GetStatusAt(*IN*const size_t& index) const - Gets the status of a cell, unchecked
+        void SetStatusAt(*IN*const size_t& index) - Marks a cell as checked, unchecked
+
+    PRIVATE MEMBERS:
+        int rows;                           // The amount of rows in the cube, without the halo
+        int cols;                           // The amount of columns in the cube, without the halo
+        int deps;                           // The amount of faces in the cube, without the halo
+        size_t rowStride;                   // The index offset between neighboring columns (y)
+        size_t planeStride;                 // The index offset between neighboring rows (x)
+        ptrdiff_t neighborOffset[MAX_NUM_DIR];  // The index offset of a step in each direction
+        vector<int> types;                  // The type of every padded cell
+        vector<unsigned char> checked;      // The status of every padded cell
+*/
+
+#include <vector>       // Gives access to the vectors holding the cells
+#include <cstddef>      // Gives access to ptrdiff_t
+#include "Cube.h"       // Grants Access to Cube Class
+
+using namespace std;
+
+
+const int HALO_CELL = -2;   // The type of every cell of the halo, matches no real cell
+const int HALO_WIDTH = 1;   // The amount of halo cells on each side of every dimension
+
+
+
+class HaloCubeClass
+{
+public:
+
+    // O(N^3) : Constructor
+    // Purpose: Copies the types of a cube inside a one cell halo
+    // Pre: The cube being copied, of either form
+    // Post: Every real cell holds its type and is unchecked,
+    //       every halo cell holds HALO_CELL and is checked
+    template <class Cube>
+    HaloCubeClass(/*IN*/const Cube& colCube);          // The cube being copied
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the padded index of a cell of the cube
+    // Pre: The location of a cell of the cube, not counting the halo
+    // Post: The padded index of the cell is returned
+    // Exception: OutOfBoundsException is thrown if the location is not within the cube
+    size_t GetIndex(/*IN*/const LocationRec& cell) const;     // The desired cell location
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the location of a padded index
+    // Pre: The padded index of a real cell
+    // Post: The location of the cell, not counting the halo, is returned
+    LocationRec GetLocation(/*IN*/const size_t& index) const;   // The padded index
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the index offset of a step in a direction
+    // Pre: A valid direction
+    // Post: Adding the returned offset to an index steps once in the direction
+    ptrdiff_t GetNeighborOffset(/*IN*/const DirectionEnum& dir) const    // The desired direction
+    {
+        return neighborOffset[dir];
+    }
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type of a cell without checking the index
+    // Pre: The padded index of a real or halo cell
+    // Post: The type of the cell, EMPTY_CELL or HALO_CELL is returned
+    int GetTypeAt(/*IN*/const size_t& index) const     // The padded index
+    {
+        return types[index];
+    }
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the status of a cell without checking the index
+    // Pre: The padded index of a real or halo cell
+    // Post: Return true if the cell has been checked, halo cells are always checked
+    bool GetStatusAt(/*IN*/const size_t& index) const   // The padded index
+    {
+        return checked[index] != ZERO;
+    }
+
+
+    // O(1) : Mutator
+    // Purpose: Marks a cell as checked without checking the index
+    // Pre: The padded index of a real cell
+    // Post: The cell is checked
+    void SetStatusAt(/*IN*/const size_t& index)         // The padded index
+    {
+        checked[index] = CHECKED;
+    }
+
+
+private:
+
+    // PDMs
+    int rows;                               // The amount of rows in the cube, without the halo
+    int cols;                               // The amount of columns in the cube, without the halo
+    int deps;                               // The amount of faces in the cube, without the halo
+    size_t rowStride;                       // The index offset between neighboring columns (y)
+    size_t planeStride;                     // The index offset between neighboring rows (x)
+    ptrdiff_t neighborOffset[MAX_NUM_DIR];  // The index offset of a step in each direction
+    vector<int> types;                      // The type of every padded cell
+    vector<unsigned char> checked;          // The status of every padded cell
+
+}; // end HaloCubeClass
+
+
+
+// Pre: The cube being copied, of either form
+// Post: Every real cell holds its type and is unchecked,
+//       every halo cell holds HALO_CELL and is checked
+template <class Cube>
+HaloCubeClass::HaloCubeClass(/*IN*/const Cube& colCube)     // The cube being copied
+{
+    size_t paddedDeps;      // The amount of faces including the halo
+    size_t paddedCols;      // The amount of columns including the halo
+    size_t paddedRows;      // The amount of rows including the halo
+    LocationRec rowStart;   // The first real cell of the row being copied
+
+    rows = colCube.GetRows();
+    cols = colCube.GetCols();
+    deps = colCube.GetDeps();
+
+    paddedDeps = (size_t)deps + 2 * HALO_WIDTH;
+    paddedCols = (size_t)cols + 2 * HALO_WIDTH;
+    paddedRows = (size_t)rows + 2 * HALO_WIDTH;
+    rowStride = paddedDeps;
+    planeStride = paddedCols * paddedDeps;
+
+    // Fill in the offsets in DirectionEnum order
+    neighborOffset[NORTH] = OFFSET;
+    neighborOffset[SOUTH] = -OFFSET;
+    neighborOffset[EAST] = (ptrdiff_t)planeStride;
+    neighborOffset[WEST] = -(ptrdiff_t)planeStride;
+    neighborOffset[UP] = (ptrdiff_t)rowStride;
+    neighborOffset[DOWN] = -(ptrdiff_t)rowStride;
+
+    // Every cell starts as a checked halo cell
+    types.assign(paddedRows * planeStride, HALO_CELL);
+    checked.assign(paddedRows * planeStride, CHECKED);
+
+    // Copy the real cells a row at a time and uncheck them
+    rowStart.z = ZERO;
+    for (int i = 0; i < rows; i++)
+    {
+        rowStart.x = i;
+        for (int j = 0; j < cols; j++)
+        {
+            rowStart.y = j;
+
+            size_t index = GetIndex(rowStart);    // The padded index of the first cell of the row
+
+            colCube.GetRowTypes(i, j, &types[index]);
+
+            for (int k = 0; k < deps; k++)
+                checked[index + k] = !CHECKED;
+        }
+    }
+}// end Constructor
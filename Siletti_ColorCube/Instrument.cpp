@@ -0,0 +1,87 @@
+#include "Instrument.h"	// Specification file for the instrumentation counters and timers
+
+// Nothing is built unless the counters are asked for
+#ifdef CUBE_INSTRUMENT
+
+#include <fstream>		// Used to write the report
+#include <iomanip>		// Used to format the milliseconds
+#include <memory>		// Used to own the block of each thread
+#include <mutex>		// Used to guard the list of blocks and the timers
+#include <vector>		// Used to list the block of each thread
+#include "Constants.h"	// Gives access to ZERO and OFFSET
+
+
+const double MS_PER_SECOND = 1000.0;	// Converts seconds to milliseconds
+
+// The JSON name of each counter and timer
+const char* const COUNTER_NAMES[COUNTER_AMT] = { "cells_visited", "neighbor_probes",
+	"out_of_bounds_throws", "list_inserts", "list_find_compares", "blocks_pruned" };
+const char* const TIMER_NAMES[TIMER_AMT] = { "populate", "save", "search", "top", "recolor",
+	"output", "batch" };
+
+
+static mutex instrumentLock;								// Guards everything below
+static vector<unique_ptr<unsigned long long[]>> countBlocks;	// The counters of every thread
+static double timerSeconds[TIMER_AMT];						// The time of every timer
+static unsigned long long timerCalls[TIMER_AMT];			// The phases added to every timer
+
+
+
+// Pre: None
+// Post: A block of COUNTER_AMT counters set to zero is returned, it lasts until the program ends
+unsigned long long* RegisterCounts()
+{
+	lock_guard<mutex> guard(instrumentLock);
+
+	countBlocks.push_back(unique_ptr<unsigned long long[]>(new unsigned long long[COUNTER_AMT]()));
+
+	return countBlocks.back().get();
+}// end RegisterCounts
+
+
+
+// Pre: The timer and the seconds the phase took
+// Post: The timer holds one more phase and its time
+void AddTimer(/*IN*/const TimerEnum& timer,     // The timer of the phase
+			  /*IN*/const double& seconds)      // The time the phase took
+{
+	lock_guard<mutex> guard(instrumentLock);
+
+	timerSeconds[timer] += seconds;
+	timerCalls[timer]++;
+}// end AddTimer
+
+
+
+// Pre: Every thread that counted has been joined
+// Post: fileName holds the total of every counter and the calls and milliseconds of every timer
+void WriteInstrumentReport(/*IN*/const string& fileName)     // The report file
+{
+	lock_guard<mutex> guard(instrumentLock);
+	ofstream jout(fileName);			// The report file
+	unsigned long long total;			// The total of the current counter
+
+	if (!jout)
+		return;
+
+	jout << "{\n  \"counters\": {\n";
+
+	for (int c = 0; c < COUNTER_AMT; c++)
+	{
+		total = ZERO;
+		for (size_t b = 0; b < countBlocks.size(); b++)
+			total += countBlocks[b][c];
+
+		jout << "    \"" << COUNTER_NAMES[c] << "\": " << total << (c < COUNTER_AMT - OFFSET ? ",\n" : "\n");
+	}
+
+	jout << "  },\n  \"timers\": {\n" << fixed << setprecision(3);
+
+	for (int t = 0; t < TIMER_AMT; t++)
+		jout << "    \"" << TIMER_NAMES[t] << "\": { \"calls\": " << timerCalls[t] << ", \"ms\": "
+			 << timerSeconds[t] * MS_PER_SECOND << " }" << (t < TIMER_AMT - OFFSET ? ",\n" : "\n");
+
+	jout << "  }\n}\n";
+}// end WriteInstrumentReport
+
+#endif // CUBE_INSTRUMENT
@@ -0,0 +1,180 @@
+#pragma once
+/*
+    FileName : Instrument.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains optional counters and timers for the hot paths of the searches, the cube and
+        the list. They are only built when CUBE_INSTRUMENT is defined, otherwise every macro
+        below is an empty statement and nothing is compiled in.
+
+        Counters:
+            CELLS_VISITED - Cells read by a search as its current cell
+            NEIGHBOR_PROBES - Neighbors compared with a search's current cell
+            OUT_OF_BOUNDS_THROWS - OutOfBoundsExceptions thrown
+            LIST_INSERTS - Items inserted into a ListClass
+            LIST_FIND_COMPARES - Keys compared by ListClass::Find, a hashed Find compares one
+            BLOCKS_PRUNED - Cells skipped by a flood search because their color's unchecked
+                            cells can not beat the blocks already found
+
+        Timers add up the wall clock time spent in each phase of the client.
+
+        Each thread counts into a block of its own, found through a thread_local pointer, so
+        counting takes no lock. The blocks are kept until the program ends and added up when
+        the report is written.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - The report is written once every thread that counted has been joined
+        2 - Define CUBE_INSTRUMENT in the preprocessor definitions of the project to build
+            the counters, the report is written to INSTRUMENT_FILE_NAME next to the output file
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - If the report can not be written nothing is written
+
+                           SUMMARY OF MACROS:
+        INSTRUMENT_COUNT(counter) - Adds one to a counter
+        INSTRUMENT_ADD(counter, amount) - Adds an amount to a counter
+        INSTRUMENT_TIMER(timer) - Times the rest of the enclosing scope
+        INSTRUMENT_TIMER_STOP(timer) - Ends the time of an INSTRUMENT_TIMER early
+        INSTRUMENT_REPORT(fileName) - Writes the counters and timers as JSON
+
+                           SUMMARY OF FUNCTIONS:
+        unsigned long long* InstrumentCounts() - Gets the counters of the calling thread
+        unsigned long long* RegisterCounts() - Makes a block of counters for a new thread
+        void AddTimer(*IN*const TimerEnum& timer,
+                      *IN*const double& seconds) - Adds a timed phase to a timer
+        void WriteInstrumentReport(*IN*const string& fileName) - Writes the JSON summary
+
+                           SUMMARY OF CLASSES:
+        PhaseTimerClass - Adds the time from its construction to its destruction, or to when
+                          it is stopped, to a timer
+*/
+
+#include <string>       // Gives access to the report file name
+
+using namespace std;
+
+
+// The counters kept
+enum CounterEnum { CELLS_VISITED, NEIGHBOR_PROBES, OUT_OF_BOUNDS_THROWS, LIST_INSERTS,
+                   LIST_FIND_COMPARES, BLOCKS_PRUNED };
+const int COUNTER_AMT = 6;  // The amount of counters
+
+
+// The phases of the client that are timed
+enum TimerEnum { POPULATE_TIMER, SAVE_TIMER, SEARCH_TIMER, TOP_TIMER, RECOLOR_TIMER,
+                 OUTPUT_TIMER, BATCH_TIMER };
+const int TIMER_AMT = 7;    // The amount of timers
+
+
+
+#ifdef CUBE_INSTRUMENT
+
+#include <chrono>       // Gives access to the clock of the timers
+
+
+const string INSTRUMENT_FILE_NAME = "Cube.json";    // The report file name, only named when built
+
+
+// O(1)
+// Purpose: Makes a block of counters for a new thread
+// Pre: None
+// Post: A block of COUNTER_AMT counters set to zero is returned, it lasts until the program ends
+unsigned long long* RegisterCounts();
+
+
+
+// O(1)
+// Purpose: Gets the counters of the calling thread
+// Pre: None
+// Post: The counters of the calling thread are returned, made on the thread's first call
+inline unsigned long long* InstrumentCounts()
+{
+    thread_local unsigned long long* counts = RegisterCounts();     // The counters of this thread
+
+    return counts;
+}// end InstrumentCounts
+
+
+
+// O(1)
+// Purpose: Adds a timed phase to a timer
+// Pre: The timer and the seconds the phase took
+// Post: The timer holds one more phase and its time
+void AddTimer(/*IN*/const TimerEnum& timer,     // The timer of the phase
+              /*IN*/const double& seconds);     // The time the phase took
+
+
+
+// O(T + C)
+// Purpose: Writes the counters and timers as JSON
+// Pre: Every thread that counted has been joined
+// Post: fileName holds the total of every counter and the calls and milliseconds of every timer
+void WriteInstrumentReport(/*IN*/const string& fileName);     // The report file
+
+
+
+class PhaseTimerClass
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Starts timing a phase
+    // Pre: The timer of the phase
+    // Post: The clock is started
+    PhaseTimerClass(/*IN*/const TimerEnum& timer)   // The timer of the phase
+        : timer(timer), start(chrono::steady_clock::now()), running(true)
+    {
+    }
+
+
+    // O(1) : Destructor
+    // Purpose: Adds the time since construction to the timer
+    // Pre: None
+    // Post: The timer holds the phase, unless it was already stopped
+    ~PhaseTimerClass()
+    {
+        Stop();
+    }
+
+
+    // O(1) : Mutator
+    // Purpose: Adds the time since construction to the timer
+    // Pre: None
+    // Post: The timer holds the phase, later calls add nothing
+    void Stop()
+    {
+        if (running)
+            AddTimer(timer, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+
+        running = false;
+    }
+
+
+private:
+
+    // PDMs
+    TimerEnum timer;                            // The timer of the phase
+    chrono::steady_clock::time_point start;     // When the phase started
+    bool running;                               // False once the phase has been added
+
+}; // end PhaseTimerClass
+
+
+#define INSTRUMENT_COUNT(counter) (InstrumentCounts()[counter]++)
+#define INSTRUMENT_ADD(counter, amount) (InstrumentCounts()[counter] += (unsigned long long)(amount))
+#define INSTRUMENT_TIMER(timer) PhaseTimerClass instrumentTimer##timer(timer)
+#define INSTRUMENT_TIMER_STOP(timer) (instrumentTimer##timer.Stop())
+#define INSTRUMENT_REPORT(fileName) WriteInstrumentReport(fileName)
+
+#else
+
+#define INSTRUMENT_COUNT(counter) ((void)0)
+#define INSTRUMENT_ADD(counter, amount) ((void)0)
+#define INSTRUMENT_TIMER(timer) ((void)0)
+#define INSTRUMENT_TIMER_STOP(timer) ((void)0)
+#define INSTRUMENT_REPORT(fileName) ((void)0)
+
+#endif // CUBE_INSTRUMENT
@@ -0,0 +1,1203 @@
+#include "Labeler.h"	// Specification file for the Labeler class
+#include "Instrument.h"	// Grants Access to the instrumentation counters
+#include "FixedCube.h"	// Grants Access to the Cube Class of fixed dimensions the passes are built for
+#include <climits>		// Gives access to INT_MAX for a label not yet measured
+
+// Runs are found with the widest compare the compiler allows
+#if defined(__AVX2__)
+#include <immintrin.h>	// AVX2 compares of 8 cells at a time
+#define LABELER_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>	// SSE2 compares of 4 cells at a time
+#define LABELER_SSE2
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>		// _BitScanForward
+#endif
+
+
+// The measures of a provisional label that holds no cells yet
+static const ShapeSumRec NO_SHAPE = { { INT_MAX, INT_MAX, INT_MAX }, { -1, -1, -1 }, 0, 0, 0, 0 };
+
+
+
+// O(1)
+// Purpose: Finds the lowest bit that is clear in a compare mask
+// Pre: mask has at least one clear bit in its low 8 bits
+// Post: The position of the lowest clear bit is returned
+static int FirstClearBit(/*IN*/const int& mask)	// The compare mask
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctz(~(unsigned int)mask);
+#elif defined(_MSC_VER)
+	unsigned long position;	// The position of the lowest clear bit
+
+	_BitScanForward(&position, ~(unsigned long)mask);
+	return (int)position;
+#else
+	int position = ZERO;	// The position of the lowest clear bit
+
+	while ((mask >> position) & OFFSET)
+		position++;
+	return position;
+#endif
+}// end FirstClearBit
+
+
+
+// O(D)
+// Purpose: Finds the end of the run of cells of the same type starting at start
+// Pre: 0 <= start < deps, row holds the types of a row
+// Post: The depth after the last cell of the run is returned
+static int RunEnd(/*IN*/const int row[],		// The types of the row
+				  /*IN*/const int& start,		// The depth of the first cell of the run
+				  /*IN*/const int& deps)		// The amount of cells in the row
+{
+	int type = row[start];	// The type of the run
+	int k = start + OFFSET;	// The depth being compared
+
+#if defined(LABELER_AVX2)
+	__m256i target8 = _mm256_set1_epi32(type);	// The type of the run in every lane
+
+	// Compare 8 cells at a time until one differs
+	for (; k + 8 <= deps; k += 8)
+	{
+		__m256i cells = _mm256_loadu_si256((const __m256i*)(row + k));
+		int same = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(cells, target8)));
+
+		if (same != 0xFF)
+			return k + FirstClearBit(same);
+	}
+#endif
+#if defined(LABELER_SSE2)
+	__m128i target4 = _mm_set1_epi32(type);	// The type of the run in every lane
+
+	// Compare 4 cells at a time until one differs
+	for (; k + 4 <= deps; k += 4)
+	{
+		__m128i cells = _mm_loadu_si128((const __m128i*)(row + k));
+		int same = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(cells, target4)));
+
+		if (same != 0xF)
+			return k + FirstClearBit(same);
+	}
+#endif
+
+	// Compare the remaining cells one at a time
+	while (k < deps && row[k] == type)
+		k++;
+
+	return k;
+}// end RunEnd
+
+
+
+// O(R)
+// Purpose: Unions each run with the overlapping runs of the same type in a neighboring row
+// Pre: Both sets of runs are sorted by start, every neighbor run has a label, reach is 0
+//      when only level cells touch and 1 when the diagonal cells touch too
+// Post: Every run shares a root with each matching neighbor run it overlaps once widened by reach
+static void ConnectRuns(/*IN/OUT*/RunRec runs[],				// The runs of the current row
+						/*IN*/const int& runAmt,				// The amount of runs in the current row
+						/*IN*/const RunRec nbRuns[],			// The runs of the neighboring row
+						/*IN*/const int& nbAmt,					// The amount of runs in the neighboring row
+						/*IN*/const int& reach,					// How far along the depth a cell touches
+						/*IN/OUT*/UnionFindClass& labelSet)		// The provisional labels of the slab
+{
+	int p = ZERO;	// The first neighbor run that may overlap the current run
+
+	for (int r = 0; r < runAmt; r++)
+	{
+		// Skip the neighbor runs that end before this run starts
+		while (p < nbAmt && nbRuns[p].end + reach <= runs[r].start)
+			p++;
+
+		// Union with every matching neighbor run that starts before this run ends
+		for (int q = p; q < nbAmt && nbRuns[q].start < runs[r].end + reach; q++)
+			if (nbRuns[q].type == runs[r].type)
+				runs[r].label = labelSet.Merge(runs[r].label, nbRuns[q].label);
+	}
+}// end ConnectRuns
+
+
+
+// O(R)
+// Purpose: Counts the faces each run shares with the runs of the same type in a neighboring column
+// Pre: Both sets of runs are sorted by start, every run has a label measured by AddShape
+// Post: The shared faces of the label of each run grow by the cells it overlaps in each
+//       matching neighbor run
+static void ShareRunFaces(/*IN*/const RunRec runs[],				// The runs of the current column
+						  /*IN*/const int& runAmt,					// The amount of runs in the current column
+						  /*IN*/const RunRec nbRuns[],				// The runs of the neighboring column
+						  /*IN*/const int& nbAmt,					// The amount of runs in the neighboring column
+						  /*IN/OUT*/UnionFindClass& labelSet)		// The provisional labels of the slab
+{
+	int p = ZERO;	// The first neighbor run that may overlap the current run
+
+	for (int r = 0; r < runAmt; r++)
+	{
+		// Skip the neighbor runs that end before this run starts
+		while (p < nbAmt && nbRuns[p].end <= runs[r].start)
+			p++;
+
+		// Every overlapped cell of a matching neighbor run shares a face
+		for (int q = p; q < nbAmt && nbRuns[q].start < runs[r].end; q++)
+			if (nbRuns[q].type == runs[r].type)
+				labelSet.AddSharedFaces(runs[r].label, min(runs[r].end, nbRuns[q].end) -
+													   max(runs[r].start, nbRuns[q].start));
+	}
+}// end ShareRunFaces
+
+
+// Pre: None
+// Post: The labeler holds no blocks
+LabelerClass::LabelerClass()
+{
+	rows = ZERO;
+	cols = ZERO;
+	deps = ZERO;
+	method = CELL_LABELING;
+	connectivity = FACE_CONNECTIVITY;
+	geometry = false;
+}// end DC
+
+
+
+// Pre: None
+// Post: Every later call to Label uses newMethod
+void LabelerClass::SetMethod(/*IN*/const LabelMethodEnum& newMethod)     // The desired method
+{
+	method = newMethod;
+}// end SetMethod
+
+
+
+// Pre: None
+// Post: Every later call to Label uses newConnectivity
+void LabelerClass::SetConnectivity(/*IN*/const ConnectivityEnum& newConnectivity)     // The desired connectivity
+{
+	connectivity = newConnectivity;
+}// end SetConnectivity
+
+
+
+// Pre: None
+// Post: Every later call to Label measures the shape of every block when measure is true
+void LabelerClass::SetGeometry(/*IN*/const bool& measure)     // True to measure the blocks
+{
+	geometry = measure;
+}// end SetGeometry
+
+
+
+// Pre: The cube to be labeled and its dimensions, the amount of threads to label with,
+//      the passes PickPasses chose for the form of the cube
+// Post: Every cell has a label, and the type and size of every block is known
+//       Any previous labeling is discarded. The result does not depend on threadAmt
+// Exception: InvalidDimensionException is thrown if the cube holds more than MAX_LABEL_CELLS cells
+void LabelerClass::LabelRows(/*IN*/const void* cube,                  // The cube being labeled
+							 /*IN*/const int& numRows,                // The amount of rows in the cube
+							 /*IN*/const int& numCols,                // The amount of columns in the cube
+							 /*IN*/const int& numDeps,                // The amount of faces in the cube
+							 /*IN*/const int& threadAmt,              // The amount of threads to label with
+							 /*IN*/const SlabPassPtr& slabLabeler,    // The pass 1 method
+							 /*IN*/const FacePassPtr& faceMerger)     // The slab joining method
+{
+	int slabAmt;						// The amount of slabs the rows are split into
+	vector<int> slabStart;				// The first row of each slab, and the row after the last
+	vector<int> labelBase;				// The first joined label of each slab
+	vector<UnionFindClass> slabSets;	// The provisional labels of each slab
+	vector<thread> workers;				// The threads labeling each slab
+	vector<int> rootLabel;				// The final label of each joined root
+	vector<int> finalLabel;				// The final label of each joined label
+
+	// Every label of a cell must fit in an int
+	if ((size_t)numRows * (size_t)numCols * (size_t)numDeps > MAX_LABEL_CELLS)
+		throw InvalidDimensionException();
+
+	rows = numRows;
+	cols = numCols;
+	deps = numDeps;
+
+	// Discard any previous labeling
+	labels.assign((size_t)rows * (size_t)cols * (size_t)deps, NO_LABEL);
+	components.clear();
+	shapes.clear();
+
+	// Split the rows into one slab per thread, every slab holds at least one row
+	slabAmt = threadAmt;
+	if (slabAmt > rows)
+		slabAmt = rows;
+	if (slabAmt < OFFSET)
+		slabAmt = OFFSET;
+
+	slabStart.resize(slabAmt + OFFSET);
+	for (int s = 0; s <= slabAmt; s++)
+		slabStart[s] = (int)((long long)rows * s / slabAmt);
+
+	slabSets.resize(slabAmt);
+
+
+	// ---------------- Pass 1: Provisional Labels -----------------
+
+	// The first slab is labeled by this thread, every other slab by a worker
+	for (int s = OFFSET; s < slabAmt; s++)
+		workers.push_back(thread(slabLabeler, this, cube,
+								 slabStart[s], slabStart[s + OFFSET], ref(slabSets[s])));
+
+	(this->*slabLabeler)(cube, slabStart[ZERO], slabStart[OFFSET], slabSets[ZERO]);
+
+	for (size_t w = 0; w < workers.size(); w++)
+		workers[w].join();
+	workers.clear();
+
+
+	// ---------------- Join the Slabs -----------------
+
+	UnionFindClass& labelSet = slabSets[ZERO];	// Every provisional label of the cube
+
+	labelBase.assign(slabAmt, ZERO);
+	for (int s = OFFSET; s < slabAmt; s++)
+	{
+		labelBase[s] = labelSet.Append(slabSets[s]);
+		slabSets[s].Clear();
+	}
+
+	// Union the blocks touching across each slab face
+	for (int s = OFFSET; s < slabAmt; s++)
+		(this->*faceMerger)(cube, slabStart[s], labelBase[s - OFFSET], labelBase[s], labelSet);
+
+
+	// ---------------- Pass 2: Final Labels and Sizes -----------------
+
+	// Provisional labels are numbered in the order of their first cell, so giving
+	// final labels in label order numbers each block by its first cell
+	rootLabel.assign(labelSet.GetLabelAmt(), NO_LABEL);
+	finalLabel.resize(labelSet.GetLabelAmt());
+
+	for (int l = 0; l < labelSet.GetLabelAmt(); l++)
+	{
+		int root = labelSet.FindRoot(l);	// The root of the provisional label
+
+		// The first label of a block starts it
+		if (rootLabel[root] == NO_LABEL)
+		{
+			ComponentRec newComp;	// The block being started
+
+			newComp.type = labelSet.GetType(l);
+			newComp.size = ZERO;
+			newComp.firstCell = labelSet.GetFirstCell(l);
+
+			rootLabel[root] = (int)components.size();
+			components.push_back(newComp);
+		}
+
+		finalLabel[l] = rootLabel[root];
+		components[finalLabel[l]].size += labelSet.GetSize(l);
+	}
+
+	// The shape of each block is folded from its labels before they are released
+	if (geometry)
+		MeasureBlocks(labelSet, finalLabel);
+
+	// The union find is no longer needed
+	labelSet.Clear();
+	vector<int>().swap(rootLabel);
+
+	// Replace the provisional label of every cell, one slab per thread
+	for (int s = OFFSET; s < slabAmt; s++)
+		workers.push_back(thread(&LabelerClass::RelabelSlab, this, slabStart[s],
+								 slabStart[s + OFFSET], labelBase[s], cref(finalLabel)));
+
+	RelabelSlab(slabStart[ZERO], slabStart[OFFSET], labelBase[ZERO], finalLabel);
+
+	for (size_t w = 0; w < workers.size(); w++)
+		workers[w].join();
+
+}// end LabelRows
+
+
+
+// Pre: A cube has been labeled
+// Post: The label of the cell is returned, NO_LABEL if the cell has no type
+// Exception: OutOfBoundsException is thrown if the cell is not within the labeled cube
+int LabelerClass::GetLabel(/*IN*/const LocationRec& cell) const     // The desired cell location
+{
+	// Check to see if the cell location is valid
+	if (cell.x >= rows || cell.x < ZERO || cell.y >= cols ||
+		cell.y < ZERO || cell.z >= deps || cell.z < ZERO)
+	{
+		INSTRUMENT_COUNT(OUT_OF_BOUNDS_THROWS);
+		throw OutOfBoundsException();
+	}
+
+	return labels[CellIndex(cell)];
+}// end GetLabel
+
+
+
+// Pre: A cube has been labeled
+// Post: The amount of blocks is returned
+int LabelerClass::GetComponentCount() const
+{
+	return (int)components.size();
+}// end GetComponentCount
+
+
+
+// Pre: A cube has been labeled, 0 <= label < GetComponentCount()
+// Post: The type, size and first cell of the block are returned
+ComponentRec LabelerClass::GetComponent(/*IN*/const int& label) const   // The label of the block
+{
+	return components[label];
+}// end GetComponent
+
+
+
+// Pre: A cube has been labeled with SetGeometry(true), 0 <= label < GetComponentCount()
+// Post: The bounding box, centroid, exposed faces and the faces of the cube touched by
+//       the block are returned
+GeometryRec LabelerClass::GetGeometry(/*IN*/const int& label) const     // The label of the block
+{
+	return shapes[label];
+}// end GetGeometry
+
+
+
+// Pre: A cube has been labeled
+// Post: histogram[b] holds the amount of blocks of 2^b to 2^(b + 1) - 1 cells, the
+//       last entry counts the largest block. It is empty when the cube holds no block
+void LabelerClass::GetSizeHistogram(/*OUT*/vector<int>& histogram) const     // The amount of blocks of each range
+{
+	int bin;	// The range of the current block's size
+
+	histogram.clear();
+
+	for (size_t i = 0; i < components.size(); i++)
+	{
+		// The range is the position of the highest set bit of the size
+		bin = ZERO;
+		while ((components[i].size >> (bin + OFFSET)) != ZERO)
+			bin++;
+
+		if (bin >= (int)histogram.size())
+			histogram.resize(bin + OFFSET, ZERO);
+
+		histogram[bin]++;
+	}
+}// end GetSizeHistogram
+
+
+
+// Pre: A cube has been labeled
+// Post: The labels of the largest and second largest block are returned,
+//       NO_LABEL is returned in place of a block that does not exist
+//       Ties are broken by the block whose first cell comes first in scan order
+void LabelerClass::FindLargest(/*OUT*/int& largest,               // The label of the largest block
+							   /*OUT*/int& secLargest) const      // The label of the second largest block
+{
+	vector<size_t> scanFirst;	// The first cell of every block in scan order, found on the first tie
+
+	largest = NO_LABEL;
+	secLargest = NO_LABEL;
+
+	for (int i = 0; i < (int)components.size(); i++)
+	{
+		if (Precedes(i, largest, scanFirst))
+		{
+			// Largest becomes the second largest
+			secLargest = largest;
+			largest = i;
+		}
+		else if (Precedes(i, secLargest, scanFirst))
+			secLargest = i;
+	}
+}// end FindLargest
+
+
+
+// Pre: A cube has been labeled, 0 <= label < GetComponentCount(),
+//      the list can hold every cell of the block
+// Post: The list is cleared and holds every cell of the block in storage order
+void LabelerClass::GetComponentCells(/*IN*/const int& label,              // The label of the block
+									 /*OUT*/ListClass& cellList) const    // The cells of the block
+{
+	ItemRec currItem;	// The cell being added to the list
+	size_t cellIndex;	// The linear index of the current cell
+
+	cellList.Clear();
+
+	// Start at the first cell of the block, no earlier cell can belong to it
+	cellIndex = components[label].firstCell;
+	currItem.key.x = (int)(cellIndex / ((size_t)cols * deps));
+	currItem.key.y = (int)(cellIndex / deps % cols);
+	currItem.key.z = (int)(cellIndex % deps);
+
+	for (; cellIndex < labels.size(); cellIndex++)
+	{
+		if (labels[cellIndex] == label)
+			cellList.Insert(currItem);
+
+		// Increment to the next cell in storage order
+		currItem.key.z++;
+		if (currItem.key.z >= deps)
+		{
+			currItem.key.z = 0;
+			currItem.key.y++;
+		}
+		if (currItem.key.y >= cols)
+		{
+			currItem.key.y = 0;
+			currItem.key.x++;
+		}
+	}
+}// end GetComponentCells
+
+
+
+// Pre: A cube has been labeled, k > 0
+// Post: blocks holds at most k blocks from largest to smallest, ties are broken by
+//       the block whose first cell comes first in scan order. The id of each block is
+//       its label. Only blocks of type are considered unless type is ANY_TYPE. The cells
+//       of the kept blocks are gathered in a single sweep, no other block has its cells gathered
+void LabelerClass::FindTopK(/*IN*/const int& k,                       // The most blocks to find
+							/*OUT*/vector<BlockRec>& blocks,          // The largest blocks
+							/*IN*/const int& type) const              // The color of the blocks, or ANY_TYPE
+{
+	TopBlocksClass topBlocks(k);	// The largest blocks found so far
+	vector<size_t> scanFirst;		// The first cell of every block in scan order
+	vector<int> slotOf;				// The index in blocks of each kept label, or NO_LABEL
+	BlockRec currBlock;				// The block being offered
+	ItemRec currItem;				// The cell being added to a list
+	size_t cellIndex;				// The linear index of the current cell
+	int slot;						// The index in blocks of the current cell's block
+
+	FindScanFirst(scanFirst);
+
+	// Blocks are offered by their first cell in scan order so it breaks ties,
+	// the labels are not in that order so every block of type is offered
+	for (int i = 0; i < (int)components.size(); i++)
+	{
+		if (type == ANY_TYPE || components[i].type == type)
+		{
+			currBlock.type = components[i].type;
+			currBlock.size = components[i].size;
+			currBlock.id = scanFirst[i];
+			topBlocks.Offer(currBlock);
+		}
+	}
+
+	topBlocks.TakeSorted(blocks);
+
+	if (blocks.empty())
+		return;
+
+	// The first cell of each kept block gives back its label
+	for (int i = 0; i < (int)blocks.size(); i++)
+		blocks[i].id = labels[ScanCell(blocks[i].id, cols, deps)];
+
+	// Size each kept block's list and start the sweep at the earliest first cell
+	slotOf.assign(components.size(), NO_LABEL);
+	cellIndex = labels.size();
+	for (int i = 0; i < (int)blocks.size(); i++)
+	{
+		slotOf[blocks[i].id] = i;
+		blocks[i].cells = ListClass((int)blocks[i].size);
+
+		if (components[blocks[i].id].firstCell < cellIndex)
+			cellIndex = components[blocks[i].id].firstCell;
+	}
+
+	currItem.key.x = (int)(cellIndex / ((size_t)cols * deps));
+	currItem.key.y = (int)(cellIndex / deps % cols);
+	currItem.key.z = (int)(cellIndex % deps);
+
+	for (; cellIndex < labels.size(); cellIndex++)
+	{
+		if (labels[cellIndex] != NO_LABEL)
+		{
+			slot = slotOf[labels[cellIndex]];
+
+			if (slot != NO_LABEL)
+				blocks[slot].cells.Insert(currItem);
+		}
+
+		// Increment to the next cell in storage order
+		currItem.key.z++;
+		if (currItem.key.z >= deps)
+		{
+			currItem.key.z = 0;
+			currItem.key.y++;
+		}
+		if (currItem.key.y >= cols)
+		{
+			currItem.key.y = 0;
+			currItem.key.x++;
+		}
+	}
+}// end FindTopK
+
+
+
+// Pre: Cube is CubeClass or DefaultCubeClass, the forms the passes are built for
+// Post: slabLabeler gives provisional labels by the method, measuring the blocks when
+//       geometry is set, faceMerger joins the slabs, both read a Cube and use the
+//       neighbors of the connectivity
+template <class Cube>
+void LabelerClass::PickPasses(/*OUT*/SlabPassPtr& slabLabeler,        // The pass 1 method
+							  /*OUT*/FacePassPtr& faceMerger) const   // The slab joining method
+{
+	// The connectivity is settled once, each one has passes of its own
+	if (connectivity == EDGE_CONNECTIVITY)
+		PickConnectedPasses<Cube, EdgeConnectivity>(slabLabeler, faceMerger);
+	else if (connectivity == CORNER_CONNECTIVITY)
+		PickConnectedPasses<Cube, CornerConnectivity>(slabLabeler, faceMerger);
+	else
+		PickConnectedPasses<Cube, FaceConnectivity>(slabLabeler, faceMerger);
+}// end PickPasses
+
+
+
+// Pre: None
+// Post: slabLabeler gives provisional labels by the method, measuring the blocks when
+//       geometry is set, faceMerger joins the slabs, both read a Cube and use the
+//       neighbors of Connectivity
+template <class Cube, class Connectivity>
+void LabelerClass::PickConnectedPasses(/*OUT*/SlabPassPtr& slabLabeler,        // The pass 1 method
+									   /*OUT*/FacePassPtr& faceMerger) const   // The slab joining method
+{
+	if (method == RUN_LABELING)
+		slabLabeler = geometry ? &LabelerClass::LabelSlabRuns<Cube, Connectivity, true>
+							   : &LabelerClass::LabelSlabRuns<Cube, Connectivity, false>;
+	else
+		slabLabeler = geometry ? &LabelerClass::LabelSlab<Cube, Connectivity, true>
+							   : &LabelerClass::LabelSlab<Cube, Connectivity, false>;
+
+	faceMerger = &LabelerClass::MergeSlabFace<Cube, Connectivity>;
+}// end PickConnectedPasses
+
+
+
+// Pre: cube points to a Cube, firstRow <= endRow, labelSet holds no labels
+// Post: Every cell of rows firstRow to endRow - 1 holds a label of labelSet,
+//       cells in the first row of the slab are not compared to the row before it.
+//       When Measure every label holds the measures of its cells
+template <class Cube, class Connectivity, bool Measure>
+void LabelerClass::LabelSlab(/*IN*/const void* cube,              // The cube being labeled
+							 /*IN*/const int& firstRow,           // The first row of the slab
+							 /*IN*/const int& endRow,             // The row after the last row of the slab
+							 /*OUT*/UnionFindClass& labelSet)     // The provisional labels of the slab
+{
+	const Cube& colCube = *static_cast<const Cube*>(cube);	// The cube being labeled
+	size_t planeSize = (size_t)cols * (size_t)deps;	// The amount of cells in a single row of the cube
+	size_t cellIndex;			// The linear index of the current cell
+	int currType;				// The type of the current cell
+	int currLabel;				// The label given to the current cell
+	int i, j, k;				// The location of the current cell
+	int spanEnd;				// The face after the cells inside a chunk of one type
+	bool interiorRow;			// If the column lies inside the chunks it crosses
+	vector<int> prevPlane(planeSize);	// The types of the previous row (x - 1)
+	vector<int> currPlane(planeSize);	// The types of the current row (x)
+
+	// Union the current cell with one of its labeled neighbors, if it is in the slab and matches
+	auto mergeNeighbor = [&](auto n)
+	{
+		constexpr NeighborStepRec step = Connectivity::BackStep(decltype(n)::value);
+
+		if ((step.dx == ZERO || i > firstRow) &&
+			(step.dy >= ZERO || j > ZERO) && (step.dy <= ZERO || j < cols - OFFSET) &&
+			(step.dz >= ZERO || k > ZERO) && (step.dz <= ZERO || k < deps - OFFSET) &&
+			(step.dx == ZERO ? currPlane : prevPlane)[(size_t)(j + step.dy) * deps + (k + step.dz)] == currType)
+			currLabel = labelSet.Merge(currLabel,
+				labels[cellIndex + (step.dx * (ptrdiff_t)planeSize + step.dy * (ptrdiff_t)deps + step.dz)]);
+	};
+
+	cellIndex = (size_t)firstRow * planeSize;
+	for (i = firstRow; i < endRow; i++)
+	{
+		for (j = 0; j < cols; j++)
+		{
+			int* row = &currPlane[(size_t)j * deps];	// The types of the current column
+
+			// A column with no type holds no block, only its types are kept for the next row
+			if (!ReadCubeRow(colCube, i, j, row))
+			{
+				cellIndex += deps;
+				continue;
+			}
+
+			// Every cell of the column is compared with its labeled neighbors, when filled
+			INSTRUMENT_ADD(CELLS_VISITED, deps);
+			INSTRUMENT_ADD(NEIGHBOR_PROBES, ColumnProbes<Connectivity>(i > firstRow, j, cols, deps));
+
+			// Every backward neighbor of a cell off the faces of its chunk lies in the chunk
+			interiorRow = i > firstRow && (i & CHUNK_MASK) != ZERO &&
+				(j & CHUNK_MASK) != ZERO && (j & CHUNK_MASK) < CHUNK_EDGE - Connectivity::AHEAD_REACH;
+
+			for (k = 0; k < deps; k++, cellIndex++)
+			{
+				currType = row[k];
+
+				// Cells with no type belong to no block
+				if (currType == EMPTY_CELL)
+					continue;
+
+				// The cells inside a chunk of one type join the block of the cells before them
+				// in x, which the faces of the chunk already joined to every cell of the chunk
+				if (interiorRow && (k & CHUNK_MASK) == OFFSET && row[k - OFFSET] == currType &&
+					colCube.GetChunkType(i, j, k) == currType)
+				{
+					spanEnd = min(k - OFFSET + CHUNK_EDGE - Connectivity::AHEAD_REACH, deps);
+					currLabel = labels[cellIndex - planeSize];
+
+					fill(labels.begin() + cellIndex, labels.begin() + (cellIndex + (spanEnd - k)), currLabel);
+					labelSet.AddCells(currLabel, spanEnd - k);
+
+					// Each cell shares a face with the cells before it in every direction
+					if (Measure)
+					{
+						labelSet.AddShape(currLabel, i, j, k, spanEnd);
+						labelSet.AddSharedFaces(currLabel, FaceConnectivity::BACK_AMT * (spanEnd - k));
+					}
+
+					// None of the cells compared a neighbor
+					INSTRUMENT_ADD(NEIGHBOR_PROBES, -(long long)(spanEnd - k) * Connectivity::BACK_AMT);
+
+					cellIndex += spanEnd - k - OFFSET;
+					k = spanEnd - OFFSET;
+					continue;
+				}
+
+				currLabel = NO_LABEL;
+
+				// Compare against the neighbors that have already been labeled
+				ForEachStep<Connectivity::BACK_AMT>(mergeNeighbor);
+
+				// Start a new block if no neighbor matched
+				if (currLabel == NO_LABEL)
+					currLabel = labelSet.NewLabel(currType, cellIndex);
+
+				labels[cellIndex] = currLabel;
+				labelSet.AddCell(currLabel);
+
+				// The faces shared with the matching cells before it, whatever the connectivity
+				if (Measure)
+				{
+					labelSet.AddShape(currLabel, i, j, k, k + OFFSET);
+					labelSet.AddSharedFaces(currLabel, (int)(k > ZERO && row[k - OFFSET] == currType) +
+						(int)(j > ZERO && currPlane[(size_t)(j - OFFSET) * deps + k] == currType) +
+						(int)(i > firstRow && prevPlane[(size_t)j * deps + k] == currType));
+				}
+			}// k
+		}// j
+
+		// The current row becomes the previous row
+		prevPlane.swap(currPlane);
+	}// i
+
+}// end LabelSlab
+
+
+
+// Pre: cube points to a Cube, firstRow <= endRow, labelSet holds no labels
+// Post: Every cell of rows firstRow to endRow - 1 holds a label of labelSet, the
+//       same labels and measures LabelSlab gives
+template <class Cube, class Connectivity, bool Measure>
+void LabelerClass::LabelSlabRuns(/*IN*/const void* cube,              // The cube being labeled
+								 /*IN*/const int& firstRow,           // The first row of the slab
+								 /*IN*/const int& endRow,             // The row after the last row of the slab
+								 /*OUT*/UnionFindClass& labelSet)     // The provisional labels of the slab
+{
+	const Cube& colCube = *static_cast<const Cube*>(cube);	// The cube being labeled
+	size_t rowIndex;					// The linear index of the first cell of the current column
+	vector<int> rowTypes(deps);			// The types of the current column
+	vector<RunRec> prevRuns;			// The runs of the previous row (x - 1)
+	vector<RunRec> currRuns;			// The runs of the current row (x)
+	vector<int> prevRunStart(cols + OFFSET);	// The first run of each column of the previous row
+	vector<int> currRunStart(cols + OFFSET);	// The first run of each column of the current row
+	RunRec currRun;						// The run being split off
+
+	rowIndex = (size_t)firstRow * (size_t)cols * (size_t)deps;
+	for (int i = firstRow; i < endRow; i++)
+	{
+		currRuns.clear();
+		currRunStart[ZERO] = ZERO;
+
+		for (int j = 0; j < cols; j++, rowIndex += deps)
+		{
+			// A column with no type starts no run
+			if (!ReadCubeRow(colCube, i, j, &rowTypes[ZERO]))
+			{
+				currRunStart[j + OFFSET] = (int)currRuns.size();
+				continue;
+			}
+
+			INSTRUMENT_ADD(CELLS_VISITED, deps);
+
+			// Split the column into runs of the same type, cells with no type start no run
+			for (int k = 0; k < deps; k = currRun.end)
+			{
+				currRun.start = k;
+				currRun.end = RunEnd(&rowTypes[ZERO], k, deps);
+				currRun.type = rowTypes[k];
+				currRun.label = NO_LABEL;
+
+				if (currRun.type != EMPTY_CELL)
+					currRuns.push_back(currRun);
+			}
+			currRunStart[j + OFFSET] = (int)currRuns.size();
+
+			RunRec* runs = currRuns.data() + currRunStart[j];				// The runs of this column
+			int runAmt = currRunStart[j + OFFSET] - currRunStart[j];		// The amount of runs of this column
+
+			// Union with the runs of the neighboring columns of this row and the previous row
+			ForEachStep<Connectivity::COLUMN_AMT>([&](auto n)
+			{
+				constexpr ColumnStepRec step = Connectivity::BackColumn(decltype(n)::value);
+				const vector<RunRec>& nbRuns = (step.dx == ZERO ? currRuns : prevRuns);		// The runs of the neighbor's row
+				const vector<int>& nbRunStart = (step.dx == ZERO ? currRunStart : prevRunStart);	// The first run of its columns
+				int nbCol = j + step.dy;	// The neighboring column
+
+				if ((step.dx == ZERO || i > firstRow) && nbCol >= ZERO && nbCol < cols)
+					ConnectRuns(runs, runAmt, nbRuns.data() + nbRunStart[nbCol],
+								nbRunStart[nbCol + OFFSET] - nbRunStart[nbCol], step.reach, labelSet);
+			});
+
+			// Start a new block for each run that matched nothing, and label its cells
+			for (int r = 0; r < runAmt; r++)
+			{
+				if (runs[r].label == NO_LABEL)
+					runs[r].label = labelSet.NewLabel(runs[r].type, rowIndex + runs[r].start);
+
+				for (int k = runs[r].start; k < runs[r].end; k++)
+					labels[rowIndex + k] = runs[r].label;
+
+				labelSet.AddCells(runs[r].label, runs[r].end - runs[r].start);
+
+				// Every cell after the first shares a face with the cell before it
+				if (Measure)
+				{
+					labelSet.AddShape(runs[r].label, i, j, runs[r].start, runs[r].end);
+					labelSet.AddSharedFaces(runs[r].label, runs[r].end - runs[r].start - OFFSET);
+				}
+			}
+
+			// The faces shared with the level runs of the column and the row before
+			if (Measure)
+			{
+				if (j > ZERO)
+					ShareRunFaces(runs, runAmt, currRuns.data() + currRunStart[j - OFFSET],
+								  currRunStart[j] - currRunStart[j - OFFSET], labelSet);
+
+				if (i > firstRow)
+					ShareRunFaces(runs, runAmt, prevRuns.data() + prevRunStart[j],
+								  prevRunStart[j + OFFSET] - prevRunStart[j], labelSet);
+			}
+		}// j
+
+		// The current row becomes the previous row
+		prevRuns.swap(currRuns);
+		prevRunStart.swap(currRunStart);
+	}// i
+
+}// end LabelSlabRuns
+
+
+
+// Pre: cube points to a Cube, the slabs on either side of faceRow have been labeled
+//      and appended to labelSet
+// Post: Every pair of matching neighbors across the face shares a root in labelSet,
+//       when measured each matching pair of level cells shares a face
+template <class Cube, class Connectivity>
+void LabelerClass::MergeSlabFace(/*IN*/const void* cube,                  // The cube being labeled
+								 /*IN*/const int& faceRow,                // The first row of the lower slab
+								 /*IN*/const int& aboveBase,              // The label base of the upper slab
+								 /*IN*/const int& belowBase,              // The label base of the lower slab
+								 /*IN/OUT*/UnionFindClass& labelSet)      // The joined provisional labels
+{
+	const Cube& colCube = *static_cast<const Cube*>(cube);	// The cube being labeled
+	size_t planeSize = (size_t)cols * (size_t)deps;	// The amount of cells in a single row of the cube
+	size_t cellIndex = (size_t)faceRow * planeSize;	// The linear index of the current lower cell
+	int j, k;						// The column and face of the current lower cell
+	vector<int> abovePlane(planeSize);	// The types of the last row of the upper slab
+	vector<int> belowPlane(planeSize);	// The types of the first row of the lower slab
+
+	for (j = 0; j < cols; j++)
+	{
+		ReadCubeRow(colCube, faceRow - OFFSET, j, &abovePlane[(size_t)j * deps]);
+		ReadCubeRow(colCube, faceRow, j, &belowPlane[(size_t)j * deps]);
+	}
+
+	// Union the current cell with a neighbor in the row above, if it is in the cube and matches
+	auto mergeAbove = [&](auto n)
+	{
+		constexpr NeighborStepRec step = Connectivity::BackStep(decltype(n)::value);
+
+		if (step.dx != ZERO &&
+			(step.dy >= ZERO || j > ZERO) && (step.dy <= ZERO || j < cols - OFFSET) &&
+			(step.dz >= ZERO || k > ZERO) && (step.dz <= ZERO || k < deps - OFFSET) &&
+			abovePlane[(size_t)(j + step.dy) * deps + (k + step.dz)] == belowPlane[(size_t)j * deps + k])
+			labelSet.Merge(labels[cellIndex] + belowBase,
+						   labels[cellIndex - planeSize + (step.dy * (ptrdiff_t)deps + step.dz)] + aboveBase);
+	};
+
+	for (j = 0; j < cols; j++)
+	{
+		for (k = 0; k < deps; k++, cellIndex++)
+		{
+			// Cells with no type belong to no block
+			if (belowPlane[(size_t)j * deps + k] == EMPTY_CELL)
+				continue;
+
+			ForEachStep<Connectivity::BACK_AMT>(mergeAbove);
+
+			// The cell directly above was never compared by the slab's own pass
+			if (geometry && abovePlane[(size_t)j * deps + k] == belowPlane[(size_t)j * deps + k])
+				labelSet.AddSharedFaces(labels[cellIndex] + belowBase, OFFSET);
+		}
+	}
+}// end MergeSlabFace
+
+
+
+// Pre: The slab holds provisional labels starting at labelBase in the joined set
+// Post: Every labeled cell of the slab holds its final label
+void LabelerClass::RelabelSlab(/*IN*/const int& firstRow,             // The first row of the slab
+							   /*IN*/const int& endRow,               // The row after the last row of the slab
+							   /*IN*/const int& labelBase,            // The label base of the slab
+							   /*IN*/const vector<int>& finalLabel)   // The final label of each joined label
+{
+	size_t planeSize = (size_t)cols * (size_t)deps;	// The amount of cells in a single row of the cube
+	size_t endCell = (size_t)endRow * planeSize;	// The cell after the last cell of the slab
+
+	for (size_t cellIndex = (size_t)firstRow * planeSize; cellIndex < endCell; cellIndex++)
+		if (labels[cellIndex] != NO_LABEL)
+			labels[cellIndex] = finalLabel[labels[cellIndex] + labelBase];
+
+}// end RelabelSlab
+
+
+
+// Pre: labelSet is every measured provisional label, finalLabel the block of each
+// Post: shapes holds the shape of every block
+void LabelerClass::MeasureBlocks(/*IN*/const UnionFindClass& labelSet,    // The joined provisional labels
+								 /*IN*/const vector<int>& finalLabel)     // The final label of each joined label
+{
+	vector<ShapeSumRec> blockSums(components.size(), NO_SHAPE);	// The measures of each block
+
+	// Fold the measures of every label into its block
+	for (int l = 0; l < labelSet.GetLabelAmt(); l++)
+	{
+		const ShapeSumRec& label = labelSet.GetShape(l);	// The measures of the provisional label
+		ShapeSumRec& block = blockSums[finalLabel[l]];		// The measures of its block
+
+		block.low.x = min(block.low.x, label.low.x);
+		block.low.y = min(block.low.y, label.low.y);
+		block.low.z = min(block.low.z, label.low.z);
+		block.high.x = max(block.high.x, label.high.x);
+		block.high.y = max(block.high.y, label.high.y);
+		block.high.z = max(block.high.z, label.high.z);
+		block.sumX += label.sumX;
+		block.sumY += label.sumY;
+		block.sumZ += label.sumZ;
+		block.sharedFaces += label.sharedFaces;
+	}
+
+	shapes.resize(components.size());
+	for (size_t b = 0; b < components.size(); b++)
+	{
+		const ShapeSumRec& block = blockSums[b];	// The measures of the block
+		GeometryRec& shape = shapes[b];				// The shape of the block
+
+		shape.low = block.low;
+		shape.high = block.high;
+		shape.centerX = (double)block.sumX / components[b].size;
+		shape.centerY = (double)block.sumY / components[b].size;
+		shape.centerZ = (double)block.sumZ / components[b].size;
+
+		// Every shared face hides a face of two cells
+		shape.exposedFaces = (long long)CELL_FACE_AMT * components[b].size - 2 * block.sharedFaces;
+
+		shape.cubeFaces = ZERO;
+		if (block.low.x == ZERO)
+			shape.cubeFaces |= LOW_ROW_FACE;
+		if (block.high.x == rows - OFFSET)
+			shape.cubeFaces |= HIGH_ROW_FACE;
+		if (block.low.y == ZERO)
+			shape.cubeFaces |= LOW_COL_FACE;
+		if (block.high.y == cols - OFFSET)
+			shape.cubeFaces |= HIGH_COL_FACE;
+		if (block.low.z == ZERO)
+			shape.cubeFaces |= LOW_DEP_FACE;
+		if (block.high.z == deps - OFFSET)
+			shape.cubeFaces |= HIGH_DEP_FACE;
+	}
+}// end MeasureBlocks
+
+
+
+// Pre: A cube has been labeled
+// Post: scanFirst[label] holds the ScanOrder of the first cell of the block in scan order
+void LabelerClass::FindScanFirst(/*OUT*/vector<size_t>& scanFirst) const    // The first cell of every block
+{
+	size_t cellIndex = ZERO;	// The linear index of the current cell
+	size_t scanIndex;			// The place of the current cell in scan order
+	int label;					// The label of the current cell
+
+	scanFirst.assign(components.size(), labels.size());
+
+	// Every cell is read in storage order, its place in scan order is kept when it is the least
+	for (int x = 0; x < rows; x++)
+	{
+		for (int y = 0; y < cols; y++)
+		{
+			scanIndex = (size_t)x * cols * deps + y;
+
+			for (int z = 0; z < deps; z++, cellIndex++, scanIndex += cols)
+			{
+				label = labels[cellIndex];
+
+				if (label != NO_LABEL && scanIndex < scanFirst[label])
+					scanFirst[label] = scanIndex;
+			}
+		}
+	}
+}// end FindScanFirst
+
+
+
+// Pre: A cube has been labeled, label is a label, other is a label or NO_LABEL,
+//      scanFirst is empty or was filled by FindScanFirst
+// Post: Return true if other is NO_LABEL or the block of label ranks before it.
+//       scanFirst is filled when it is first needed to break a tie
+bool LabelerClass::Precedes(/*IN*/const int& label,                   // The label of the block
+							/*IN*/const int& other,                   // The label of the block it is ranked with
+							/*IN/OUT*/vector<size_t>& scanFirst) const   // The first cell of every block
+{
+	if (other == NO_LABEL || components[label].size > components[other].size)
+		return true;
+
+	if (components[label].size < components[other].size)
+		return false;
+
+	// Only a tie needs the first cells, most searches never find them
+	if (scanFirst.empty())
+		FindScanFirst(scanFirst);
+
+	return scanFirst[label] < scanFirst[other];
+}// end Precedes
+
+
+
+// Pre: The cell location is valid
+// Post: ((x * cols) + y) * deps + z is returned
+size_t LabelerClass::CellIndex(/*IN*/const LocationRec& cell) const     // The desired cell location
+{
+	return ((size_t)cell.x * (size_t)cols + (size_t)cell.y) * (size_t)deps + (size_t)cell.z;
+}// end CellIndex
+
+
+
+
+// ---------------------------------- UnionFindClass ------------------------------------
+
+
+
+// Pre: The type and linear index of the cell starting the label
+// Post: A new provisional label that is its own root and holds no cells is returned
+int UnionFindClass::NewLabel(/*IN*/const int& type,              // The type of the labeled cell
+							 /*IN*/const size_t& firstCell)      // The linear index of the labeled cell
+{
+	int newLabel = (int)parent.size();	// The label being created
+
+	parent.push_back(newLabel);
+	rank.push_back(ZERO);
+	labelType.push_back(type);
+	labelFirst.push_back(firstCell);
+	labelSize.push_back(ZERO);
+
+	return newLabel;
+}// end NewLabel
+
+
+
+// Pre: A valid provisional label
+// Post: The root of the label is returned, the path to it is compressed
+int UnionFindClass::FindRoot(/*IN*/int label)           // The provisional label
+{
+	// Path halving, every visited label is pointed at its grandparent
+	while (parent[label] != label)
+	{
+		parent[label] = parent[parent[label]];
+		label = parent[label];
+	}
+
+	return label;
+}// end FindRoot
+
+
+
+// Pre: label is a provisional label or NO_LABEL, other is a provisional label
+// Post: Both labels share a root, a label in the union is returned
+int UnionFindClass::Merge(/*IN*/const int& label,        // The label given to the cell so far
+						  /*IN*/const int& other)        // The label of a matching neighbor
+{
+	// The cell had no label yet, it joins the neighbor's block
+	if (label == NO_LABEL || label == other)
+		return other;
+
+	int root = FindRoot(label);			// The root of the cell's label
+	int otherRoot = FindRoot(other);	// The root of the neighbor's label
+
+	// Union by rank, the shorter tree goes under the taller one
+	if (root != otherRoot)
+	{
+		if (rank[root] < rank[otherRoot])
+			parent[root] = otherRoot;
+		else if (rank[root] > rank[otherRoot])
+			parent[otherRoot] = root;
+		else
+		{
+			parent[otherRoot] = root;
+			rank[root]++;
+		}
+	}
+
+	return label;
+}// end Merge
+
+
+
+// Pre: A valid provisional label, zStart < zEnd
+// Post: The bounding box and sums of the label hold cells (x, y, zStart) to (x, y, zEnd - 1)
+void UnionFindClass::AddShape(/*IN*/const int& label,            // The provisional label
+							  /*IN*/const int& x,                // The row of the cells
+							  /*IN*/const int& y,                // The column of the cells
+							  /*IN*/const int& zStart,           // The face of the first cell
+							  /*IN*/const int& zEnd)             // The face after the last cell
+{
+	long long cellAmt = zEnd - zStart;	// The amount of cells measured
+
+	// A label is measured from its first cells on
+	if ((size_t)label >= labelShape.size())
+		labelShape.resize((size_t)label + OFFSET, NO_SHAPE);
+
+	ShapeSumRec& shape = labelShape[label];	// The measures of the label
+
+	shape.low.x = min(shape.low.x, x);
+	shape.low.y = min(shape.low.y, y);
+	shape.low.z = min(shape.low.z, zStart);
+	shape.high.x = max(shape.high.x, x);
+	shape.high.y = max(shape.high.y, y);
+	shape.high.z = max(shape.high.z, zEnd - OFFSET);
+	shape.sumX += x * cellAmt;
+	shape.sumY += y * cellAmt;
+	shape.sumZ += ((long long)zStart + zEnd - OFFSET) * cellAmt / 2;
+}// end AddShape
+
+
+
+// Pre: other holds no labels that are unioned with this set
+// Post: Label l of other is label l + the returned base in this set
+int UnionFindClass::Append(/*IN*/const UnionFindClass& other)   // The set being appended
+{
+	int labelBase = (int)parent.size();	// The label the first appended label becomes
+
+	// The parents of the appended labels are shifted past this set's labels
+	for (size_t l = 0; l < other.parent.size(); l++)
+		parent.push_back(other.parent[l] + labelBase);
+
+	rank.insert(rank.end(), other.rank.begin(), other.rank.end());
+	labelType.insert(labelType.end(), other.labelType.begin(), other.labelType.end());
+	labelFirst.insert(labelFirst.end(), other.labelFirst.begin(), other.labelFirst.end());
+	labelSize.insert(labelSize.end(), other.labelSize.begin(), other.labelSize.end());
+
+	// The measures stay beside their labels when either set was measured
+	if (!other.labelShape.empty())
+	{
+		labelShape.resize(labelBase, NO_SHAPE);
+		labelShape.insert(labelShape.end(), other.labelShape.begin(), other.labelShape.end());
+	}
+
+	return labelBase;
+}// end Append
+
+
+
+// Pre: None
+// Post: The amount of provisional labels is returned
+int UnionFindClass::GetLabelAmt() const
+{
+	return (int)parent.size();
+}// end GetLabelAmt
+
+
+
+// Pre: A valid provisional label
+// Post: The type of the label itself is returned
+int UnionFindClass::GetType(/*IN*/const int& label) const
+{
+	return labelType[label];
+}// end GetType
+
+
+
+// Pre: A valid provisional label
+// Post: The first cell given the label itself is returned
+size_t UnionFindClass::GetFirstCell(/*IN*/const int& label) const
+{
+	return labelFirst[label];
+}// end GetFirstCell
+
+
+
+// Pre: A valid provisional label
+// Post: The amount of cells given the label itself is returned
+long long UnionFindClass::GetSize(/*IN*/const int& label) const
+{
+	return labelSize[label];
+}// end GetSize
+
+
+
+// Pre: A label measured by AddShape
+// Post: The bounding box, sums and shared faces of the label itself, not of its root, are returned
+const ShapeSumRec& UnionFindClass::GetShape(/*IN*/const int& label) const
+{
+	return labelShape[label];
+}// end GetShape
+
+
+
+// Pre: None
+// Post: The set holds no labels
+void UnionFindClass::Clear()
+{
+	vector<int>().swap(parent);
+	vector<unsigned char>().swap(rank);
+	vector<int>().swap(labelType);
+	vector<size_t>().swap(labelFirst);
+	vector<long long>().swap(labelSize);
+	vector<ShapeSumRec>().swap(labelShape);
+}// end Clear
+
+
+
+// Pre: None
+// Post: The set holds no labels
+void UnionFindClass::Reset()
+{
+	parent.clear();
+	rank.clear();
+	labelType.clear();
+	labelFirst.clear();
+	labelSize.clear();
+	labelShape.clear();
+}// end Reset
+
+
+
+// The passes are built here for both forms of the cube, so Label can choose them without their bodies
+template void LabelerClass::PickPasses<CubeClass>(SlabPassPtr&, FacePassPtr&) const;
+template void LabelerClass::PickPasses<DefaultCubeClass>(SlabPassPtr&, FacePassPtr&) const;
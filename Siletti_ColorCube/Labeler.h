@@ -0,0 +1,702 @@
+#pragma once
+/*
+    FileName : Labeler.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Labeler Class. The labeler finds every
+        contiguous block of colors in a cube at once. Every cell is given the label of
+        the block it belongs to, and the color and size of every block is recorded.
+
+        The labeling is a two pass union find:
+            Pass 1 - The cube is read row by row in storage order. Each cell is compared
+                     to its already visited neighbors (z - 1, y - 1, x - 1 for faces). A cell with no
+                     matching neighbor gets a new provisional label, otherwise it takes the
+                     label of a neighbor and the labels of all matching neighbors are unioned.
+            Pass 2 - Every provisional label is replaced with the final label of its root,
+                     and the size of each block is counted.
+        The unions use union by rank and path compression.
+
+        The cube may be labeled by several threads. The rows (x) are split into one slab
+        per thread and each thread runs pass 1 on its own slab with its own union find.
+        The slabs are then joined, the cells on either side of each slab face are
+        unioned, and pass 2 runs on each slab in parallel. The labels, sizes and types
+        are the same for any amount of threads.
+
+        Pass 1 can be done cell by cell (CELL_LABELING) or run by run (RUN_LABELING).
+        Run labeling first splits each row along the depth into runs of the same type,
+        comparing 8 (AVX2) or 4 (SSE2) cells at a time, then unions each run with the
+        overlapping runs of the same type in the column before it (y - 1) and the row
+        before it (x - 1). There is one union per overlapping pair of runs instead of
+        one per pair of cells. Both methods give the same labels.
+
+        Cells touch across a face by default, SetConnectivity also allows edges (18
+        neighbors) or corners (26 neighbors). The passes are templates on the policies of
+        Connectivity.h, so each connectivity has its own unrolled neighbor loop. The
+        connectivity is chosen once per Label, never per cell.
+
+        Label takes a cube of either form, CubeClass or a fixed BasicCubeClass (see
+        FixedCube.h). The passes that read the cube are templates on its form, so a fixed
+        cube's rows are read through direct calls its dimensions fold into. Only the choice
+        of pass is made through a pointer, once per slab. A row the cube knows holds no type
+        (see SparseStorage in CubeStorage.h) is skipped without being read or visited.
+        Cell labeling also asks the cube for chunks that hold a single type (see
+        ChunkedStorage and SparseStorage in CubeStorage.h). The cells inside such a chunk, away from its
+        faces, take the label of the cell before them in x with no neighbor compared, so
+        only the cells on the faces of the chunk are stitched to the blocks around it.
+
+        SetGeometry also measures the shape of every block while pass 1 runs, with no
+        pass of its own. Each provisional label keeps its bounding box, the sums of the
+        rows, columns and faces of its cells, and the faces its cells share with a cell
+        of the same type before them (z - 1, y - 1, x - 1). A run adds its cells to the
+        sums at once, and shares a face for each cell after its first and each cell it
+        overlaps in a matching run of the column or row before it. Pass 2 folds the
+        labels of each block together, so a block of S cells sharing F faces has
+        6S - 2F exposed faces, and its centroid is its sums over S. The passes are
+        templates on whether the shape is measured, so a labeling without it is unchanged.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Cells are contiguous when they are neighbors under the connectivity (a shared
+            face unless SetConnectivity chose otherwise) and have the same type
+        2 - Cells with no type are given NO_LABEL and belong to no block
+        3 - Final labels are numbered in the order their first cell appears in storage
+            order. Ties in size are broken as the original flood fill breaks them, by the
+            block whose first cell comes first column wise, then depth, then row (ScanOrder)
+        4 - The cube is not changed by another thread while it is being labeled
+        5 - A face of a cell is exposed when no cell of its block shares it, faces on the
+            outside of the cube are exposed
+        6 - A labeled cube holds at most MAX_LABEL_CELLS cells, so every label of a cell fits
+            in an int. Block sizes are long long so the stream labeler (see StreamLabeler.h),
+            whose labels only number a plane, can count blocks of any size
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - OutOfBoundsException thrown when a cell outside of the labeled cube is asked for
+        2 - InvalidDimensionException thrown when a cube of more than MAX_LABEL_CELLS cells is labeled
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        LabelerClass() - Instantiates a labeler that has not labeled a cube
+        void SetMethod(*IN*const LabelMethodEnum& newMethod) - Chooses how pass 1 is done
+        void SetConnectivity(*IN*const ConnectivityEnum& newConnectivity) - Chooses which cells touch
+        void SetGeometry(*IN*const bool& measure) - Chooses whether the shape of every block is measured
+        void Label<Cube>(*IN*const Cube& colCube,
+                         *IN*const int& threadAmt = 1) - Labels every cell of the cube
+        int GetLabel(*IN*const LocationRec& cell) const - Gets the label of a cell
+        int GetComponentCount() const - Gets the amount of contiguous blocks
+        ComponentRec GetComponent(*IN*const int& label) const - Gets the details of a block
+        GeometryRec GetGeometry(*IN*const int& label) const - Gets the shape of a block
+        void GetSizeHistogram(*OUT*vector<int>& histogram) const - Counts the blocks of each size range
+        void FindLargest(*OUT*int& largest,
+                         *OUT*int& secLargest) const - Finds the two largest blocks
+        void GetComponentCells(*IN*const int& label,
+                               *OUT*ListClass& cellList) const
+                  -  Fills a list with the location of every cell of a block
+        void FindTopK(*IN*const int& k,
+                      *OUT*vector<BlockRec>& blocks,
+                      *IN*const int& type = ANY_TYPE) const
+                  -  Finds the k largest blocks, optionally of one color, with their cells
+
+    PRIVATE MEMBERS:
+        int rows;                           // The amount of rows in the labeled cube
+        int cols;                           // The amount of columns in the labeled cube
+        int deps;                           // The amount of faces in the labeled cube
+        vector<int> labels;                 // The label of every cell, in storage order
+        vector<ComponentRec> components;    // The details of every block, by label
+        vector<GeometryRec> shapes;         // The shape of every block, by label, when measured
+        LabelMethodEnum method;             // How pass 1 is done
+        ConnectivityEnum connectivity;      // Which cells touch
+        bool geometry;                      // True when the shape of every block is measured
+
+        void LabelRows(*IN*const void* cube,
+                       *IN*const int& numRows,
+                       *IN*const int& numCols,
+                       *IN*const int& numDeps,
+                       *IN*const int& threadAmt,
+                       *IN*const SlabPassPtr& slabLabeler,
+                       *IN*const FacePassPtr& faceMerger) - Labels every cell of the cube with the passes chosen
+        void PickPasses<Cube>(*OUT*SlabPassPtr& slabLabeler,
+                              *OUT*FacePassPtr& faceMerger) const
+                  -  Chooses the passes of a form of cube
+        void PickConnectedPasses<Cube, Connectivity>(*OUT*SlabPassPtr& slabLabeler,
+                                                     *OUT*FacePassPtr& faceMerger) const
+                  -  Chooses the passes of a form of cube and a connectivity
+        void LabelSlab<Cube, Connectivity, Measure>(*IN*const void* cube,
+                       *IN*const int& firstRow,
+                       *IN*const int& endRow,
+                       *OUT*UnionFindClass& labelSet) - Gives provisional labels to a slab
+        void LabelSlabRuns<Cube, Connectivity, Measure>(*IN*const void* cube,
+                           *IN*const int& firstRow,
+                           *IN*const int& endRow,
+                           *OUT*UnionFindClass& labelSet) - Gives provisional labels to a slab by runs
+        void MergeSlabFace<Cube, Connectivity>(*IN*const void* cube,
+                           *IN*const int& faceRow,
+                           *IN*const int& aboveBase,
+                           *IN*const int& belowBase,
+                           *IN/OUT*UnionFindClass& labelSet) - Unions the blocks across a slab face
+        void RelabelSlab(*IN*const int& firstRow,
+                         *IN*const int& endRow,
+                         *IN*const int& labelBase,
+                         *IN*const vector<int>& finalLabel) - Gives final labels to a slab
+        void MeasureBlocks(*IN*const UnionFindClass& labelSet,
+                           *IN*const vector<int>& finalLabel) - Gives the shape of every block
+        void FindScanFirst(*OUT*vector<size_t>& scanFirst) const
+                  -  Finds the first cell of every block in scan order
+        bool Precedes(*IN*const int& label,
+                      *IN*const int& other,
+                      *IN/OUT*vector<size_t>& scanFirst) const - Checks if a block ranks before another
+        size_t CellIndex(*IN*const LocationRec& cell) const - Gets the linear index of a cell
+
+                           SUMMARY OF FUNCTIONS:
+        bool ReadCubeRow<Cube>(*IN*const Cube& colCube,
+                               *IN*const int& x,
+                               *IN*const int& y,
+                               *OUT*int rowTypes[]) - Reads a row of a cube of any form
+        size_t ScanOrder(*IN*const size_t& cellIndex,
+                         *IN*const int& numCols,
+                         *IN*const int& numDeps) - Gets the place of a cell in scan order
+        size_t ScanCell(*IN*const size_t& scanIndex,
+                        *IN*const int& numCols,
+                        *IN*const int& numDeps) - Gets the cell at a place in scan order
+
+                           SUMMARY OF UnionFindClass:
+        int NewLabel(*IN*const int& type,
+                     *IN*const size_t& firstCell) - Creates a new provisional label
+        int FindRoot(*IN*int label) - Finds the root of a provisional label
+        int Merge(*IN*const int& label,
+                  *IN*const int& other) - Unions two provisional labels
+        void AddCell(*IN*const int& label) - Counts a cell given a provisional label
+        void AddCells(*IN*const int& label,
+                      *IN*const long long& cellAmt) - Counts several cells given a provisional label
+        void AddShape(*IN*const int& label,
+                      *IN*const int& x,
+                      *IN*const int& y,
+                      *IN*const int& zStart,
+                      *IN*const int& zEnd) - Measures a run of cells given a provisional label
+        void AddSharedFaces(*IN*const int& label,
+                            *IN*const int& faceAmt) - Counts the faces shared by cells of a label
+        int Append(*IN*const UnionFindClass& other) - Appends the labels of another set
+        int GetLabelAmt() const - Gets the amount of provisional labels
+        int GetType(*IN*const int& label) const - Gets the type of a provisional label
+        size_t GetFirstCell(*IN*const int& label) const - Gets the first cell of a label
+        long long GetSize(*IN*const int& label) const - Gets the cells given a provisional label
+        const ShapeSumRec& GetShape(*IN*const int& label) const - Gets the measures of a label
+        void Clear() - Removes every provisional label
+        void Reset() - Removes every provisional label, keeping their memory
+*/
+
+#include <vector>       // Gives access to the vectors holding the labels
+#include <thread>       // Gives access to the threads labeling each slab
+#include <functional>   // Gives access to ref and cref for the thread arguments
+#include <algorithm>    // Gives access to fill for a row with no type
+#include <climits>      // Gives access to INT_MAX for the most cells a labeled cube holds
+#include "Cube.h"       // Grants Access to Cube Class
+#include "Connectivity.h"   // Grants Access to the connectivity policies
+#include "list.h"       // Grants Access to List Class
+#include "TopBlocks.h"  // Grants Access to Top Blocks Class
+
+using namespace std;
+
+
+const int NO_LABEL = -1;    // The label of a cell that belongs to no block
+const int CELL_FACE_AMT = 6;    // The faces of a single cell
+const size_t MAX_LABEL_CELLS = INT_MAX;     // The most cells a labeled cube may hold, every label is an int
+
+
+// Enumerated type of the bit of each face of the cube a block may touch
+enum CubeFaceEnum { LOW_ROW_FACE = 1, HIGH_ROW_FACE = 2, LOW_COL_FACE = 4, HIGH_COL_FACE = 8,
+                    LOW_DEP_FACE = 16, HIGH_DEP_FACE = 32 };
+
+
+// Enumerated type to choose how provisional labels are given
+enum LabelMethodEnum { CELL_LABELING, RUN_LABELING };
+
+
+// O(D)
+// Purpose: Reads the types along the depth of a row of a cube of any form
+// Pre: The row is within the cube, rowTypes can hold its depth
+// Post: rowTypes[z] holds the type of cell (x, y, z), or EMPTY_CELL if the cell has no type.
+//       Return false if the cube knows the row holds no type, every cell is then EMPTY_CELL
+template <class Cube>
+inline bool ReadCubeRow(/*IN*/const Cube& colCube,     // The cube being read
+                        /*IN*/const int& x,            // The row of the desired cells
+                        /*IN*/const int& y,            // The column of the desired cells
+                        /*OUT*/int rowTypes[])         // The type of each cell in the row
+{
+    // A row of a sparse cube with no type is never read
+    if (!colCube.RowHasTypes(x, y))
+    {
+        fill(rowTypes, rowTypes + colCube.GetDeps(), EMPTY_CELL);
+        return false;
+    }
+
+    colCube.GetRowTypes(x, y, rowTypes);
+    return true;
+}// end ReadCubeRow
+
+
+
+// Struct to contain the details of a contiguous block
+struct ComponentRec
+{
+    int type;           // The integer index of the CellType of every cell in the block
+    long long size;     // The amount of cells in the block, beyond an int for a streamed cube
+    size_t firstCell;   // The linear index of the first cell of the block in storage order
+};
+
+
+
+// O(1)
+// Purpose: Gets the place of a cell in scan order, the order the original flood fill starts
+//          blocks in: column wise, then depth, then row
+// Pre: The linear index of a cell in storage order, the columns and faces of its cube
+// Post: (x * deps + z) * cols + y is returned
+inline size_t ScanOrder(/*IN*/const size_t& cellIndex,     // The linear index of the cell
+                        /*IN*/const int& numCols,          // The amount of columns in the cube
+                        /*IN*/const int& numDeps)          // The amount of faces in the cube
+{
+    size_t planeSize = (size_t)numCols * numDeps;   // The amount of cells with the same x
+
+    return cellIndex - cellIndex % planeSize + cellIndex % numDeps * numCols + cellIndex / numDeps % numCols;
+}// end ScanOrder
+
+
+
+// O(1)
+// Purpose: Gets the cell at a place in scan order, the inverse of ScanOrder
+// Pre: The place of a cell in scan order, the columns and faces of its cube
+// Post: The linear index of the cell in storage order is returned
+inline size_t ScanCell(/*IN*/const size_t& scanIndex,      // The place of the cell in scan order
+                       /*IN*/const int& numCols,           // The amount of columns in the cube
+                       /*IN*/const int& numDeps)           // The amount of faces in the cube
+{
+    size_t planeSize = (size_t)numCols * numDeps;   // The amount of cells with the same x
+
+    return scanIndex - scanIndex % planeSize + scanIndex % numCols * numDeps + scanIndex / numCols % numDeps;
+}// end ScanCell
+
+
+// Struct to contain the shape of a contiguous block
+struct GeometryRec
+{
+    LocationRec low;        // The least row, column and face of a cell of the block
+    LocationRec high;       // The greatest row, column and face of a cell of the block
+    double centerX;         // The mean row of the cells of the block
+    double centerY;         // The mean column of the cells of the block
+    double centerZ;         // The mean face of the cells of the block
+    long long exposedFaces; // The faces of the cells of the block no other cell of it shares
+    int cubeFaces;          // The CubeFaceEnum bit of every face of the cube the block touches
+};
+
+
+// Struct to contain the running measures of the cells given a provisional label
+struct ShapeSumRec
+{
+    LocationRec low;        // The least row, column and face of a cell of the label
+    LocationRec high;       // The greatest row, column and face of a cell of the label
+    long long sumX;         // The sum of the rows of the cells of the label
+    long long sumY;         // The sum of the columns of the cells of the label
+    long long sumZ;         // The sum of the faces of the cells of the label
+    long long sharedFaces;  // The faces a cell of the label shares with a matching cell before it
+};
+
+
+// Struct to contain a run of cells of the same type along the depth of a row
+struct RunRec
+{
+    int start;      // The depth of the first cell of the run
+    int end;        // The depth after the last cell of the run
+    int type;       // The integer index of the CellType of every cell in the run
+    int label;      // The provisional label of the run
+};
+
+
+
+// A union find over provisional labels, using union by rank and path compression
+class UnionFindClass
+{
+public:
+
+    // O(1) : Mutator
+    // Purpose: Creates a new provisional label
+    // Pre: The type and linear index of the cell starting the label
+    // Post: A new provisional label that is its own root and holds no cells is returned
+    int NewLabel(/*IN*/const int& type,              // The type of the labeled cell
+                 /*IN*/const size_t& firstCell);     // The linear index of the labeled cell
+
+    // O(a(N)) : Observer Accessor
+    // Purpose: Finds the root of a provisional label
+    // Pre: A valid provisional label
+    // Post: The root of the label is returned, the path to it is compressed
+    int FindRoot(/*IN*/int label);                   // The provisional label
+
+    // O(a(N)) : Mutator
+    // Purpose: Unions two provisional labels
+    // Pre: label is a provisional label or NO_LABEL, other is a provisional label
+    // Post: Both labels share a root, a label in the union is returned
+    int Merge(/*IN*/const int& label,                // The label given to the cell so far
+              /*IN*/const int& other);               // The label of a matching neighbor
+
+    // O(1) : Mutator
+    // Purpose: Counts a cell given a provisional label
+    // Pre: A valid provisional label
+    // Post: The size of the label is incremented
+    void AddCell(/*IN*/const int& label)             // The provisional label
+    {
+        labelSize[label]++;
+    }
+
+    // O(1) : Mutator
+    // Purpose: Counts several cells given a provisional label
+    // Pre: A valid provisional label
+    // Post: The size of the label is increased by cellAmt
+    void AddCells(/*IN*/const int& label,            // The provisional label
+                  /*IN*/const long long& cellAmt)    // The amount of cells given the label
+    {
+        labelSize[label] += cellAmt;
+    }
+
+    // O(1) : Mutator
+    // Purpose: Measures a run of cells along the depth of a row given a provisional label
+    // Pre: A valid provisional label, zStart < zEnd
+    // Post: The bounding box and sums of the label hold cells (x, y, zStart) to (x, y, zEnd - 1)
+    void AddShape(/*IN*/const int& label,            // The provisional label
+                  /*IN*/const int& x,                // The row of the cells
+                  /*IN*/const int& y,                // The column of the cells
+                  /*IN*/const int& zStart,           // The face of the first cell
+                  /*IN*/const int& zEnd);            // The face after the last cell
+
+    // O(1) : Mutator
+    // Purpose: Counts the faces shared by cells of a provisional label and matching cells before them
+    // Pre: A label measured by AddShape
+    // Post: The shared faces of the label are increased by faceAmt
+    void AddSharedFaces(/*IN*/const int& label,      // The provisional label
+                        /*IN*/const int& faceAmt)    // The amount of faces shared
+    {
+        labelShape[label].sharedFaces += faceAmt;
+    }
+
+    // O(L) : Mutator
+    // Purpose: Appends the labels of another set after the labels of this set
+    // Pre: other holds no labels that are unioned with this set
+    // Post: Label l of other is label l + the returned base in this set
+    int Append(/*IN*/const UnionFindClass& other);   // The set being appended
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of provisional labels
+    // Pre: None
+    // Post: The amount of provisional labels is returned
+    int GetLabelAmt() const;
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the type, first cell or size of a provisional label
+    // Pre: A valid provisional label
+    // Post: The detail of the label itself, not of its root, is returned
+    int GetType(/*IN*/const int& label) const;
+    size_t GetFirstCell(/*IN*/const int& label) const;
+    long long GetSize(/*IN*/const int& label) const;
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the measures of a provisional label
+    // Pre: A label measured by AddShape
+    // Post: The bounding box, sums and shared faces of the label itself, not of its root, are returned
+    const ShapeSumRec& GetShape(/*IN*/const int& label) const;
+
+    // O(1) : Mutator
+    // Purpose: Removes every provisional label and releases their memory
+    // Pre: None
+    // Post: The set holds no labels
+    void Clear();
+
+    // O(1) : Mutator
+    // Purpose: Removes every provisional label, keeping their memory for reuse
+    // Pre: None
+    // Post: The set holds no labels
+    void Reset();
+
+private:
+
+    // PDMs
+    vector<int> parent;             // The parent of each provisional label
+    vector<unsigned char> rank;     // The rank of each provisional label
+    vector<int> labelType;          // The type of each provisional label
+    vector<size_t> labelFirst;      // The first cell given each provisional label
+    vector<long long> labelSize;    // The amount of cells given each provisional label
+    vector<ShapeSumRec> labelShape; // The measures of each provisional label, when measured
+
+}; // end UnionFindClass
+
+
+
+class LabelerClass
+{
+public:
+
+    // O(1) : Default Constructor
+    // Purpose: Instantiates a labeler that has not labeled a cube
+    // Pre: None
+    // Post: The labeler holds no blocks
+    LabelerClass();
+
+
+    // O(1) : Mutator
+    // Purpose: Chooses how provisional labels are given in pass 1
+    // Pre: None
+    // Post: Every later call to Label uses newMethod
+    void SetMethod(/*IN*/const LabelMethodEnum& newMethod);     // The desired method
+
+
+    // O(1) : Mutator
+    // Purpose: Chooses which cells of the same type touch
+    // Pre: None
+    // Post: Every later call to Label uses newConnectivity
+    void SetConnectivity(/*IN*/const ConnectivityEnum& newConnectivity);     // The desired connectivity
+
+
+    // O(1) : Mutator
+    // Purpose: Chooses whether the shape of every block is measured while labeling
+    // Pre: None
+    // Post: Every later call to Label measures the shape of every block when measure is true
+    void SetGeometry(/*IN*/const bool& measure);     // True to measure the blocks
+
+
+    // O(N^3 / T) : Mutator
+    // Purpose: Labels every cell of the cube with the contiguous block it belongs to
+    // Pre: The cube to be labeled, a CubeClass or DefaultCubeClass, the amount of threads to label with
+    // Post: Every cell has a label, and the type and size of every block is known
+    //       Any previous labeling is discarded. The result does not depend on threadAmt
+    // Exception: InvalidDimensionException is thrown if the cube holds more than MAX_LABEL_CELLS cells
+    template <class Cube>
+    void Label(/*IN*/const Cube& colCube,           // The cube being labeled
+               /*IN*/const int& threadAmt = 1);     // The amount of threads to label with
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the label of a cell
+    // Pre: A cube has been labeled
+    // Post: The label of the cell is returned, NO_LABEL if the cell has no type
+    // Exception: OutOfBoundsException is thrown if the cell is not within the labeled cube
+    int GetLabel(/*IN*/const LocationRec& cell) const;     // The desired cell location
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of contiguous blocks
+    // Pre: A cube has been labeled
+    // Post: The amount of blocks is returned
+    int GetComponentCount() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the details of a block
+    // Pre: A cube has been labeled, 0 <= label < GetComponentCount()
+    // Post: The type, size and first cell of the block are returned
+    ComponentRec GetComponent(/*IN*/const int& label) const;   // The label of the block
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the shape of a block
+    // Pre: A cube has been labeled with SetGeometry(true), 0 <= label < GetComponentCount()
+    // Post: The bounding box, centroid, exposed faces and the faces of the cube touched by
+    //       the block are returned
+    GeometryRec GetGeometry(/*IN*/const int& label) const;     // The label of the block
+
+
+    // O(C) : Observer Summarizer
+    // Purpose: Counts the blocks of each range of sizes
+    // Pre: A cube has been labeled
+    // Post: histogram[b] holds the amount of blocks of 2^b to 2^(b + 1) - 1 cells, the
+    //       last entry counts the largest block. It is empty when the cube holds no block
+    void GetSizeHistogram(/*OUT*/vector<int>& histogram) const;     // The amount of blocks of each range
+
+
+    // O(C) : Observer Summarizer
+    // Purpose: Finds the two largest blocks
+    // Pre: A cube has been labeled
+    // Post: The labels of the largest and second largest block are returned,
+    //       NO_LABEL is returned in place of a block that does not exist
+    //       Ties are broken by the block whose first cell comes first in scan order
+    void FindLargest(/*OUT*/int& largest,               // The label of the largest block
+                     /*OUT*/int& secLargest) const;     // The label of the second largest block
+
+
+    // O(N^3) : Observer Summarizer
+    // Purpose: Fills a list with the location of every cell of a block
+    // Pre: A cube has been labeled, 0 <= label < GetComponentCount(),
+    //      the list can hold every cell of the block
+    // Post: The list is cleared and holds every cell of the block in storage order
+    void GetComponentCells(/*IN*/const int& label,              // The label of the block
+                           /*OUT*/ListClass& cellList) const;   // The cells of the block
+
+
+    // O(C log K + N^3) : Observer Summarizer
+    // Purpose: Finds the k largest blocks, optionally of one color, with their cells
+    // Pre: A cube has been labeled, k > 0
+    // Post: blocks holds at most k blocks from largest to smallest, ties are broken by
+    //       the block whose first cell comes first in scan order. The id of each block is
+    //       its label. Only blocks of type are considered
+    //       unless type is ANY_TYPE. The cells of the kept blocks are gathered in a
+    //       single sweep, no other block has its cells gathered
+    void FindTopK(/*IN*/const int& k,                       // The most blocks to find
+                  /*OUT*/vector<BlockRec>& blocks,          // The largest blocks
+                  /*IN*/const int& type = ANY_TYPE) const;  // The color of the blocks, or ANY_TYPE
+
+
+private:
+
+    // PDMs
+    int rows;                           // The amount of rows in the labeled cube
+    int cols;                           // The amount of columns in the labeled cube
+    int deps;                           // The amount of faces in the labeled cube
+    vector<int> labels;                 // The label of every cell, in storage order
+    vector<ComponentRec> components;    // The details of every block, by label
+    vector<GeometryRec> shapes;         // The shape of every block, by label, when measured
+    LabelMethodEnum method;             // How pass 1 is done
+    ConnectivityEnum connectivity;      // Which cells touch
+    bool geometry;                      // True when the shape of every block is measured
+
+    // The pass 1 method used on each slab, and the method joining the slabs. The cube is
+    // handed to them untyped, each pass is built for a single form of cube and casts it back
+    typedef void (LabelerClass::*SlabPassPtr)(const void*, const int&, const int&, UnionFindClass&);
+    typedef void (LabelerClass::*FacePassPtr)(const void*, const int&, const int&, const int&, UnionFindClass&);
+
+
+    // O(N^3 / T) : Mutator
+    // Purpose: Labels every cell of the cube with the passes chosen
+    // Pre: The cube to be labeled and its dimensions, the amount of threads to label with,
+    //      the passes PickPasses chose for the form of the cube
+    // Post: Every cell has a label, and the type and size of every block is known
+    //       Any previous labeling is discarded. The result does not depend on threadAmt
+    // Exception: InvalidDimensionException is thrown if the cube holds more than MAX_LABEL_CELLS cells
+    void LabelRows(/*IN*/const void* cube,                  // The cube being labeled
+                   /*IN*/const int& numRows,                // The amount of rows in the cube
+                   /*IN*/const int& numCols,                // The amount of columns in the cube
+                   /*IN*/const int& numDeps,                // The amount of faces in the cube
+                   /*IN*/const int& threadAmt,              // The amount of threads to label with
+                   /*IN*/const SlabPassPtr& slabLabeler,    // The pass 1 method
+                   /*IN*/const FacePassPtr& faceMerger);    // The slab joining method
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Chooses the passes of a form of cube
+    // Pre: Cube is CubeClass or DefaultCubeClass, the forms the passes are built for
+    // Post: slabLabeler gives provisional labels by the method, measuring the blocks when
+    //       geometry is set, faceMerger joins the slabs, both read a Cube and use the
+    //       neighbors of the connectivity
+    template <class Cube>
+    void PickPasses(/*OUT*/SlabPassPtr& slabLabeler,        // The pass 1 method
+                    /*OUT*/FacePassPtr& faceMerger) const;  // The slab joining method
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Chooses the passes of a form of cube and a connectivity
+    // Pre: None
+    // Post: slabLabeler gives provisional labels by the method, measuring the blocks when
+    //       geometry is set, faceMerger joins the slabs, both read a Cube and use the
+    //       neighbors of Connectivity
+    template <class Cube, class Connectivity>
+    void PickConnectedPasses(/*OUT*/SlabPassPtr& slabLabeler,        // The pass 1 method
+                             /*OUT*/FacePassPtr& faceMerger) const;  // The slab joining method
+
+
+    // O(S * B) : Mutator, B the amount of backward neighbors
+    // Purpose: Gives provisional labels to every cell of a slab of rows (pass 1)
+    // Pre: cube points to a Cube, firstRow <= endRow, labelSet holds no labels
+    // Post: Every cell of rows firstRow to endRow - 1 holds a label of labelSet,
+    //       cells in the first row of the slab are not compared to the row before it.
+    //       When Measure every label holds the measures of its cells
+    template <class Cube, class Connectivity, bool Measure>
+    void LabelSlab(/*IN*/const void* cube,              // The cube being labeled
+                   /*IN*/const int& firstRow,           // The first row of the slab
+                   /*IN*/const int& endRow,             // The row after the last row of the slab
+                   /*OUT*/UnionFindClass& labelSet);    // The provisional labels of the slab
+
+
+    // O(S) : Mutator
+    // Purpose: Gives provisional labels to every cell of a slab of rows by runs (pass 1)
+    // Pre: cube points to a Cube, firstRow <= endRow, labelSet holds no labels
+    // Post: Every cell of rows firstRow to endRow - 1 holds a label of labelSet, the
+    //       same labels and measures LabelSlab gives
+    template <class Cube, class Connectivity, bool Measure>
+    void LabelSlabRuns(/*IN*/const void* cube,              // The cube being labeled
+                       /*IN*/const int& firstRow,           // The first row of the slab
+                       /*IN*/const int& endRow,             // The row after the last row of the slab
+                       /*OUT*/UnionFindClass& labelSet);    // The provisional labels of the slab
+
+
+    // O(C * D * B) : Mutator, B the amount of backward neighbors
+    // Purpose: Unions the blocks that touch across the face between two slabs
+    // Pre: cube points to a Cube, the slabs on either side of faceRow have been labeled
+    //      and appended to labelSet
+    // Post: Every pair of matching neighbors across the face shares a root in labelSet,
+    //       when measured each matching pair of level cells shares a face
+    template <class Cube, class Connectivity>
+    void MergeSlabFace(/*IN*/const void* cube,                  // The cube being labeled
+                       /*IN*/const int& faceRow,                // The first row of the lower slab
+                       /*IN*/const int& aboveBase,              // The label base of the upper slab
+                       /*IN*/const int& belowBase,              // The label base of the lower slab
+                       /*IN/OUT*/UnionFindClass& labelSet);     // The joined provisional labels
+
+
+    // O(S) : Mutator
+    // Purpose: Gives final labels to every cell of a slab of rows (pass 2)
+    // Pre: The slab holds provisional labels starting at labelBase in the joined set
+    // Post: Every labeled cell of the slab holds its final label
+    void RelabelSlab(/*IN*/const int& firstRow,             // The first row of the slab
+                     /*IN*/const int& endRow,               // The row after the last row of the slab
+                     /*IN*/const int& labelBase,            // The label base of the slab
+                     /*IN*/const vector<int>& finalLabel);  // The final label of each joined label
+
+
+    // O(L + C) : Mutator
+    // Purpose: Gives the shape of every block from the measures of its provisional labels
+    // Pre: labelSet is every measured provisional label, finalLabel the block of each
+    // Post: shapes holds the shape of every block
+    void MeasureBlocks(/*IN*/const UnionFindClass& labelSet,    // The joined provisional labels
+                       /*IN*/const vector<int>& finalLabel);    // The final label of each joined label
+
+
+    // O(N^3) : Observer Summarizer
+    // Purpose: Finds the first cell of every block in scan order
+    // Pre: A cube has been labeled
+    // Post: scanFirst[label] holds the ScanOrder of the first cell of the block in scan order
+    void FindScanFirst(/*OUT*/vector<size_t>& scanFirst) const;    // The first cell of every block
+
+
+    // O(1), O(N^3) the first time two sizes tie : Observer Predicate
+    // Purpose: Checks if a block ranks before another, larger first then first in scan order
+    // Pre: A cube has been labeled, label is a label, other is a label or NO_LABEL,
+    //      scanFirst is empty or was filled by FindScanFirst
+    // Post: Return true if other is NO_LABEL or the block of label ranks before it.
+    //       scanFirst is filled when it is first needed to break a tie
+    bool Precedes(/*IN*/const int& label,                   // The label of the block
+                  /*IN*/const int& other,                   // The label of the block it is ranked with
+                  /*IN/OUT*/vector<size_t>& scanFirst) const;   // The first cell of every block
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the linear index of a cell within labels
+    // Pre: The cell location is valid
+    // Post: ((x * cols) + y) * deps + z is returned
+    size_t CellIndex(/*IN*/const LocationRec& cell) const;     // The desired cell location
+
+}; // end LabelerClass
+
+
+
+// Pre: The cube to be labeled, a CubeClass or DefaultCubeClass, the amount of threads to label with
+// Post: Every cell has a label, and the type and size of every block is known
+//       Any previous labeling is discarded. The result does not depend on threadAmt
+// Exception: InvalidDimensionException is thrown if the cube holds more than MAX_LABEL_CELLS cells
+template <class Cube>
+void LabelerClass::Label(/*IN*/const Cube& colCube,           // The cube being labeled
+                         /*IN*/const int& threadAmt)          // The amount of threads to label with
+{
+    SlabPassPtr slabLabeler;    // The pass 1 method used on each slab
+    FacePassPtr faceMerger;     // The method joining the slabs
+
+    PickPasses<Cube>(slabLabeler, faceMerger);
+
+    LabelRows(&colCube, colCube.GetRows(), colCube.GetCols(), colCube.GetDeps(), threadAmt,
+              slabLabeler, faceMerger);
+}// end Label
@@ -0,0 +1,110 @@
+#include "MappedFile.h"	// Specification file for the Mapped File class
+
+#ifdef _WIN32
+#include <windows.h>	// Gives access to the file mapping functions
+#else
+#include <sys/mman.h>	// Gives access to mmap
+#include <sys/stat.h>	// Gives access to the size of the file
+#include <fcntl.h>		// Gives access to open
+#include <unistd.h>		// Gives access to close
+#endif
+
+
+
+// Pre: The name of the file
+// Post: Every byte of the file can be read and written through GetData, no byte
+//       has been read from disk yet
+// Exception: CubeFileException is thrown if the file can not be opened or mapped, or is empty
+MappedFileClass::MappedFileClass(/*IN*/const string& fileName)  // The name of the file
+{
+	data = nullptr;
+	size = 0;
+	mapHandle = nullptr;
+
+#ifdef _WIN32
+	LARGE_INTEGER fileSize;		// The size of the file
+	HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+									OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);	// The open file
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		throw CubeFileException();
+
+	if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(fileHandle);
+		throw CubeFileException();
+	}
+
+	// A copy on write mapping, the view keeps the file open once the handle is closed
+	mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(fileHandle);
+
+	if (mapHandle == NULL)
+		throw CubeFileException();
+
+	data = (unsigned char*)MapViewOfFile(mapHandle, FILE_MAP_COPY, 0, 0, 0);
+
+	if (data == NULL)
+	{
+		CloseHandle(mapHandle);
+		throw CubeFileException();
+	}
+
+	size = (size_t)fileSize.QuadPart;
+#else
+	struct stat fileStat;		// Holds the size of the file
+	void* mapped;				// The address the file is mapped to
+	int fileDesc = open(fileName.c_str(), O_RDONLY);	// The open file
+
+	if (fileDesc < 0)
+		throw CubeFileException();
+
+	if (fstat(fileDesc, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		close(fileDesc);
+		throw CubeFileException();
+	}
+
+	// A private mapping copies a page on write, the mapping keeps the file open once closed
+	mapped = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDesc, 0);
+	close(fileDesc);
+
+	if (mapped == MAP_FAILED)
+		throw CubeFileException();
+
+	data = (unsigned char*)mapped;
+	size = (size_t)fileStat.st_size;
+#endif
+}// end Constructor
+
+
+
+// Pre: None
+// Post: The mapping and every page written to are released
+MappedFileClass::~MappedFileClass()
+{
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+	CloseHandle(mapHandle);
+#else
+	munmap(data, size);
+#endif
+}// end Destructor
+
+
+
+// Pre: None
+// Post: The address of the first byte is returned
+unsigned char* MappedFileClass::GetData() const
+{
+	return data;
+}// end GetData
+
+
+
+// Pre: None
+// Post: The size of the file is returned
+size_t MappedFileClass::GetSize() const
+{
+	return size;
+}// end GetSize
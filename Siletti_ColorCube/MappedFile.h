@@ -0,0 +1,89 @@
+#pragma once
+/*
+    FileName : MappedFile.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Mapped File Class. A whole file is mapped
+        into memory instead of being read, the operating system only reads a page of
+        the file the first time it is touched. The mapping is private, writing to it
+        copies the page in memory and never changes the file.
+
+        POSIX systems use mmap, Windows uses CreateFileMapping and MapViewOfFile.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - The file is not changed on disk while it is mapped
+        2 - The file fits in the address space of the process
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - CubeFileException thrown when the file can not be opened or mapped, or is empty
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        MappedFileClass(*IN*const string& fileName) - Maps a whole file copy on write
+        ~MappedFileClass() - Unmaps the file
+        unsigned char* GetData() const - Gets the first byte of the mapped file
+        size_t GetSize() const - Gets the amount of bytes mapped
+
+    PRIVATE MEMBERS:
+        unsigned char* data;    // The first byte of the mapped file
+        size_t size;            // The amount of bytes mapped
+        void* mapHandle;        // The file mapping object, Windows only
+*/
+
+#include <string>               // Gives access to the file name
+#include "CubeExceptions.h"     // For Cube Exception Classes
+
+using namespace std;
+
+
+
+class MappedFileClass
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Maps a whole file copy on write
+    // Pre: The name of the file
+    // Post: Every byte of the file can be read and written through GetData, no byte
+    //       has been read from disk yet
+    // Exception: CubeFileException is thrown if the file can not be opened or mapped, or is empty
+    MappedFileClass(/*IN*/const string& fileName);  // The name of the file
+
+
+    // O(1) : Destructor
+    // Purpose: Unmaps the file
+    // Pre: None
+    // Post: The mapping and every page written to are released
+    ~MappedFileClass();
+
+
+    // A mapping can not be copied, it is released once
+    MappedFileClass(const MappedFileClass&) = delete;
+    MappedFileClass& operator = (const MappedFileClass&) = delete;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the first byte of the mapped file
+    // Pre: None
+    // Post: The address of the first byte is returned
+    unsigned char* GetData() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of bytes mapped
+    // Pre: None
+    // Post: The size of the file is returned
+    size_t GetSize() const;
+
+
+private:
+
+    // PDMs
+    unsigned char* data;    // The first byte of the mapped file
+    size_t size;            // The amount of bytes mapped
+    void* mapHandle;        // The file mapping object, Windows only
+
+}; // end MappedFileClass
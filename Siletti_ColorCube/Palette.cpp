@@ -0,0 +1,169 @@
+#include "Palette.h"	// Specification file for the Palette and Color Count classes
+#include <fstream>	// Gives access to the palette file
+#include <cstring>	// Gives access to the characters not allowed in a name
+
+
+const string DEFAULT_NAMES[DEFAULT_COLOR_AMT] = { "RED", "ORG", "YEL", "GRN", "BLU" };	// The names of ColorEnum
+const char BAD_NAME_CHARS[] = ",\"\\";	// Characters a report would have to escape
+const char NAME_SPACE[] = " \t\r";		// Dropped from around a name in a palette file
+
+
+// -------------------------------- PaletteClass ----------------------------------------
+
+
+
+// Pre: None
+// Post: Color i is named as ColorEnum names it, RED, ORG, YEL, GRN and BLU
+PaletteClass::PaletteClass()
+	: PaletteClass(DEFAULT_COLOR_AMT)
+{
+}// end DC
+
+
+
+// Pre: The amount of colors
+// Post: The first colors are named as ColorEnum names them, every later color i
+//       is named COLOR_NAME_PREFIX followed by i
+// Exception: PaletteException is thrown if colorAmt is not from MIN_PALETTE_AMT to MAX_PALETTE_AMT
+PaletteClass::PaletteClass(/*IN*/const int& colorAmt)       // The amount of colors
+{
+	if (colorAmt < MIN_PALETTE_AMT || colorAmt > MAX_PALETTE_AMT)
+		throw PaletteException();
+
+	names.reserve(colorAmt);
+	colors.reserve(colorAmt);
+
+	for (int i = 0; i < colorAmt; i++)
+	{
+		if (i < DEFAULT_COLOR_AMT)
+			AddName(DEFAULT_NAMES[i]);
+		else
+			AddName(COLOR_NAME_PREFIX + to_string(i));
+	}
+}// end NDC
+
+
+
+// Pre: The name of a palette file
+// Post: Color i is named by the i-th name of the file
+// Exception: PaletteException is thrown if the file can not be read, holds a name that is
+//            invalid or repeated, or holds fewer than MIN_PALETTE_AMT or more than
+//            MAX_PALETTE_AMT names
+PaletteClass::PaletteClass(/*IN*/const string& fileName)    // The palette file
+{
+	ifstream fin(fileName);	// The palette file
+	string line;			// The current line of the file
+	size_t first;			// The first character of the name
+	size_t last;			// The last character of the name
+
+	if (!fin)
+		throw PaletteException();
+
+	while (getline(fin, line))
+	{
+		// A blank line names no color
+		first = line.find_first_not_of(NAME_SPACE);
+		if (first == string::npos)
+			continue;
+
+		if ((int)names.size() >= MAX_PALETTE_AMT)
+			throw PaletteException();
+
+		last = line.find_last_not_of(NAME_SPACE);
+		AddName(line.substr(first, last - first + OFFSET));
+	}
+
+	if (fin.bad() || (int)names.size() < MIN_PALETTE_AMT)
+		throw PaletteException();
+}// end NDC
+
+
+
+int PaletteClass::GetColorAmt() const
+{
+	return (int)names.size();
+}// end GetColorAmt
+
+
+
+// Pre: The integer index of the color
+// Post: The name of the color is returned, OTHER_NAME if it is not in the palette
+const string& PaletteClass::GetName(/*IN*/const int& color) const    // The integer index of the color
+{
+	if (color < ZERO || color >= (int)names.size())
+		return OTHER_NAME;
+
+	return names[color];
+}// end GetName
+
+
+
+const vector<string>& PaletteClass::GetNames() const
+{
+	return names;
+}// end GetNames
+
+
+
+// Pre: The name of a color
+// Post: The integer index of the color is returned, NO_COLOR if no color has the name
+int PaletteClass::FindName(/*IN*/const string& name) const           // The name of the color
+{
+	unordered_map<string, int>::const_iterator found = colors.find(name);	// The entry of the name
+
+	if (found == colors.end())
+		return NO_COLOR;
+
+	return found->second;
+}// end FindName
+
+
+
+// Pre: The name of the new color
+// Post: The color is the last of the palette
+// Exception: PaletteException is thrown if the name is invalid or already in the palette
+void PaletteClass::AddName(/*IN*/const string& name)                 // The name of the new color
+{
+	if (name.empty() || name.size() > (size_t)MAX_NAME_LENGTH)
+		throw PaletteException();
+
+	// Only printable characters a report can hold as they are
+	for (size_t i = 0; i < name.size(); i++)
+		if (name[i] <= ' ' || name[i] > '~' || strchr(BAD_NAME_CHARS, name[i]) != nullptr)
+			throw PaletteException();
+
+	if (!colors.insert(make_pair(name, (int)names.size())).second)
+		throw PaletteException();
+
+	names.push_back(name);
+}// end AddName
+
+
+
+// ------------------------------- ColorCountClass --------------------------------------
+
+
+
+// Pre: The amount of colors of the palette
+// Post: Every count of every color is zero
+ColorCountClass::ColorCountClass(/*IN*/const int& colorAmt)  // The amount of colors
+{
+	Reset(colorAmt);
+}// end NDC
+
+
+
+// Pre: The amount of colors of the palette
+// Post: colorAmt colors are counted and every count is zero
+void ColorCountClass::Reset(/*IN*/const int& colorAmt)      // The amount of colors
+{
+	this->colorAmt = colorAmt;
+	counts.assign((size_t)colorAmt * COLOR_TRACKER, ZERO);
+}// end Reset
+
+
+
+int ColorCountClass::GetColorAmt() const
+{
+	return colorAmt;
+}// end GetColorAmt
@@ -0,0 +1,207 @@
+#pragma once
+/*
+    FileName : Palette.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Palette Class and a Color Count Class. A palette
+        is the list of colors a cube is populated with, chosen when the program is run
+        instead of when it is compiled. It is the DEFAULT_COLOR_AMT colors of ColorEnum,
+        an amount of colors, or the colors named in a palette file.
+
+        The name of color i is entry i of a table, and the color of a name is found in a
+        hash table, so a palette of thousands of colors is as quick to use as one of five.
+
+        A palette of an amount of colors names the first DEFAULT_COLOR_AMT of them as
+        ColorEnum does (RED, ORG, ...), every later color i is named "C" followed by i.
+
+        A palette file holds the name of one color per line, the color of line i (from 0) is
+        color i. Blank lines are skipped, spaces around a name are dropped.
+
+        A Color Count Class holds the amount of each color of a palette, and the amount
+        checked, in a single dense buffer. colArr[color][ZERO] is the amount of the color and
+        colArr[color][OFFSET] the amount checked, as with the fixed array it replaces.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - A palette holds from MIN_PALETTE_AMT to MAX_PALETTE_AMT colors, so every color
+            fits a 16 bit CellType with a value left over for a cell with no type
+        2 - A name is from 1 to MAX_NAME_LENGTH printable characters with no space, comma,
+            quote or backslash, so it fits a cube file and needs no escaping in a report
+        3 - Every name of a palette is different
+        4 - A color given to a Color Count Class is within its palette
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - PaletteException thrown when a palette is given too few or too many colors, when
+            a palette file can not be read, or holds a name that is invalid or repeated
+
+                           SUMMARY OF METHODS:
+    PaletteClass
+        PaletteClass() - Instantiates the DEFAULT_COLOR_AMT colors of ColorEnum
+        PaletteClass(*IN*const int& colorAmt) - Instantiates a palette of an amount of colors
+        PaletteClass(*IN*const string& fileName) - Instantiates the palette named in a file
+        int GetColorAmt() const - Gets the amount of colors in the palette
+        const string& GetName(*IN*const int& color) const - Gets the name of a color
+        const vector<string>& GetNames() const - Gets the name of every color
+        int FindName(*IN*const string& name) const - Gets the color of a name
+
+    ColorCountClass
+        ColorCountClass(*IN*const int& colorAmt) - Instantiates a count of zero for every color
+        void Reset(*IN*const int& colorAmt) - Sets a count of zero for every color of a palette
+        int GetColorAmt() const - Gets the amount of colors counted
+        long long* operator [] (*IN*const int& color) - Gets the counts of a color
+        const long long* operator [] (*IN*const int& color) const - Gets the counts of a color
+
+    PRIVATE METHODS
+        void AddName(*IN*const string& name) - Appends a color to the palette
+
+    PRIVATE MEMBERS:
+        vector<string> names;               // The name of every color, entry i names color i
+        unordered_map<string, int> colors;  // The color of every name
+        vector<long long> counts;           // COLOR_TRACKER counts per color, color by color
+        int colorAmt;                       // The amount of colors counted
+*/
+
+#include <string>           // Gives access to the names of the colors
+#include <vector>           // Gives access to the name table and the counts
+#include <unordered_map>    // Gives access to the color of every name
+#include "Constants.h"      // Gives access to ColorEnum, DEFAULT_COLOR_AMT and COLOR_TRACKER
+#include "CubeExceptions.h" // Gives access to PaletteException
+
+using namespace std;
+
+
+const int MIN_PALETTE_AMT = 2;          // The fewest colors of a palette, a principle and a second
+const int MAX_PALETTE_AMT = 0xFFFF;     // The most colors of a palette, 0xFFFF marks no type
+const int MAX_NAME_LENGTH = 7;          // The longest name, a cube file keeps 8 bytes with a zero
+const int NO_COLOR = -1;                // The color of a name that is not in the palette
+const string OTHER_NAME = "OTH";        // The name of a color outside the palette
+const string COLOR_NAME_PREFIX = "C";   // Starts the name of a color past the ColorEnum colors
+
+
+
+class PaletteClass
+{
+public:
+
+    // O(1) : Default Constructor
+    // Purpose: Instantiates the DEFAULT_COLOR_AMT colors of ColorEnum
+    // Pre: None
+    // Post: Color i is named as ColorEnum names it, RED, ORG, YEL, GRN and BLU
+    PaletteClass();
+
+
+    // O(C) : Non-Default Constructor
+    // Purpose: Instantiates a palette of an amount of colors
+    // Pre: The amount of colors
+    // Post: The first colors are named as ColorEnum names them, every later color i
+    //       is named COLOR_NAME_PREFIX followed by i
+    // Exception: PaletteException is thrown if colorAmt is not from MIN_PALETTE_AMT to MAX_PALETTE_AMT
+    explicit PaletteClass(/*IN*/const int& colorAmt);       // The amount of colors
+
+
+    // O(C) : Non-Default Constructor
+    // Purpose: Instantiates the palette named in a file
+    // Pre: The name of a palette file
+    // Post: Color i is named by the i-th name of the file
+    // Exception: PaletteException is thrown if the file can not be read, holds a name that is
+    //            invalid or repeated, or holds fewer than MIN_PALETTE_AMT or more than
+    //            MAX_PALETTE_AMT names
+    explicit PaletteClass(/*IN*/const string& fileName);    // The palette file
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of colors in the palette
+    // Pre: None
+    // Post: The amount of colors is returned
+    int GetColorAmt() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the name of a color
+    // Pre: The integer index of the color
+    // Post: The name of the color is returned, OTHER_NAME if it is not in the palette
+    const string& GetName(/*IN*/const int& color) const;    // The integer index of the color
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the name of every color
+    // Pre: None
+    // Post: The name table is returned, entry i names color i
+    const vector<string>& GetNames() const;
+
+
+    // O(L) : Observer Accessor
+    // Purpose: Gets the color of a name
+    // Pre: The name of a color
+    // Post: The integer index of the color is returned, NO_COLOR if no color has the name
+    int FindName(/*IN*/const string& name) const;           // The name of the color
+
+
+private:
+
+    // O(L) : Mutator
+    // Purpose: Appends a color to the palette
+    // Pre: The name of the new color
+    // Post: The color is the last of the palette
+    // Exception: PaletteException is thrown if the name is invalid or already in the palette
+    void AddName(/*IN*/const string& name);                 // The name of the new color
+
+
+    // PDMs
+    vector<string> names;               // The name of every color, entry i names color i
+    unordered_map<string, int> colors;  // The color of every name
+
+}; // end PaletteClass
+
+
+
+class ColorCountClass
+{
+public:
+
+    // O(C) : Non-Default Constructor
+    // Purpose: Instantiates a count of zero for every color
+    // Pre: The amount of colors of the palette
+    // Post: Every count of every color is zero
+    explicit ColorCountClass(/*IN*/const int& colorAmt = DEFAULT_COLOR_AMT);  // The amount of colors
+
+
+    // O(C) : Mutator
+    // Purpose: Sets a count of zero for every color of a palette
+    // Pre: The amount of colors of the palette
+    // Post: colorAmt colors are counted and every count is zero
+    void Reset(/*IN*/const int& colorAmt);      // The amount of colors
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of colors counted
+    // Pre: None
+    // Post: The amount of colors is returned
+    int GetColorAmt() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the counts of a color
+    // Pre: The color is within the palette
+    // Post: The COLOR_TRACKER counts of the color are returned, the amount of the color
+    //       first and the amount checked after
+    long long* operator [] (/*IN*/const int& color)         // The integer index of the color
+    {
+        return &counts[(size_t)color * COLOR_TRACKER];
+    }
+
+    const long long* operator [] (/*IN*/const int& color) const // The integer index of the color
+    {
+        return &counts[(size_t)color * COLOR_TRACKER];
+    }
+
+
+private:
+
+    // PDMs
+    vector<long long> counts;   // COLOR_TRACKER counts per color, color by color, beyond an int for a streamed cube
+    int colorAmt;           // The amount of colors counted
+
+}; // end ColorCountClass
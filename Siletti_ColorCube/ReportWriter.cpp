@@ -0,0 +1,268 @@
+#include "ReportWriter.h"	// Specification file for the Report Writer class
+#include <cstdio>	// Gives access to the formatting of fixed numbers
+#include <cstring>	// Gives access to the length of text and copying bytes
+#include <algorithm>	// Gives access to the smaller of two sizes
+
+
+// Pre: The name of every color, entry i names color i, and the format of the report
+// Post: The tables hold the name and grid cell of every color, the buffer is empty
+//       and no file is open
+ReportWriterClass::ReportWriterClass(/*IN*/const vector<string>& palette,      // The name of every color
+									 /*IN*/const ReportFormatEnum& format)    // The format of the report
+	: format(format), buffer(REPORT_BUFFER_SIZE), used(ZERO)
+{
+	// The last entry names every color outside the palette
+	names = palette;
+	names.push_back(OTHER_NAME);
+
+	for (size_t i = 0; i < names.size(); i++)
+		cells.push_back(names[i] + "\t");
+}// end Constructor
+
+
+
+// Pre: None
+// Post: The buffer has been written and the file is closed
+ReportWriterClass::~ReportWriterClass()
+{
+	Close();
+}// end Destructor
+
+
+
+// Pre: None
+// Post: Any file that was open is closed, fileName is opened and emptied, in binary
+//       mode for BINARY_REPORT and text mode otherwise
+void ReportWriterClass::Open(/*IN*/const string& fileName)       // The report file
+{
+	Close();
+
+	if (format == BINARY_REPORT)
+		file.open(fileName, ios::out | ios::trunc | ios::binary);
+	else
+		file.open(fileName, ios::out | ios::trunc);
+}// end Open
+
+
+
+// Pre: None
+// Post: The buffer has been written and is empty, the file is closed
+void ReportWriterClass::Close()
+{
+	Flush();
+
+	if (file.is_open())
+		file.close();
+}// end Close
+
+
+
+// Pre: None
+// Post: Everything put so far is in the file and the buffer is empty
+void ReportWriterClass::Flush()
+{
+	// What is put with no file open is dropped, as an ofstream would
+	if (used > ZERO && file.is_open())
+	{
+		file.write(buffer.data(), (streamsize)used);
+		file.flush();
+	}
+
+	used = ZERO;
+}// end Flush
+
+
+
+// Pre: None
+// Post: The format given at construction is returned
+ReportFormatEnum ReportWriterClass::GetFormat() const
+{
+	return format;
+}// end GetFormat
+
+
+
+// Pre: None
+// Post: The amount of names given at construction is returned
+int ReportWriterClass::GetColorAmt() const
+{
+	return (int)names.size() - OFFSET;
+}// end GetColorAmt
+
+
+
+// Pre: The text is ended by a zero
+// Post: The text is at the end of the buffer
+void ReportWriterClass::PutText(/*IN*/const char* text)       // The text put
+{
+	size_t length = strlen(text);	// The amount of bytes put
+	size_t amount;					// The bytes put into the buffer at a time
+
+	// Text longer than the buffer is put a buffer at a time
+	while (length > ZERO)
+	{
+		MakeRoom(min(length, REPORT_BUFFER_SIZE));
+
+		amount = min(length, REPORT_BUFFER_SIZE - used);
+		memcpy(buffer.data() + used, text, amount);
+		used += amount;
+		text += amount;
+		length -= amount;
+	}
+}// end PutText
+
+
+
+// Pre: None
+// Post: The text is at the end of the buffer
+void ReportWriterClass::PutText(/*IN*/const string& text)     // The text put
+{
+	PutText(text.c_str());
+}// end PutText
+
+
+
+// Pre: None
+// Post: The character is at the end of the buffer
+void ReportWriterClass::PutChar(/*IN*/const char& letter)     // The character put
+{
+	MakeRoom(OFFSET);
+	buffer[used++] = letter;
+}// end PutChar
+
+
+
+// Pre: None
+// Post: The digits of the integer, after a '-' if it is negative, are at the end of the buffer
+void ReportWriterClass::PutInt(/*IN*/const long long& value)  // The integer put
+{
+	char digits[REPORT_NUMBER_SIZE];	// The digits, filled from the last
+	size_t first = REPORT_NUMBER_SIZE;	// The first digit filled
+	unsigned long long rest = value < ZERO ? ZERO - (unsigned long long)value
+										   : (unsigned long long)value;	// The digits not yet filled
+
+	do
+	{
+		digits[--first] = (char)('0' + rest % 10);
+		rest /= 10;
+	} while (rest > ZERO);
+
+	if (value < ZERO)
+		digits[--first] = '-';
+
+	MakeRoom(REPORT_NUMBER_SIZE - first);
+	memcpy(buffer.data() + used, digits + first, REPORT_NUMBER_SIZE - first);
+	used += REPORT_NUMBER_SIZE - first;
+}// end PutInt
+
+
+
+// Pre: None
+// Post: The number rounded to two places is at the end of the buffer
+void ReportWriterClass::PutFixed(/*IN*/const double& value)   // The number put
+{
+	int length;		// The amount of bytes put
+
+	// An ofstream with fixed and setprecision(2) formats the same way
+	MakeRoom(REPORT_NUMBER_SIZE);
+	length = snprintf(buffer.data() + used, REPORT_NUMBER_SIZE, "%.2f", value);
+
+	if (length > ZERO)
+		used += min((size_t)length, REPORT_NUMBER_SIZE - OFFSET);
+}// end PutFixed
+
+
+
+// Pre: None
+// Post: The name of the color is at the end of the buffer, OTHER_NAME if it is not in the palette
+void ReportWriterClass::PutName(/*IN*/const int& type)        // The integer index of the color
+{
+	PutText(names[NameIndex(type)]);
+}// end PutName
+
+
+
+// Pre: None
+// Post: The grid cell of the color is at the end of the buffer
+void ReportWriterClass::PutCell(/*IN*/const int& type)        // The integer index of the color
+{
+	const string& cell = cells[NameIndex(type)];	// The grid cell of the color
+
+	MakeRoom(cell.size());
+	memcpy(buffer.data() + used, cell.data(), cell.size());
+	used += cell.size();
+}// end PutCell
+
+
+
+// Pre: None
+// Post: EMPTY_CELL_TEXT is at the end of the buffer
+void ReportWriterClass::PutEmptyCell()
+{
+	MakeRoom(EMPTY_CELL_TEXT.size());
+	memcpy(buffer.data() + used, EMPTY_CELL_TEXT.data(), EMPTY_CELL_TEXT.size());
+	used += EMPTY_CELL_TEXT.size();
+}// end PutEmptyCell
+
+
+
+// Pre: None
+// Post: The 4 bytes of the integer, in the byte order of the machine, are at the end of the buffer
+void ReportWriterClass::PutBinary(/*IN*/const int& value)     // The integer put
+{
+	int32_t word = (int32_t)value;	// The integer as exactly 32 bits
+
+	MakeRoom(sizeof(word));
+	memcpy(buffer.data() + used, &word, sizeof(word));
+	used += sizeof(word);
+}// end PutBinary
+
+
+
+// Pre: None
+// Post: The 8 bytes of the integer, in the byte order of the machine, are at the end of the buffer
+void ReportWriterClass::PutBinaryLong(/*IN*/const long long& value)   // The integer put
+{
+	int64_t word = (int64_t)value;	// The integer as exactly 64 bits
+
+	MakeRoom(sizeof(word));
+	memcpy(buffer.data() + used, &word, sizeof(word));
+	used += sizeof(word);
+}// end PutBinaryLong
+
+
+
+// Pre: None
+// Post: The name, cut or padded with zeros to PALETTE_NAME_SIZE bytes, is at the end of the buffer
+void ReportWriterClass::PutBinaryName(/*IN*/const int& type)  // The integer index of the color
+{
+	const string& name = names[NameIndex(type)];	// The name of the color
+	size_t amount = min(name.size(), (size_t)PALETTE_NAME_SIZE);	// The bytes of the name kept
+
+	MakeRoom(PALETTE_NAME_SIZE);
+	memset(buffer.data() + used, ZERO, PALETTE_NAME_SIZE);
+	memcpy(buffer.data() + used, name.data(), amount);
+	used += PALETTE_NAME_SIZE;
+}// end PutBinaryName
+
+
+
+// Pre: amount is at most REPORT_BUFFER_SIZE
+// Post: The buffer has room for amount more bytes
+void ReportWriterClass::MakeRoom(/*IN*/const size_t& amount)  // The bytes about to be put
+{
+	if (used + amount > REPORT_BUFFER_SIZE)
+		Flush();
+}// end MakeRoom
+
+
+
+// Pre: None
+// Post: The index of the color is returned, the last entry if it is not in the palette
+size_t ReportWriterClass::NameIndex(/*IN*/const int& type) const  // The integer index of the color
+{
+	if (type < ZERO || type >= (int)names.size() - OFFSET)
+		return names.size() - OFFSET;
+
+	return (size_t)type;
+}// end NameIndex
@@ -0,0 +1,251 @@
+#pragma once
+/*
+    FileName : ReportWriter.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Report Writer Class. It formats a report into a
+        large buffer that is reused for the whole report, and only writes to the file when
+        the buffer is full or the report is done, so a large cube is written in a few
+        large writes instead of a write per cell.
+
+        The name of every color, and the text of a grid cell of each color ("RED\t"), are
+        made once from the palette when the writer is built, so a cell is printed by
+        copying its entry of the table.
+
+        The format of the report is chosen when the writer is built:
+            TEXT_REPORT - The text the client has always written to OUTPUT_FILE_NAME
+            CSV_REPORT - A row for every value, CSV_FILE_NAME
+            JSON_REPORT - A single JSON object, JSON_FILE_NAME
+            BINARY_REPORT - 32 and 64 bit integers in the byte order of the machine, BINARY_FILE_NAME
+        The writer only puts values, the layout of each format is up to the caller.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - The text formats are written in text mode, so a line ends as it does for an
+            ofstream, the binary format is written in binary mode
+        2 - A color name holds no character that needs escaping in CSV or JSON
+        3 - A number is put with the same digits an ofstream gives it, a fixed number with
+            two places as fixed, showpoint and setprecision(2) give it
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - None, as with an ofstream, if the file can not be opened or written what is put
+            is dropped
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        ReportWriterClass(*IN*const vector<string>& palette,
+                          *IN*const ReportFormatEnum& format) - Makes the name tables and the buffer
+        ~ReportWriterClass() - Writes what is left and closes the file
+        void Open(*IN*const string& fileName) - Opens the file the report is written to
+        void Close() - Writes what is left and closes the file
+        void Flush() - Writes the buffer to the file
+        ReportFormatEnum GetFormat() const - Gets the format of the report
+        int GetColorAmt() const - Gets the amount of colors in the palette
+        void PutText(*IN*const char* text) - Puts text
+        void PutText(*IN*const string& text) - Puts text
+        void PutChar(*IN*const char& letter) - Puts a single character
+        void PutInt(*IN*const long long& value) - Puts an integer as text
+        void PutFixed(*IN*const double& value) - Puts a number with two places as text
+        void PutName(*IN*const int& type) - Puts the name of a color
+        void PutCell(*IN*const int& type) - Puts a grid cell of a color, its name and a tab
+        void PutEmptyCell() - Puts a grid cell of no color
+        void PutBinary(*IN*const int& value) - Puts a 32 bit integer
+        void PutBinaryLong(*IN*const long long& value) - Puts a 64 bit integer
+        void PutBinaryName(*IN*const int& type) - Puts the name of a color padded to PALETTE_NAME_SIZE bytes
+
+    PRIVATE METHODS
+        void MakeRoom(*IN*const size_t& amount) - Writes the buffer if amount bytes do not fit
+        size_t NameIndex(*IN*const int& type) const - Finds the entry of a color in the name tables
+
+    PRIVATE MEMBERS:
+        ReportFormatEnum format;    // The format of the report
+        ofstream file;              // The file the report is written to
+        vector<char> buffer;        // The formatted bytes not yet written
+        size_t used;                // The amount of bytes of the buffer in use
+        vector<string> names;       // The name of every color, and OTHER_NAME last
+        vector<string> cells;       // The grid cell of every color, and OTHER_NAME last
+*/
+
+#include <fstream>      // Gives access to the report file
+#include <string>       // Gives access to the names of the colors
+#include <vector>       // Gives access to the buffer and the name tables
+#include <cstdint>      // Gives access to the 32 and 64 bit integers of the binary format
+#include "Constants.h"  // Gives access to ZERO and OFFSET
+#include "CubeFile.h"   // Gives access to PALETTE_NAME_SIZE
+#include "Palette.h"    // Gives access to OTHER_NAME
+
+using namespace std;
+
+
+// The formats a report can be written in
+enum ReportFormatEnum { TEXT_REPORT, CSV_REPORT, JSON_REPORT, BINARY_REPORT };
+
+
+const size_t REPORT_BUFFER_SIZE = 1 << 20;  // The bytes formatted before they are written
+const size_t REPORT_NUMBER_SIZE = 32;       // The most bytes a number is put as
+const string EMPTY_CELL_TEXT = "***\t";     // The grid cell of no color
+const char REPORT_MAGIC[] = "CRPT";         // The first bytes of a binary report
+const int REPORT_VERSION = 2;               // The version of the binary report, 2 has 64 bit counts and sizes
+
+
+
+class ReportWriterClass
+{
+public:
+
+    // O(C) : Constructor
+    // Purpose: Makes the name tables and the buffer
+    // Pre: The name of every color, entry i names color i, and the format of the report
+    // Post: The tables hold the name and grid cell of every color, the buffer is empty
+    //       and no file is open
+    ReportWriterClass(/*IN*/const vector<string>& palette,      // The name of every color
+                      /*IN*/const ReportFormatEnum& format);    // The format of the report
+
+
+    // O(B) : Destructor
+    // Purpose: Writes what is left and closes the file
+    // Pre: None
+    // Post: The buffer has been written and the file is closed
+    ~ReportWriterClass();
+
+
+    // O(1) : Mutator
+    // Purpose: Opens the file the report is written to
+    // Pre: None
+    // Post: Any file that was open is closed, fileName is opened and emptied, in binary
+    //       mode for BINARY_REPORT and text mode otherwise
+    void Open(/*IN*/const string& fileName);       // The report file
+
+
+    // O(B) : Mutator
+    // Purpose: Writes what is left and closes the file
+    // Pre: None
+    // Post: The buffer has been written and is empty, the file is closed
+    void Close();
+
+
+    // O(B) : Mutator
+    // Purpose: Writes the buffer to the file
+    // Pre: None
+    // Post: Everything put so far is in the file and the buffer is empty
+    void Flush();
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the format of the report
+    // Pre: None
+    // Post: The format given at construction is returned
+    ReportFormatEnum GetFormat() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of colors in the palette
+    // Pre: None
+    // Post: The amount of names given at construction is returned
+    int GetColorAmt() const;
+
+
+    // O(L) : Mutator
+    // Purpose: Puts text
+    // Pre: The text is ended by a zero
+    // Post: The text is at the end of the buffer
+    void PutText(/*IN*/const char* text);       // The text put
+
+
+    // O(L) : Mutator
+    // Purpose: Puts text
+    // Pre: None
+    // Post: The text is at the end of the buffer
+    void PutText(/*IN*/const string& text);     // The text put
+
+
+    // O(1) : Mutator
+    // Purpose: Puts a single character
+    // Pre: None
+    // Post: The character is at the end of the buffer
+    void PutChar(/*IN*/const char& letter);     // The character put
+
+
+    // O(1) : Mutator
+    // Purpose: Puts an integer as text
+    // Pre: None
+    // Post: The digits of the integer, after a '-' if it is negative, are at the end of the buffer
+    void PutInt(/*IN*/const long long& value);  // The integer put
+
+
+    // O(1) : Mutator
+    // Purpose: Puts a number with two places as text
+    // Pre: None
+    // Post: The number rounded to two places is at the end of the buffer
+    void PutFixed(/*IN*/const double& value);   // The number put
+
+
+    // O(1) : Mutator
+    // Purpose: Puts the name of a color
+    // Pre: None
+    // Post: The name of the color is at the end of the buffer, OTHER_NAME if it is not in the palette
+    void PutName(/*IN*/const int& type);        // The integer index of the color
+
+
+    // O(1) : Mutator
+    // Purpose: Puts a grid cell of a color, its name and a tab
+    // Pre: None
+    // Post: The grid cell of the color is at the end of the buffer
+    void PutCell(/*IN*/const int& type);        // The integer index of the color
+
+
+    // O(1) : Mutator
+    // Purpose: Puts a grid cell of no color
+    // Pre: None
+    // Post: EMPTY_CELL_TEXT is at the end of the buffer
+    void PutEmptyCell();
+
+
+    // O(1) : Mutator
+    // Purpose: Puts a 32 bit integer
+    // Pre: None
+    // Post: The 4 bytes of the integer, in the byte order of the machine, are at the end of the buffer
+    void PutBinary(/*IN*/const int& value);     // The integer put
+
+
+    // O(1) : Mutator
+    // Purpose: Puts a 64 bit integer
+    // Pre: None
+    // Post: The 8 bytes of the integer, in the byte order of the machine, are at the end of the buffer
+    void PutBinaryLong(/*IN*/const long long& value);   // The integer put
+
+
+    // O(1) : Mutator
+    // Purpose: Puts the name of a color padded to PALETTE_NAME_SIZE bytes
+    // Pre: None
+    // Post: The name, cut or padded with zeros to PALETTE_NAME_SIZE bytes, is at the end of the buffer
+    void PutBinaryName(/*IN*/const int& type);  // The integer index of the color
+
+
+private:
+
+    // O(B) : Mutator
+    // Purpose: Writes the buffer if amount bytes do not fit
+    // Pre: amount is at most REPORT_BUFFER_SIZE
+    // Post: The buffer has room for amount more bytes
+    void MakeRoom(/*IN*/const size_t& amount);  // The bytes about to be put
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Finds the entry of a color in the name tables
+    // Pre: None
+    // Post: The index of the color is returned, the last entry if it is not in the palette
+    size_t NameIndex(/*IN*/const int& type) const;  // The integer index of the color
+
+
+    // PDMs
+    ReportFormatEnum format;    // The format of the report
+    ofstream file;              // The file the report is written to
+    vector<char> buffer;        // The formatted bytes not yet written
+    size_t used;                // The amount of bytes of the buffer in use
+    vector<string> names;       // The name of every color, and OTHER_NAME last
+    vector<string> cells;       // The grid cell of every color, and OTHER_NAME last
+
+}; // end ReportWriterClass
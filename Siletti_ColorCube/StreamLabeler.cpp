@@ -0,0 +1,418 @@
+#include "StreamLabeler.h"	// Specification file for the Stream Labeler class
+#include <cstdio>			// Gives access to remove for the spill files
+#include "Instrument.h"		// Gives access to the instrumentation counters
+#include <unordered_map>	// Gives access to the map of chosen blocks
+
+
+// O(1)
+// Purpose: Gets the link of an open block that closed
+// Pre: The first cell of the closed block
+// Post: A negative link that holds the first cell is returned
+static long long ClosedLink(/*IN*/const size_t& firstCell)	// The first cell of the closed block
+{
+	return -(long long)firstCell - OFFSET;
+}// end ClosedLink
+
+
+
+// O(1)
+// Purpose: Gets the first cell held by the link of an open block that closed
+// Pre: A negative link
+// Post: The first cell of the closed block is returned
+static size_t LinkFirstCell(/*IN*/const long long& link)		// The link of the closed block
+{
+	return (size_t)(-(link + OFFSET));
+}// end LinkFirstCell
+
+
+
+// Pre: None
+// Post: The labeler holds no planes
+StreamLabelerClass::StreamLabelerClass()
+{
+	rows = ZERO;
+	cols = ZERO;
+	deps = ZERO;
+}// end Constructor
+
+
+
+// Pre: None
+// Post: The spill files of the last labeled cube are removed
+StreamLabelerClass::~StreamLabelerClass()
+{
+	RemoveSpills();
+}// end Destructor
+
+
+
+// Pre: The name of a cube file
+// Post: closeBlock has been called once for every contiguous block with its type,
+//       size and first cell in scan order. The spill files for GatherCells are written.
+//       At most two planes and their open blocks are held in memory
+// Exception: CubeFileException is thrown if a file can not be read or written
+void StreamLabelerClass::Label(/*IN*/const string& fileName,                                // The cube file
+							   /*IN*/const function<void(const ComponentRec&)>& closeBlock) // Takes each closed block
+{
+	CubeFileReaderClass reader(fileName);	// Reads the cube a plane at a time
+	UnionFindClass labelSet;			// The labels of the plane being read
+	vector<int> prevTypes;				// The types of the plane before
+	vector<int> currTypes;				// The types of the plane being read
+	vector<int> prevLabels;				// The open block of each cell of the plane before
+	vector<int> currLabels;				// The label, then the open block, of each cell of the plane
+	vector<ComponentRec> openBlocks;	// The blocks open after the plane before
+	vector<ComponentRec> nextOpen;		// The blocks open after the plane being read
+	vector<ComponentRec> rootRec;		// The details of every block, by the root of its labels
+	vector<size_t> rootScan;			// The ScanOrder of the first cell of every block, by the root of its labels
+	vector<int> newOpen;				// The open block each root becomes, NO_LABEL when it closes
+	vector<long long> links;			// The link of each block open after the plane before
+	ofstream labelFile;					// The spill of every plane's open block labels
+	ofstream linkFile;					// The spill of every plane's links
+	size_t planeSize;					// The amount of cells in a plane
+	size_t planeBase;					// The linear index of the first cell of the plane
+	size_t cellIndex;					// The index of the current cell within the plane
+	size_t scanIndex;					// The place of the current cell in scan order
+	int label;							// The label given to the current cell
+	int root;							// The root of a label
+	int type;							// The type of the current cell
+
+	RemoveSpills();
+
+	rows = reader.GetRows();
+	cols = reader.GetCols();
+	deps = reader.GetDeps();
+	planeSize = (size_t)cols * deps;
+	spillName = fileName;
+
+	openAmt.assign(rows, ZERO);
+	linkStart.assign(rows, ZERO);
+
+	labelFile.open(spillName + LABEL_SPILL_EXT, ios::binary | ios::trunc);
+	linkFile.open(spillName + LINK_SPILL_EXT, ios::binary | ios::trunc);
+	if (!labelFile || !linkFile)
+		throw CubeFileException();
+
+	prevTypes.resize(planeSize);
+	currTypes.resize(planeSize);
+	prevLabels.resize(planeSize);
+	currLabels.resize(planeSize);
+
+	for (int i = 0; i < rows; i++)
+	{
+		reader.ReadPlane(currTypes.data());
+		planeBase = (size_t)i * planeSize;
+
+		// Every cell of the plane is compared with its neighbors behind it, when filled
+		INSTRUMENT_ADD(CELLS_VISITED, planeSize);
+		INSTRUMENT_ADD(NEIGHBOR_PROBES, (size_t)cols * (deps - OFFSET) + (size_t)(cols - OFFSET) * deps
+					   + (i > ZERO ? planeSize : ZERO));
+
+		// Every block open after the plane before keeps its index as its label
+		labelSet.Reset();
+		for (size_t a = 0; a < openBlocks.size(); a++)
+		{
+			label = labelSet.NewLabel(openBlocks[a].type, openBlocks[a].firstCell);
+			labelSet.AddCells(label, openBlocks[a].size);
+		}
+
+		// Union each cell with its matching neighbors behind it, z - 1, y - 1 and x - 1
+		for (int j = 0; j < cols; j++)
+		{
+			for (int k = 0; k < deps; k++)
+			{
+				cellIndex = (size_t)j * deps + k;
+				type = currTypes[cellIndex];
+
+				if (type == EMPTY_CELL)
+				{
+					currLabels[cellIndex] = NO_LABEL;
+					continue;
+				}
+
+				label = NO_LABEL;
+
+				if (k > ZERO && currTypes[cellIndex - OFFSET] == type)
+					label = currLabels[cellIndex - OFFSET];
+
+				if (j > ZERO && currTypes[cellIndex - deps] == type)
+					label = labelSet.Merge(label, currLabels[cellIndex - deps]);
+
+				if (i > ZERO && prevTypes[cellIndex] == type)
+					label = labelSet.Merge(label, prevLabels[cellIndex]);
+
+				if (label == NO_LABEL)
+					label = labelSet.NewLabel(type, planeBase + cellIndex);
+
+				labelSet.AddCell(label);
+				currLabels[cellIndex] = label;
+			}
+		}
+
+		// Gather the size and first cell of every block at its root, the first cell of
+		// a label is a cell of its block and of an open block its first in scan order
+		rootRec.resize(labelSet.GetLabelAmt());
+		rootScan.resize(labelSet.GetLabelAmt());
+		newOpen.assign(labelSet.GetLabelAmt(), NO_LABEL);
+
+		for (int l = 0; l < labelSet.GetLabelAmt(); l++)
+		{
+			rootRec[l].type = labelSet.GetType(l);
+			rootRec[l].size = ZERO;
+			rootRec[l].firstCell = labelSet.GetFirstCell(l);
+			rootScan[l] = ScanOrder(rootRec[l].firstCell, cols, deps);
+		}
+
+		for (int l = 0; l < labelSet.GetLabelAmt(); l++)
+		{
+			root = labelSet.FindRoot(l);
+			rootRec[root].size += labelSet.GetSize(l);
+
+			if (rootScan[l] < rootScan[root])
+			{
+				rootScan[root] = rootScan[l];
+				rootRec[root].firstCell = rootRec[l].firstCell;
+			}
+		}
+
+		// A later cell of a label may come first in scan order, so every cell of the plane is checked
+		for (int j = 0; j < cols; j++)
+		{
+			cellIndex = (size_t)j * deps;
+			scanIndex = planeBase + j;
+
+			for (int k = 0; k < deps; k++, cellIndex++, scanIndex += cols)
+			{
+				if (currLabels[cellIndex] == NO_LABEL)
+					continue;
+
+				root = labelSet.FindRoot(currLabels[cellIndex]);
+
+				if (scanIndex < rootScan[root])
+				{
+					rootScan[root] = scanIndex;
+					rootRec[root].firstCell = planeBase + cellIndex;
+				}
+			}
+		}
+
+		// The blocks that reach this plane stay open, numbered in the order they are met
+		nextOpen.clear();
+		for (cellIndex = 0; cellIndex < planeSize; cellIndex++)
+		{
+			if (currLabels[cellIndex] == NO_LABEL)
+				continue;
+
+			root = labelSet.FindRoot(currLabels[cellIndex]);
+
+			if (newOpen[root] == NO_LABEL)
+			{
+				newOpen[root] = (int)nextOpen.size();
+				nextOpen.push_back(rootRec[root]);
+			}
+
+			currLabels[cellIndex] = newOpen[root];
+		}
+
+		// Every other block can no longer grow
+		for (int l = 0; l < labelSet.GetLabelAmt(); l++)
+			if (labelSet.FindRoot(l) == l && newOpen[l] == NO_LABEL)
+				closeBlock(rootRec[l]);
+
+		// Spill where each block open after the plane before went
+		if (i > ZERO)
+		{
+			links.resize(openBlocks.size());
+			for (size_t a = 0; a < openBlocks.size(); a++)
+			{
+				root = labelSet.FindRoot((int)a);
+
+				if (newOpen[root] != NO_LABEL)
+					links[a] = newOpen[root];
+				else
+					links[a] = ClosedLink(rootRec[root].firstCell);
+			}
+
+			linkStart[i - OFFSET] = linkFile.tellp();
+			linkFile.write((const char*)links.data(), links.size() * sizeof(long long));
+		}
+
+		// Spill the open block of every cell of the plane
+		labelFile.write((const char*)currLabels.data(), planeSize * sizeof(int));
+		openAmt[i] = (int)nextOpen.size();
+
+		// The plane being read becomes the plane before
+		prevTypes.swap(currTypes);
+		prevLabels.swap(currLabels);
+		openBlocks.swap(nextOpen);
+	}
+
+	// Every block still open closes after the last plane
+	links.resize(openBlocks.size());
+	for (size_t a = 0; a < openBlocks.size(); a++)
+	{
+		closeBlock(openBlocks[a]);
+		links[a] = ClosedLink(openBlocks[a].firstCell);
+	}
+
+	linkStart[rows - OFFSET] = linkFile.tellp();
+	linkFile.write((const char*)links.data(), links.size() * sizeof(long long));
+
+	labelFile.close();
+	linkFile.close();
+	if (!labelFile || !linkFile)
+		throw CubeFileException();
+}// end Label
+
+
+
+int StreamLabelerClass::GetRows() const
+{
+	return rows;
+}// end GetRows
+
+
+
+int StreamLabelerClass::GetCols() const
+{
+	return cols;
+}// end GetCols
+
+
+
+int StreamLabelerClass::GetDeps() const
+{
+	return deps;
+}// end GetDeps
+
+
+
+// Pre: A cube has been labeled, the id of each block is the ScanOrder of the first cell
+//      it was closed with
+// Post: The cells of each block are listed in storage order, a block of more than
+//       MAX_LIST_LENGTH cells only lists its first cell
+// Exception: CubeFileException is thrown if a spill file can not be read or written
+void StreamLabelerClass::GatherCells(/*IN/OUT*/vector<BlockRec>& blocks)      // The chosen blocks
+{
+	unordered_map<size_t, int> blockOf;	// The index in blocks of each chosen first cell
+	unordered_map<size_t, int>::const_iterator chosen;	// A chosen block found by its first cell
+	vector<int> ownerNext;				// The chosen block each open block of the plane after is in
+	vector<int> ownerCurr;				// The chosen block each open block of the plane is in
+	vector<long long> links;			// Where each open block of the plane went
+	vector<int> planeLabels;			// The open block of each cell of the plane
+	vector<streamoff> ownerStart(rows);	// Where the owners of each plane's open blocks start
+	ifstream labelFile;					// The spill of every plane's open block labels
+	ifstream linkFile;					// The spill of every plane's links
+	fstream ownerFile;					// The spill of every plane's owners
+	ItemRec currItem;					// The cell being added to a list
+	size_t cellIndex;					// The index of the current cell within the plane
+	size_t firstCell;					// The linear index of the first cell of a chosen block
+	size_t planeSize = (size_t)cols * deps;	// The amount of cells in a plane
+	int owner;							// The chosen block of the current cell
+
+	if (blocks.empty())
+		return;
+
+	for (int b = 0; b < (int)blocks.size(); b++)
+	{
+		firstCell = ScanCell(blocks[b].id, cols, deps);
+
+		// A block too large for a list is only given its first cell
+		if (blocks[b].size > MAX_LIST_LENGTH)
+		{
+			blocks[b].cells = ListClass(OFFSET);
+			currItem.key.x = (int)(firstCell / planeSize);
+			currItem.key.y = (int)(firstCell % planeSize / deps);
+			currItem.key.z = (int)(firstCell % deps);
+			blocks[b].cells.Insert(currItem);
+			continue;
+		}
+
+		blockOf[firstCell] = b;
+		blocks[b].cells = ListClass((int)blocks[b].size);
+	}
+
+	labelFile.open(spillName + LABEL_SPILL_EXT, ios::binary);
+	linkFile.open(spillName + LINK_SPILL_EXT, ios::binary);
+	ownerFile.open(spillName + OWNER_SPILL_EXT, ios::in | ios::out | ios::binary | ios::trunc);
+	if (!labelFile || !linkFile || !ownerFile)
+		throw CubeFileException();
+
+	// Follow the links from the last plane back to the first, an open block belongs to
+	// the chosen block its link closes as, or to the owner of the open block it joins
+	for (int i = rows - OFFSET; i >= 0; i--)
+	{
+		links.resize(openAmt[i]);
+		linkFile.seekg(linkStart[i]);
+		linkFile.read((char*)links.data(), links.size() * sizeof(long long));
+
+		ownerCurr.resize(openAmt[i]);
+		for (size_t a = 0; a < links.size(); a++)
+		{
+			if (links[a] >= ZERO)
+				ownerCurr[a] = ownerNext[links[a]];
+			else
+			{
+				chosen = blockOf.find(LinkFirstCell(links[a]));
+				ownerCurr[a] = (chosen == blockOf.end()) ? NO_LABEL : chosen->second;
+			}
+		}
+
+		ownerStart[i] = ownerFile.tellp();
+		ownerFile.write((const char*)ownerCurr.data(), ownerCurr.size() * sizeof(int));
+
+		ownerNext.swap(ownerCurr);
+	}
+
+	if (!linkFile || !ownerFile)
+		throw CubeFileException();
+
+	// Read the planes forwards and list every cell whose open block is owned
+	planeLabels.resize(planeSize);
+	for (int i = 0; i < rows; i++)
+	{
+		labelFile.read((char*)planeLabels.data(), planeLabels.size() * sizeof(int));
+
+		ownerCurr.resize(openAmt[i]);
+		ownerFile.seekg(ownerStart[i]);
+		ownerFile.read((char*)ownerCurr.data(), ownerCurr.size() * sizeof(int));
+
+		if (!labelFile || !ownerFile)
+			throw CubeFileException();
+
+		currItem.key.x = i;
+		for (int j = 0; j < cols; j++)
+		{
+			currItem.key.y = j;
+			for (int k = 0; k < deps; k++)
+			{
+				cellIndex = (size_t)j * deps + k;
+
+				if (planeLabels[cellIndex] == NO_LABEL)
+					continue;
+
+				owner = ownerCurr[planeLabels[cellIndex]];
+
+				if (owner != NO_LABEL)
+				{
+					currItem.key.z = k;
+					blocks[owner].cells.Insert(currItem);
+				}
+			}
+		}
+	}
+}// end GatherCells
+
+
+
+// Pre: None
+// Post: The spill files are removed if there are any
+void StreamLabelerClass::RemoveSpills()
+{
+	if (spillName.empty())
+		return;
+
+	remove((spillName + LABEL_SPILL_EXT).c_str());
+	remove((spillName + LINK_SPILL_EXT).c_str());
+	remove((spillName + OWNER_SPILL_EXT).c_str());
+	spillName.clear();
+}// end RemoveSpills
@@ -0,0 +1,145 @@
+#pragma once
+/*
+    FileName : StreamLabeler.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Stream Labeler Class. The stream labeler finds
+        every contiguous block of colors in a cube file without ever holding the whole
+        cube in memory. The cube is read one x plane at a time and labeled with a rolling
+        window of two planes, the plane before and the plane being read.
+
+        Each plane is labeled with a union find that starts with one label for every block
+        still open in the plane before. Cells are unioned with their matching neighbors
+        at z - 1, y - 1 and x - 1 (in the plane before). Once the plane is done a block
+        that has no cell in it can no longer grow, it is closed and its details are handed
+        to the caller. The blocks that do reach the plane become the open blocks carried
+        to the next plane. Only the labels of the last plane and the open blocks are kept.
+
+        So that the cells of a few chosen blocks can still be listed, each plane's labels
+        and the open block each of the plane before's blocks joined (its link) are spilled
+        to files next to the cube file. GatherCells follows the links backwards from the
+        last plane to learn which open blocks of each plane belong to a chosen block, then
+        reads the labels forwards to list the cells.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Cells are contiguous when they share a face and have the same type
+        2 - A closed block is given with the linear index of its first cell in scan order
+            (see ScanOrder in Labeler.h), the cell the original flood fill would start it
+            from. It is unique, so its ScanOrder ranks ties and chooses blocks for GatherCells
+        3 - Blocks are closed in the order they stop growing, not the order they were found
+        4 - There is room next to the cube file for the spill files, about five bytes per cell
+        5 - The cube may hold more cells than an int counts. Labels are only unique within a
+            plane and stay int, while the sizes of blocks are long long and cells are size_t.
+            A block of more than MAX_LIST_LENGTH cells can not be listed, only its first cell is
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - CubeFileException thrown when the cube file or a spill file can not be read or written
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        StreamLabelerClass() - Instantiates a labeler that has not labeled a cube
+        ~StreamLabelerClass() - Removes the spill files
+        void Label(*IN*const string& fileName,
+                   *IN*const function<void(const ComponentRec&)>& closeBlock)
+                  -  Labels a cube file, handing over every block as it closes
+        int GetRows() const - Gets the amount of rows in the labeled cube
+        int GetCols() const - Gets the amount of columns in the labeled cube
+        int GetDeps() const - Gets the amount of faces in the labeled cube
+        void GatherCells(*IN/OUT*vector<BlockRec>& blocks) - Lists the cells of chosen blocks
+
+    PRIVATE MEMBERS:
+        int rows;                       // The amount of rows in the labeled cube
+        int cols;                       // The amount of columns in the labeled cube
+        int deps;                       // The amount of faces in the labeled cube
+        string spillName;               // The cube file name the spill file names start with
+        vector<int> openAmt;            // The amount of open blocks after each plane
+        vector<streamoff> linkStart;    // Where the links of each plane's open blocks start
+
+        void RemoveSpills() - Removes the spill files
+*/
+
+#include <vector>       // Gives access to the vectors holding the planes
+#include <fstream>      // Gives access to the spill files
+#include <functional>   // Gives access to the function closed blocks are handed to
+#include "Labeler.h"    // Grants Access to the Union Find Class and ComponentRec
+#include "CubeFile.h"   // Grants Access to the Cube File Reader Class
+#include "TopBlocks.h"  // Grants Access to BlockRec
+
+using namespace std;
+
+
+const string LABEL_SPILL_EXT = ".labels";   // Added to the cube file name for the label spill
+const string LINK_SPILL_EXT = ".links";     // Added to the cube file name for the link spill
+const string OWNER_SPILL_EXT = ".owners";   // Added to the cube file name for the owner spill
+
+
+
+class StreamLabelerClass
+{
+public:
+
+    // O(1) : Default Constructor
+    // Purpose: Instantiates a labeler that has not labeled a cube
+    // Pre: None
+    // Post: The labeler holds no planes
+    StreamLabelerClass();
+
+
+    // O(1) : Destructor
+    // Purpose: Removes the spill files
+    // Pre: None
+    // Post: The spill files of the last labeled cube are removed
+    ~StreamLabelerClass();
+
+
+    // O(N^3) : Mutator
+    // Purpose: Labels a cube file, handing over every block as it closes
+    // Pre: The name of a cube file
+    // Post: closeBlock has been called once for every contiguous block with its type,
+    //       size and first cell in scan order. The spill files for GatherCells are written.
+    //       At most two planes and their open blocks are held in memory
+    // Exception: CubeFileException is thrown if a file can not be read or written
+    void Label(/*IN*/const string& fileName,                                // The cube file
+               /*IN*/const function<void(const ComponentRec&)>& closeBlock); // Takes each closed block
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the dimensions of the labeled cube
+    // Pre: A cube has been labeled
+    // Post: The amount of rows, columns or faces is returned
+    int GetRows() const;
+    int GetCols() const;
+    int GetDeps() const;
+
+
+    // O(N^3) : Observer Summarizer
+    // Purpose: Lists the cells of chosen blocks
+    // Pre: A cube has been labeled, the id of each block is the ScanOrder of the first cell
+    //      it was closed with
+    // Post: The cells of each block are listed in storage order, a block of more than
+    //       MAX_LIST_LENGTH cells only lists its first cell
+    // Exception: CubeFileException is thrown if a spill file can not be read or written
+    void GatherCells(/*IN/OUT*/vector<BlockRec>& blocks);      // The chosen blocks
+
+
+private:
+
+    // PDMs
+    int rows;                       // The amount of rows in the labeled cube
+    int cols;                       // The amount of columns in the labeled cube
+    int deps;                       // The amount of faces in the labeled cube
+    string spillName;               // The cube file name the spill file names start with
+    vector<int> openAmt;            // The amount of open blocks after each plane
+    vector<streamoff> linkStart;    // Where the links of each plane's open blocks start
+
+
+    // O(1)
+    // Purpose: Removes the spill files
+    // Pre: None
+    // Post: The spill files are removed if there are any
+    void RemoveSpills();
+
+}; // end StreamLabelerClass
@@ -0,0 +1,174 @@
+#include "ThreadPool.h"	// Specification file for the Thread Pool class
+#include "Constants.h"	// Gives access to ZERO and OFFSET
+
+
+
+// Pre: threadAmt > 0
+// Post: threadAmt threads are waiting for a run
+ThreadPoolClass::ThreadPoolClass(/*IN*/const int& threadAmt)    // The amount of threads
+{
+	work = nullptr;
+	runAmt = ZERO;
+	busyAmt = ZERO;
+	stopping = false;
+
+	for (int w = 0; w < threadAmt; w++)
+		queues.push_back(unique_ptr<JobQueueRec>(new JobQueueRec()));
+
+	// The queues exist before any thread can look at them
+	for (int w = 0; w < threadAmt; w++)
+		workers.push_back(thread(&ThreadPoolClass::WorkerLoop, this, w));
+}// end Constructor
+
+
+
+// Pre: No run is in progress
+// Post: Every thread has ended
+ThreadPoolClass::~ThreadPoolClass()
+{
+	{
+		lock_guard<mutex> guard(runLock);
+		stopping = true;
+	}
+	runStart.notify_all();
+
+	for (size_t w = 0; w < workers.size(); w++)
+		workers[w].join();
+}// end Destructor
+
+
+
+// Pre: None
+// Post: The amount of threads is returned, jobs are told a thread from 0 to one less
+int ThreadPoolClass::GetThreadAmt() const
+{
+	return (int)workers.size();
+}// end GetThreadAmt
+
+
+
+// Pre: The amount of jobs and the work, work(job, thread) runs a single job
+// Post: work has been called once for every job
+// Exception: The first exception thrown by a job is thrown once every job has run
+void ThreadPoolClass::Run(/*IN*/const int& jobAmt,                                       // The amount of jobs
+						  /*IN*/const function<void(const int&, const int&)>& work)    // Runs a job on a thread
+{
+	int threadAmt = (int)workers.size();	// The amount of threads
+	exception_ptr error;					// The first exception thrown by a job
+
+	// Deal each thread an even share of the jobs, in order
+	for (int w = 0; w < threadAmt; w++)
+	{
+		lock_guard<mutex> guard(queues[w]->lock);
+
+		for (int j = (int)((long long)jobAmt * w / threadAmt); j < (long long)jobAmt * (w + OFFSET) / threadAmt; j++)
+			queues[w]->jobs.push_back(j);
+	}
+
+	unique_lock<mutex> guard(runLock);
+
+	this->work = &work;
+	firstError = nullptr;
+	busyAmt = threadAmt;
+	runAmt++;
+	runStart.notify_all();
+
+	// Wait for every thread to run out of jobs
+	runDone.wait(guard, [this] { return busyAmt == ZERO; });
+
+	this->work = nullptr;
+	error = firstError;
+	firstError = nullptr;
+	guard.unlock();
+
+	if (error)
+		rethrow_exception(error);
+}// end Run
+
+
+
+// Pre: The number of the thread
+// Post: The thread has ended once the pool is stopping
+void ThreadPoolClass::WorkerLoop(/*IN*/int worker)          // The number of the thread
+{
+	int runsSeen = ZERO;	// The amount of runs this thread has worked
+	int job;				// The job being run
+
+	while (true)
+	{
+		{
+			unique_lock<mutex> guard(runLock);
+
+			// Wait for a run this thread has not worked yet
+			runStart.wait(guard, [&] { return stopping || runAmt != runsSeen; });
+
+			if (stopping)
+				return;
+
+			runsSeen = runAmt;
+		}
+
+		while (TakeJob(worker, job))
+		{
+			try
+			{
+				(*work)(job, worker);
+			}
+			catch (...)
+			{
+				lock_guard<mutex> guard(runLock);
+
+				if (!firstError)
+					firstError = current_exception();
+			}
+		}
+
+		{
+			lock_guard<mutex> guard(runLock);
+
+			busyAmt--;
+			if (busyAmt == ZERO)
+				runDone.notify_one();
+		}
+	}
+}// end WorkerLoop
+
+
+
+// Pre: The number of the thread
+// Post: Return true with the job taken, false once every deque is empty
+bool ThreadPoolClass::TakeJob(/*IN*/const int& worker,       // The number of the thread
+							  /*OUT*/int& job)              // The job taken
+{
+	int threadAmt = (int)queues.size();	// The amount of threads
+	int victim;							// The thread being stolen from
+
+	// Take the newest job of its own
+	{
+		lock_guard<mutex> guard(queues[worker]->lock);
+
+		if (!queues[worker]->jobs.empty())
+		{
+			job = queues[worker]->jobs.back();
+			queues[worker]->jobs.pop_back();
+			return true;
+		}
+	}
+
+	// Steal the oldest job of another thread, starting with the next one
+	for (int i = OFFSET; i < threadAmt; i++)
+	{
+		victim = (worker + i) % threadAmt;
+		lock_guard<mutex> guard(queues[victim]->lock);
+
+		if (!queues[victim]->jobs.empty())
+		{
+			job = queues[victim]->jobs.front();
+			queues[victim]->jobs.pop_front();
+			return true;
+		}
+	}
+
+	// No job is added during a run, so every deque stays empty
+	return false;
+}// end TakeJob
@@ -0,0 +1,143 @@
+#pragma once
+/*
+    FileName : ThreadPool.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Thread Pool Class. The pool starts its threads
+        once and runs batches of numbered jobs on them, so a thread is never started per
+        job. Each run hands every thread a deque holding an even share of the jobs. A
+        thread works from the back of its own deque, and once it is empty steals from the
+        front of the other threads' deques, so a thread that drew cheap jobs helps with
+        the expensive ones.
+
+        Every job is told which thread runs it, so state that is costly to build (a cube,
+        a labeler, buffers) can be kept per thread and reused from job to job.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Jobs are independent, they may run in any order and on any thread
+        2 - Only one run is in progress at a time, Run is not called from inside a job
+        3 - A job only touches state of its own or of the thread it is told
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - An exception thrown by a job is caught on its thread, the other jobs still run
+            and the first exception caught is thrown again by Run
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        ThreadPoolClass(*IN*const int& threadAmt) - Starts the threads of the pool
+        ~ThreadPoolClass() - Stops and joins every thread
+        int GetThreadAmt() const - Gets the amount of threads in the pool
+        void Run(*IN*const int& jobAmt,
+                 *IN*const function<void(const int&, const int&)>& work)
+                  -  Runs jobs 0 to jobAmt - 1 and waits for all of them
+
+    PRIVATE MEMBERS:
+        vector<thread> workers;                     // The threads of the pool
+        vector<unique_ptr<JobQueueRec>> queues;     // The jobs waiting on each thread
+        mutex runLock;                              // Guards the members below
+        condition_variable runStart;                // Signals the threads a run has started
+        condition_variable runDone;                 // Signals Run every thread is idle
+        const function<...>* work;                  // The work of the current run
+        int runAmt;                                 // The amount of runs started
+        int busyAmt;                                // The amount of threads still working
+        bool stopping;                              // Set once the pool is being destroyed
+        exception_ptr firstError;                   // The first exception thrown by a job
+
+        void WorkerLoop(*IN*int worker) - Waits for runs and works their jobs
+        bool TakeJob(*IN*const int& worker,
+                     *OUT*int& job) - Takes a job of its own or steals one
+*/
+
+#include <vector>               // Gives access to the threads and queues
+#include <deque>                // Gives access to the deques of jobs
+#include <memory>               // Gives access to the pointers owning the queues
+#include <thread>               // Gives access to the threads of the pool
+#include <mutex>                // Gives access to the locks guarding the queues
+#include <condition_variable>   // Gives access to the run signals
+#include <functional>           // Gives access to the work of a run
+#include <exception>            // Gives access to the exception thrown by a job
+
+using namespace std;
+
+
+// Struct to contain the jobs waiting on one thread
+struct JobQueueRec
+{
+    mutex lock;         // Guards the jobs, the owner and thieves both take from them
+    deque<int> jobs;    // The jobs waiting, the owner takes the back and thieves the front
+};
+
+
+
+class ThreadPoolClass
+{
+public:
+
+    // O(T) : Constructor
+    // Purpose: Starts the threads of the pool
+    // Pre: threadAmt > 0
+    // Post: threadAmt threads are waiting for a run
+    ThreadPoolClass(/*IN*/const int& threadAmt);    // The amount of threads
+
+
+    // O(T) : Destructor
+    // Purpose: Stops and joins every thread
+    // Pre: No run is in progress
+    // Post: Every thread has ended
+    ~ThreadPoolClass();
+
+
+    // A pool owns its threads, it can not be copied
+    ThreadPoolClass(const ThreadPoolClass&) = delete;
+    ThreadPoolClass& operator = (const ThreadPoolClass&) = delete;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of threads in the pool
+    // Pre: None
+    // Post: The amount of threads is returned, jobs are told a thread from 0 to one less
+    int GetThreadAmt() const;
+
+
+    // O(J / T) : Mutator, with J jobs of even cost
+    // Purpose: Runs jobs 0 to jobAmt - 1 and waits for all of them
+    // Pre: The amount of jobs and the work, work(job, thread) runs a single job
+    // Post: work has been called once for every job
+    // Exception: The first exception thrown by a job is thrown once every job has run
+    void Run(/*IN*/const int& jobAmt,                                       // The amount of jobs
+             /*IN*/const function<void(const int&, const int&)>& work);    // Runs a job on a thread
+
+
+private:
+
+    // PDMs
+    vector<thread> workers;                     // The threads of the pool
+    vector<unique_ptr<JobQueueRec>> queues;     // The jobs waiting on each thread
+    mutex runLock;                              // Guards the members below
+    condition_variable runStart;                // Signals the threads a run has started
+    condition_variable runDone;                 // Signals Run every thread is idle
+    const function<void(const int&, const int&)>* work;    // The work of the current run
+    int runAmt;                                 // The amount of runs started
+    int busyAmt;                                // The amount of threads still working
+    bool stopping;                              // Set once the pool is being destroyed
+    exception_ptr firstError;                   // The first exception thrown by a job
+
+
+    // O(J / T)
+    // Purpose: Waits for runs and works their jobs
+    // Pre: The number of the thread
+    // Post: The thread has ended once the pool is stopping
+    void WorkerLoop(/*IN*/int worker);          // The number of the thread
+
+
+    // O(T)
+    // Purpose: Takes a job of its own or steals one
+    // Pre: The number of the thread
+    // Post: Return true with the job taken, false once every deque is empty
+    bool TakeJob(/*IN*/const int& worker,       // The number of the thread
+                 /*OUT*/int& job);              // The job taken
+
+}; // end ThreadPoolClass
@@ -0,0 +1,91 @@
+#include "TopBlocks.h"	// Specification file for the Top Blocks class
+#include <algorithm>	// Gives access to the heap operations
+
+
+// O(1)
+// Purpose: Compares two blocks for the heap
+// Pre: The blocks being compared
+// Post: Return true if left is the better block, larger or found first,
+//		 so the heap keeps its worst block at the top
+static bool BetterBlock(/*IN*/const BlockRec& left,		// The first block
+						/*IN*/const BlockRec& right)	// The second block
+{
+	return left.size > right.size || (left.size == right.size && left.id < right.id);
+}// end BetterBlock
+
+
+
+// Pre: k > 0
+// Post: No blocks are kept, at most k will be. The heap grows with the blocks kept,
+//       k may be far more than the blocks a cube holds
+TopBlocksClass::TopBlocksClass(/*IN*/const int& k)     // The most blocks kept
+{
+	limit = k;
+}// end Constructor
+
+
+
+// Pre: None
+// Post: The k given at construction is returned
+int TopBlocksClass::GetLimit() const
+{
+	return limit;
+}// end GetLimit
+
+
+
+// Pre: None
+// Post: The size of the worst kept block is returned once k blocks are kept,
+//       before then 0 is returned
+long long TopBlocksClass::GetBound() const
+{
+	if ((int)heap.size() < limit)
+		return ZERO;
+
+	return heap.front().size;
+}// end GetBound
+
+
+
+// Pre: The size of a block found after every block offered so far
+// Post: Return true if the block would be kept by Offer
+bool TopBlocksClass::Accepts(/*IN*/const long long& size) const    // The size of the block
+{
+	// A later block must be strictly larger to beat the worst kept block
+	return (int)heap.size() < limit || size > heap.front().size;
+}// end Accepts
+
+
+
+// Pre: The block being offered
+// Post: The block is moved into the heap if it is one of the k best offered, larger
+//       or of the same size with a lower id, the worst kept block is dropped when
+//       there are more than k
+void TopBlocksClass::Offer(/*IN/OUT*/BlockRec& block)          // The block being offered
+{
+	// Drop the block if it can not beat the worst kept block
+	if ((int)heap.size() >= limit && !BetterBlock(block, heap.front()))
+		return;
+
+	heap.push_back(move(block));
+	push_heap(heap.begin(), heap.end(), BetterBlock);
+
+	// Drop the worst kept block
+	if ((int)heap.size() > limit)
+	{
+		pop_heap(heap.begin(), heap.end(), BetterBlock);
+		heap.pop_back();
+	}
+}// end Offer
+
+
+
+// Pre: None
+// Post: blocks holds the kept blocks from best to worst, the heap is empty
+void TopBlocksClass::TakeSorted(/*OUT*/vector<BlockRec>& blocks)   // The kept blocks
+{
+	sort_heap(heap.begin(), heap.end(), BetterBlock);
+
+	blocks.clear();
+	blocks.swap(heap);
+}// end TakeSorted
@@ -0,0 +1,117 @@
+#pragma once
+/*
+    FileName : TopBlocks.h
+    Project Color Cuberator
+
+    PURPOSE:
+        Contains the specifications for a Top Blocks Class. It keeps the K largest
+        contiguous blocks offered to it in a bounded min-heap, the smallest kept block
+        sits at the top of the heap so a new block only has to beat it to make the cut.
+
+        GetBound gives the size the K-th best block has reached. A search may skip any
+        block (or any color) that can not hold more cells than the bound, and only has
+        to build the cell list of a block that Accepts says will be kept.
+
+
+    ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+        1 - Blocks are offered with an id in the order the original flood fill finds them
+            (a running count of a search in its order, or the ScanOrder of the first cell).
+            Of two blocks of the same size the lower id is better, so every search breaks
+            ties as the original one does. Accepts is only used while ids are offered in
+            increasing order
+        2 - A color filter of ANY_TYPE keeps blocks of every color
+
+
+    EXCEPTION HANDLING/ERROR CHECKING:
+        1 - None, a block that does not make the cut is simply dropped
+
+                           SUMMARY OF METHODS:
+    PUBLIC METHODS
+        TopBlocksClass(*IN*const int& k) - Instantiates an empty heap keeping at most k blocks
+        int GetLimit() const - Gets the amount of blocks that are kept
+        long long GetBound() const - Gets the size a block must beat to make the cut
+        bool Accepts(*IN*const long long& size) const - Checks if a block of a size would be kept
+        void Offer(*IN/OUT*BlockRec& block) - Keeps a block if it makes the cut
+        void TakeSorted(*OUT*vector<BlockRec>& blocks) - Takes the kept blocks, largest first
+
+    PRIVATE MEMBERS:
+        int limit;                  // The most blocks kept
+        vector<BlockRec> heap;      // The kept blocks, the worst kept block first
+*/
+
+#include <vector>       // Gives access to the vector holding the heap
+#include "list.h"       // Grants Access to List Class
+
+using namespace std;
+
+
+const int ANY_TYPE = -1;    // The color filter that keeps blocks of every color
+
+
+// Struct to contain a contiguous block selected by a top K search
+struct BlockRec
+{
+    int type;           // The integer index of the CellType of every cell in the block
+    long long size;     // The amount of cells in the block
+    size_t id;          // The order or first cell the block was ranked by, lower wins ties
+    ListClass cells;    // The location of every cell in the block
+};
+
+
+
+class TopBlocksClass
+{
+public:
+
+    // O(1) : Constructor
+    // Purpose: Instantiates an empty heap
+    // Pre: k > 0
+    // Post: No blocks are kept, at most k will be
+    TopBlocksClass(/*IN*/const int& k);     // The most blocks kept
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the amount of blocks that are kept
+    // Pre: None
+    // Post: The k given at construction is returned
+    int GetLimit() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Gets the size a block must beat to make the cut
+    // Pre: None
+    // Post: The size of the worst kept block is returned once k blocks are kept,
+    //       before then 0 is returned
+    long long GetBound() const;
+
+
+    // O(1) : Observer Accessor
+    // Purpose: Checks if a block of a size would be kept
+    // Pre: The size of a block found after every block offered so far
+    // Post: Return true if the block would be kept by Offer
+    bool Accepts(/*IN*/const long long& size) const;    // The size of the block
+
+
+    // O(log K) : Mutator
+    // Purpose: Keeps a block if it makes the cut
+    // Pre: The block being offered
+    // Post: The block is moved into the heap if it is one of the k best offered, larger
+    //       or of the same size with a lower id, the worst kept block is dropped when
+    //       there are more than k
+    void Offer(/*IN/OUT*/BlockRec& block);          // The block being offered
+
+
+    // O(K log K) : Mutator
+    // Purpose: Takes the kept blocks, largest first
+    // Pre: None
+    // Post: blocks holds the kept blocks from best to worst, the heap is empty
+    void TakeSorted(/*OUT*/vector<BlockRec>& blocks);   // The kept blocks
+
+
+private:
+
+    // PDMs
+    int limit;                  // The most blocks kept
+    vector<BlockRec> heap;      // The kept blocks, the worst kept block first
+
+}; // end TopBlocksClass
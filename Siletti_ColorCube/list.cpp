@@ -1,15 +1,78 @@
 #include "list.h"
+#include "Instrument.h"	// Gives access to the instrumentation counters
+#include <cstdint>	// Gives access to the fixed width hash words
+#include <utility>	// Gives access to swap
+
+//************************************************************************
+
+//Pre: The key being hashed
+//Post: A well mixed hash of every coordinate of the key is returned
+static size_t HashKey(/* in */ const KeyType& key)	//key to hash
+{
+	uint64_t hash;	// The mixed coordinates
+
+	hash = (uint64_t)(uint32_t)key.x * 0x9E3779B97F4A7C15ULL;
+	hash ^= (uint64_t)(uint32_t)key.y * 0xC2B2AE3D27D4EB4FULL;
+	hash ^= (uint64_t)(uint32_t)key.z * 0x165667B19E3779F9ULL;
+
+	return (size_t)(hash ^ (hash >> 32));
+}//end HashKey
+
+//************************************************************************
+
+//Pre: The keys being compared
+//Post: true is returned if all x, y, z coordinates match
+static bool SameKey(/* in */ const KeyType& left,		//first key
+					/* in */ const KeyType& right)	//second key
+{
+	return left.x == right.x && left.y == right.y && left.z == right.z;
+}//end SameKey
 
 //************************************************************************
 
 //Pre: None 
 //Post: length & currPos have been initialized to zero.
 ListClass::ListClass() //default construcutor
+	: ListClass(MAX_ENTRIES)
+{
+}//end default constructor
+
+//************************************************************************
+
+//Pre: maxLength > 0
+//Post: length & currPos have been initialized to zero, the list 
+//		can hold maxLength entries
+ListClass::ListClass(/* in */ int maxLength) //Most entries the list can hold
 {
 	currPos = 0;
 	length = 0;
+	maxEntries = maxLength;
+	indexed = false;
+	indexMask = 0;
 
-}//end default constructor
+}//end constructor
+
+//************************************************************************
+
+//Pre: orig contains a list to be copied
+//Post: the new list contains a copy of orig
+ListClass::ListClass(/* in */ const ListClass& orig)	//List to copy
+	: ListClass(orig.maxEntries)
+{
+	*this = orig;
+
+}//end copy constructor
+
+//************************************************************************
+
+//Pre: orig contains a list
+//Post: the new list holds what orig held, orig is empty
+ListClass::ListClass(/* in/out */ ListClass&& orig) noexcept	//List to take from
+	: ListClass(orig.maxEntries)
+{
+	Swap(orig);
+
+}//end move constructor
 
 //************************************************************************
 
@@ -63,7 +126,7 @@ bool ListClass::IsEmpty() const
 bool ListClass::IsFull() const
 // returns TRUE if list is full
 {
-	return (length == MAX_ENTRIES);
+	return (length == maxEntries);
 }//End IsFull
 
 //************************************************************************
@@ -104,21 +167,43 @@ bool ListClass::Find( /*in*/ KeyType target) //value to search for
 
 	if (IsEmpty())
 		return false;
+	else if (indexed)
+	{	// look the target up in the membership index
+		size_t slot = IndexSlot(target);
+
+		INSTRUMENT_COUNT(LIST_FIND_COMPARES);
+
+		if (indexTable[slot] == NO_POSITION)
+		{
+			currPos = length - 1;
+			return false;
+		}
+
+		currPos = indexTable[slot];
+		return true;
+	}
 	else
 	{   // search list  for target and set currPos if found
 		// All x, y, z coordinates must be checked
-		while ((listArr[currPos].key.x != target.x || // Christian Siletti
+		// The bound is checked first so the unused slot at length is never compared
+		while (currPos < length && (listArr[currPos].key.x != target.x ||
 				listArr[currPos].key.y != target.y 
-				|| listArr[currPos].key.z != target.z) && currPos < length)
+				|| listArr[currPos].key.z != target.z))
 		{
 			currPos++;
 		}
+
+		// Every entry up to currPos was compared, or every entry if it was not found
+		INSTRUMENT_ADD(LIST_FIND_COMPARES, currPos < length ? currPos + 1 : length);
+
 		// Decrement currPos if the item was not found, so that currPos does not go out of bounds
-		if (currPos > length)	// Christian Siletti
+		if (currPos >= length)
+		{
 			currPos--;
+			return false;
+		}
 
-		return (listArr[currPos].key.x == target.x && listArr[currPos].key.y == target.y
-			&& listArr[currPos].key.z == target.z);
+		return true;
 	}
 } //end Find
 
@@ -131,7 +216,13 @@ void ListClass::Insert(/*in*/ ItemRec newItem)  //item to insert
 {
 	if (!IsFull())
 	{
-		listArr[length] = newItem;
+		INSTRUMENT_COUNT(LIST_INSERTS);
+
+		listArr.push_back(newItem);
+
+		if (indexed)
+			IndexInsert(length);
+
 		length++;
 	}
 	else
@@ -150,11 +241,22 @@ void ListClass::Delete()
 {
 	if (!IsEmpty())
 	{
+		// Unindex the deleted entry, the last entry takes its position
+		if (indexed)
+		{
+			IndexRemove(IndexSlot(listArr[currPos].key));
+
+			if (currPos != length - 1)
+				indexTable[IndexSlot(listArr[length - 1].key)] = currPos;
+		}
+
 		listArr[currPos] = listArr[length - 1];
+		listArr.pop_back();
 		length--;
 
 		// Check to see if the last item was deleted, to decrement currPos aswell
-		if (currPos > length)	// Christian Siletti
+		// The slot past the end no longer exists, so currPos must stay below length
+		if (currPos >= length && currPos > FIRST_POSITION)
 			currPos--;
 	}
 	else
@@ -171,6 +273,10 @@ void ListClass::Clear()
 {
 	length = EMPTY;
 	currPos = FIRST_POSITION;
+	listArr.clear();	// Capacity is kept for the next use
+
+	if (indexed)
+		indexTable.assign(indexTable.size(), NO_POSITION);
 
 } //end Clear
 
@@ -188,12 +294,169 @@ int ListClass::GetLength() const
 //************************************************************************
 //Pre: orig contains a list to be copied
 //Post: applying list contains a copy of orig
-void ListClass::operator = (const ListClass& orig)
+ListClass& ListClass::operator = (const ListClass& orig)
 //creates deep copy of orig
 {
-	for (int i = 0; i < orig.length; i++)
-		listArr[i] = orig.listArr[i];
+	// Only the entries orig holds are copied
+	maxEntries = orig.maxEntries;
+	listArr = orig.listArr;
 	currPos = orig.currPos;
 	length = orig.length;
+	indexed = orig.indexed;
+	indexMask = orig.indexMask;
+	indexTable = orig.indexTable;
+
+	return *this;
 
 }//end operator =
+
+//************************************************************************
+
+//Pre: orig contains a list
+//Post: applying list holds what orig held, orig is empty
+ListClass& ListClass::operator = (ListClass&& orig) noexcept
+//takes the entries of orig
+{
+	if (this != &orig)
+	{
+		Swap(orig);
+		orig.Clear();
+	}
+
+	return *this;
+
+}//end move operator =
+
+//************************************************************************
+
+//Pre: Both lists exist
+//Post: each list holds what the other held
+void ListClass::Swap(/* in/out */ ListClass& other) noexcept	//List to exchange with
+//exchanges the contents of two lists
+{
+	swap(length, other.length);
+	swap(currPos, other.currPos);
+	swap(maxEntries, other.maxEntries);
+	swap(indexed, other.indexed);
+	swap(indexMask, other.indexMask);
+	listArr.swap(other.listArr);
+	indexTable.swap(other.indexTable);
+
+}//end Swap
+
+//************************************************************************
+
+//Pre: List exists, every key within the list is unique
+//Post: Find runs in constant time, Insert, Delete, Clear and
+//		operator = keep the index up to date
+void ListClass::EnableIndex()
+//builds the membership index
+{
+	size_t tableSize = MIN_INDEX_SIZE;	// Amount of slots in the index
+
+	if (indexed)
+		return;
+
+	// Keep the index at most half full
+	while (tableSize < (size_t)length * 2)
+		tableSize *= 2;
+
+	indexed = true;
+	BuildIndex(tableSize);
+
+}//end EnableIndex
+
+//************************************************************************
+
+//Pre: List exists. 
+//Post: true is returned if EnableIndex has been called, otherwise false
+bool ListClass::IsIndexed() const
+//returns indexed to client
+{
+	return indexed;
+}//end IsIndexed
+
+//************************************************************************
+
+//Pre: tableSize is a power of two greater than twice the length
+//Post: every entry of the list is indexed
+void ListClass::BuildIndex(/* in */ size_t tableSize)	//Amount of slots, a power of two
+//rebuilds the index
+{
+	indexTable.assign(tableSize, NO_POSITION);
+	indexMask = tableSize - 1;
+
+	for (int i = 0; i < length; i++)
+	{
+		size_t slot = IndexSlot(listArr[i].key);	// Where the entry belongs
+
+		// Only the first of any repeated key is indexed, as a scan would find
+		if (indexTable[slot] == NO_POSITION)
+			indexTable[slot] = i;
+	}
+
+}//end BuildIndex
+
+//************************************************************************
+
+//Pre: The index is built
+//Post: The slot holding target is returned, or the empty slot it belongs in
+size_t ListClass::IndexSlot(/* in */ KeyType target) const	//Key to search for
+//probes the index for target
+{
+	size_t slot = HashKey(target) & indexMask;	// The slot being probed
+
+	while (indexTable[slot] != NO_POSITION && !SameKey(listArr[indexTable[slot]].key, target))
+		slot = (slot + 1) & indexMask;
+
+	return slot;
+
+}//end IndexSlot
+
+//************************************************************************
+
+//Pre: The index is built, the entry at pos is not yet indexed
+//Post: Find of the entry's key gives pos
+void ListClass::IndexInsert(/* in */ int pos)	//Position of the entry
+//indexes the entry at pos
+{
+	size_t slot;	// Where the entry belongs
+
+	// Grow the index before it becomes more than half full
+	if ((size_t)(pos + 1) * 2 > indexTable.size())
+		BuildIndex(indexTable.size() * 2);
+
+	slot = IndexSlot(listArr[pos].key);
+
+	if (indexTable[slot] == NO_POSITION)
+		indexTable[slot] = pos;
+
+}//end IndexInsert
+
+//************************************************************************
+
+//Pre: The index is built, slot holds an entry
+//Post: The slot's entry is no longer indexed, all others still are
+void ListClass::IndexRemove(/* in */ size_t slot)	//Slot being emptied
+//empties slot without breaking any probe sequence
+{
+	size_t next = (slot + 1) & indexMask;	// The slot after the hole
+	size_t home;							// Where the entry in next hashes to
+
+	// Shift back every entry whose probe passed through the hole
+	while (indexTable[next] != NO_POSITION)
+	{
+		home = HashKey(listArr[indexTable[next]].key) & indexMask;
+
+		if (((next - home) & indexMask) >= ((next - slot) & indexMask))
+		{
+			indexTable[slot] = indexTable[next];
+			slot = next;
+		}
+
+		next = (next + 1) & indexMask;
+	}
+
+	indexTable[slot] = NO_POSITION;
+
+}//end IndexRemove
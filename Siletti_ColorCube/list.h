@@ -11,9 +11,12 @@
 //	struct definition for the list should be placed in the file itemrec.h,
 //  therefore no code change need be made within the implementation file 
 //  to change the basic design of a list item. The maximum number of list 
-//  entries it currently handles is 100. It provides the programmer with 
-//	all methods necessary to implement a list. It contains 13 public and
-//  10 protected methods. It also contains 4 private data elements.
+//  entries is chosen at construction and defaults to MAX_ENTRIES, storage grows
+//  with the entries actually inserted. Lists may be moved and swapped without
+//  copying their entries. It provides the programmer with all methods necessary
+//  to implement a list. It contains 20 public and 4 private methods. It also contains 6 private data elements.
+//  A list may optionally keep a membership index, an open addressing hash
+//  from each key to its position, which makes Find constant time.
 //
 //
 //
@@ -27,6 +30,7 @@
 // TO ENSURE PROPER CLASS FUNCTION:
 //(3): On a DELETION, method Find() must be called before using Delete().
 //	   to set currPos must be set to the item to be deleted. 
+//(4): When the membership index is enabled every key within the list is unique
 //
 //
 //EXCEPTION HANDLING/ERROR CHECKING:  
@@ -42,6 +46,15 @@
 //		1 - Updated Find Method to work with the LocationRec
 //		2 - Updated Delete to decrement currPos on deletion of final list element
 //		3 - Updated Find to decrement currPos when the item is not found
+//Later revisions (see the version history for their authors and dates):
+//		4 - The maximum length of the list is chosen at construction so that a
+//			list can hold every cell of a runtime sized cube
+//		5 - Updated Find to check the list bound before comparing keys, so a
+//			missing target is never matched against the slot past the end
+//		6 - Added an optional membership index so Find does not scan the list
+//		7 - Storage grows on demand instead of being sized to maxEntries, added
+//			copy and move construction, move assignment and Swap
+//		8 - Updated Delete to keep currPos below length when the final element is deleted
 //	   
 //
 //                       SUMMARY OF METHODS: 
@@ -50,6 +63,9 @@
 //
 //ListClass();           set private data members length & currPos to zero
 //						
+//ListClass(/*in*/ int maxLength);	sets length & currPos to zero, the list
+//						can hold at most maxLength entries
+//
 //void  FirstPosition(); sets currPos  to beginning of list 
 //void  NextPosition();  sets currPos  to next element in list 
 //void  LastPosition();  sets currPos  to last element in the list
@@ -74,24 +90,52 @@
 //
 //int GetLength();  returns ths number of items in the list. 
 //
-//void operator = (const ListClass& orig); creates a deep copy of orig
+//void EnableIndex();  builds the membership index and keeps it from then on
+//
+//bool IsIndexed();  returns true if the membership index is kept
+//
+//ListClass(/*in*/ const ListClass& orig);  creates a deep copy of orig
+//
+//ListClass(/*in/out*/ ListClass&& orig);  takes the entries of orig, leaving it empty
+//
+//void Swap(/*in/out*/ ListClass& other);  exchanges the contents of two lists
+//
+//ListClass& operator = (const ListClass& orig); creates a deep copy of orig
+//
+//ListClass& operator = (ListClass&& orig); takes the entries of orig, leaving it empty
 // 
 //PRIVATE MEMBERS: 
 //int length;                            //length of list 
 //int currPos;                           //current position in the List
+//int maxEntries;                        //most entries the list can hold
+//bool indexed;                          //true when the membership index is kept
+//size_t indexMask;                      //the index table size minus one
+//
+//vector<ItemRec> listArr				 // List, holds exactly length entries
+//vector<int> indexTable				 // Membership index, positions by key hash
+//
+//PRIVATE METHODS
 //
-//ItemRec listArr[MAX_ENTRIES]			 // List
+//void BuildIndex(/*in*/ size_t tableSize);  rebuilds the index with tableSize slots
+//size_t IndexSlot(/*in*/ KeyType target);   slot holding target, or the empty slot it belongs in
+//void IndexInsert(/*in*/ int pos);          indexes the entry at pos
+//void IndexRemove(/*in*/ size_t slot);      empties an index slot
 
 
+#include <vector>	  // Gives access to the vector holding the list
+#include <climits>	  // Gives access to INT_MAX, the most entries a list can hold
 #include "itemrec.h"  // SUPPLIED BY CLIENT FOR DEFINITION OF CLASS
 					  // CONTAINS LAYOUT OF ELEMENT TO BE STORED IN LIST
 
 #include "ListExceptions.h" // For List Exception Classes
 
 //Constant Declarations 
-const int MAX_ENTRIES = 125;						//max elements in list
+const int MAX_ENTRIES = 125;						//default max elements in list
+const int MAX_LIST_LENGTH = INT_MAX;				//most elements any list can hold, length is an int
 const int FIRST_POSITION = 0;						//list minimum 
 const int EMPTY = 0;								//list empty 
+const int NO_POSITION = -1;							//index slot holding no entry
+const size_t MIN_INDEX_SIZE = 16;					//fewest slots in the index, a power of two
 
 
 // Class Declarations 
@@ -103,6 +147,22 @@ public:
 	//Pre: None 
 	//Post: length & currPos have been initialized to zero.
 
+	ListClass(/* in */ int maxLength);	//Most entries the list can hold
+	//sets private data members length & currPos to zero
+	//Pre: maxLength > 0
+	//Post: length & currPos have been initialized to zero, the list 
+	//		can hold maxLength entries, no entries are allocated yet
+
+	ListClass(/* in */ const ListClass& orig);	//List to copy
+	//creates a deep copy of orig
+	//Pre: orig contains a list to be copied
+	//Post: the new list contains a copy of orig
+
+	ListClass(/* in/out */ ListClass&& orig) noexcept;	//List to take from
+	//takes the entries of orig without copying them
+	//Pre: orig contains a list
+	//Post: the new list holds what orig held, orig is empty
+
 	void FirstPosition();
 	//sets currPos to begining of list 
 	//Pre: List exists 
@@ -126,7 +186,7 @@ public:
 	//Post: if List has no elements true is returned, otherwise false 
 
 	bool IsFull() const;
-	//returns true if List is full(length = MAX_ENTRIES)
+	//returns true if List is full(length = maxEntries)
 	//Pre: List exists 
 	//Post: if List is full, true is returned, otherwise false. 
 
@@ -176,19 +236,64 @@ public:
 	//Pre: List exists. 
 	//Post: Number of elements has been returned 
 
+	void EnableIndex();
+	//builds the membership index and keeps it up to date from then on
+	//Pre: List exists, every key within the list is unique
+	//Post: Find runs in constant time, Insert, Delete, Clear and
+	//		operator = keep the index up to date
+
+	bool IsIndexed() const;
+	//returns true if the membership index is kept
+	//Pre: List exists. 
+	//Post: true is returned if EnableIndex has been called, otherwise false
+
+	void Swap(/* in/out */ ListClass& other) noexcept;	//List to exchange with
+	//exchanges the contents of two lists in constant time
+	//Pre: Both lists exist
+	//Post: each list holds what the other held
+
 	//overloaded operators
-	void operator = (const ListClass& orig);
+	ListClass& operator = (const ListClass& orig);
 	//creates a deep copy of the list
 	//Pre: orig contains a list to be copied
 	//Post: applying list contains a copy of orig
 
+	ListClass& operator = (ListClass&& orig) noexcept;
+	//takes the entries of orig without copying them
+	//Pre: orig contains a list
+	//Post: applying list holds what orig held, orig is empty
+
 
 private:
 	int length;						//length (occupied elements) of list 
 	int currPos;					//specifies current position in list 
+	int maxEntries;					//most entries the list can hold
+	bool indexed;					//true when the membership index is kept
+	size_t indexMask;				//the index table size minus one
+
+	vector<ItemRec> listArr;		// List
+	// Grows with the entries inserted, up to maxEntries
+	vector<int> indexTable;			// Membership index, positions by key hash
+
+	void BuildIndex(/* in */ size_t tableSize);	//Amount of slots, a power of two
+	//rebuilds the index with tableSize slots
+	//Pre: tableSize is a power of two greater than twice the length
+	//Post: every entry of the list is indexed
+
+	size_t IndexSlot(/* in */ KeyType target) const;	//Key to search for
+	//finds the slot of a key within the index
+	//Pre: The index is built
+	//Post: The slot holding target is returned, or the empty slot it belongs in
+
+	void IndexInsert(/* in */ int pos);		//Position of the entry
+	//indexes the entry at pos, growing the index when it is half full
+	//Pre: The index is built, the entry at pos is not yet indexed
+	//Post: Find of the entry's key gives pos
 
-	ItemRec listArr[MAX_ROW * MAX_COL * MAX_DEP];	  // List
-	// Set to largest possible contiguous color - Christian Siletti
+	void IndexRemove(/* in */ size_t slot);	//Slot being emptied
+	//empties a slot, shifting back entries that probed past it
+	//Pre: The index is built, slot holds an entry
+	//Post: The slot's entry is no longer indexed, all others still are
 
 };//end ListClass 
 
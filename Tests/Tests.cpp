@@ -0,0 +1,376 @@
+/*
+	FileName : Tests.cpp
+	Project Color Cuberator
+
+	PURPOSE:
+		To check the parts of the client whose results can not be seen from a single run.
+		Every search of a cube must find the same two largest blocks, and the sizes of blocks
+		must be counted past what an int holds, so that a streamed cube of more than INT_MAX
+		cells is reported as it is.
+
+	INPUT:
+		Everything may be given on the command line:
+			Tests [-large]
+			-large	Also stream a cube of LARGE_EDGE^3 cells, more than INT_MAX, that is a single
+					block. It writes a cube file of about 2 GB and spills of about 10 GB next to it
+
+	PROCESSING:
+		The sizes of labels and of the heap of largest blocks are checked with sizes past INT_MAX
+		Every cube of AGREE_SHAPES is searched with the label search, by runs, with the flood fill,
+		the halo flood and streamed. Each must find the same color and size for the largest and
+		the second largest block as the label search
+		With -large a cube file of one color is written plane by plane and streamed, its single
+		block must hold every cell and only list its first cell
+
+	OUTPUT:
+		A line is displayed for every check, PASS or FAIL with what was found
+		The program ends with 0 if every check passed, otherwise 1
+
+	ASSUMPTIONS:  ******IMPORTANT!!!! READ THESE   ******
+		1 - The tests are built with ContigClient.cpp compiled with CUBE_BENCHMARK defined,
+			so the searches checked are the client's own functions
+		2 - The searches write their output and cube files in the working directory
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1 - If the command line options are not valid a usage message is displayed and the
+			program ends
+		2 - If the large cube file or its spills can not be written the check fails
+
+						   SUMMARY OF FUNCTIONS:
+CheckLabelSizes()
+		- To check that the labels of a union find count past INT_MAX cells
+CheckTopBlocks()
+		- To check that the heap of largest blocks ranks blocks past INT_MAX cells
+CheckSearchesAgree()
+		- To check that every search finds the same two largest blocks of a cube
+RunSearch(*IN*const vector<string>& args)
+		- To search a cube with the options of a command line
+CheckLargeStream()
+		- To check that a streamed cube of more than INT_MAX cells reports its whole block
+Report(*IN*const string& name,
+	   *IN*const bool& passed,
+	   *IN*const string& found)
+		- To display the result of a check
+*/
+#include "ContigClient.h"	// Grants Access to the options and functions of the client
+#include "StreamLabeler.h"	// Grants Access to the Stream Labeler Class
+#include <vector>		// Used to hold the arguments of each search
+#include <sstream>		// Used to describe what a check found
+#include <cstdio>		// Used to remove the cube file
+using namespace std;	// Standard namespace
+
+
+
+// Constants
+const int AGREE_SHAPES[][3] = { { 5, 5, 5 }, { 6, 7, 8 }, { 16, 3, 9 }, { 2, 1, 3 }, { 1, 1, 1 }, { 24, 24, 24 } };	// The cubes every search is run on
+const int AGREE_SHAPE_AMT = 6;			// The amount of cubes in AGREE_SHAPES
+const char* AGREE_SEARCHES[] = { "-runs", "-flood", "-halo", "-stream" };	// The searches held against the label search
+const int AGREE_SEARCH_AMT = 4;			// The amount of searches in AGREE_SEARCHES
+const int LARGE_EDGE = 1291;			// The edge of the streamed cube, 1291^3 is more than INT_MAX
+const string LARGE_FILE_NAME = "Tests.bin";		// The cube file streamed with -large
+
+
+// Struct to contain the two largest blocks a search found
+struct SearchResultRec
+{
+	int largCol;			// The color of the largest contiguous block
+	long long largSize;		// The amount of cells in the largest contiguous block
+	int secLargCol;			// The color of the second largest contiguous block
+	long long secLargSize;	// The amount of cells in the second largest contiguous block
+};
+
+
+
+// Prototypes
+bool CheckLabelSizes();
+bool CheckTopBlocks();
+bool CheckSearchesAgree();
+SearchResultRec RunSearch(/*IN*/const vector<string>&);	// The command line of the search
+bool CheckLargeStream();
+bool Report(/*IN*/const string&,			// The name of the check
+			/*IN*/const bool&,				// If the check passed
+			/*IN*/const string&);			// What the check found
+
+
+
+
+int main(int argc, char* argv[])
+{
+	bool large = false;		// If the cube of more than INT_MAX cells is streamed
+	bool passed = true;		// If every check passed
+
+	if (argc > OFFSET + OFFSET || (argc == OFFSET + OFFSET && strcmp(argv[OFFSET], "-large") != ZERO))
+	{
+		cerr << "Usage: " << argv[ZERO] << " [-large]" << endl;
+		return 1;
+	}
+
+	large = argc == OFFSET + OFFSET;
+
+	passed = CheckLabelSizes() && passed;
+	passed = CheckTopBlocks() && passed;
+	passed = CheckSearchesAgree() && passed;
+
+	if (large)
+		passed = CheckLargeStream() && passed;
+
+	return passed ? 0 : 1;
+
+}// end main
+
+
+
+
+
+// --------------------------------- FUNCTIONS ------------------------------------------
+
+
+//O(1)
+//Purpose: To check that the labels of a union find count past INT_MAX cells
+//Pre: None
+//Post: A label is given INT_MAX cells twice, as a block carried over planes is, and is merged
+//		with a label of one cell. The labels of the root must hold them all, summed as the
+//		labelers sum them. Returns true if they do
+bool CheckLabelSizes()
+{
+	UnionFindClass labels;		// The labels being counted
+	int first;					// The label of the first block
+	int second;					// The label of the second block
+	long long size = ZERO;		// The cells of the merged block
+	long long expected = (long long)INT_MAX + INT_MAX + OFFSET;	// The cells the merged block should hold
+	ostringstream found;		// What was counted
+
+	first = labels.NewLabel(RED, ZERO);
+	second = labels.NewLabel(RED, OFFSET);
+	labels.AddCells(first, INT_MAX);
+	labels.AddCells(first, INT_MAX);
+	labels.AddCell(second);
+	labels.Merge(second, first);
+
+	for (int l = 0; l < labels.GetLabelAmt(); l++)
+		if (labels.FindRoot(l) == labels.FindRoot(first))
+			size += labels.GetSize(l);
+
+	found << size;
+
+	return Report("label sizes past INT_MAX", size == expected, found.str());
+
+}// end CheckLabelSizes
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(1)
+//Purpose: To check that the heap of largest blocks ranks blocks past INT_MAX cells
+//Pre: None
+//Post: Three blocks, two past INT_MAX, are offered to a heap keeping two. The two past
+//		INT_MAX must be kept, the largest first. Returns true if they are
+bool CheckTopBlocks()
+{
+	TopBlocksClass top(OFFSET + OFFSET);	// Keeps the two largest blocks
+	vector<BlockRec> kept;					// The blocks kept, largest first
+	long long sizes[] = { (long long)INT_MAX + OFFSET, 5, 3LL * INT_MAX };	// The sizes offered
+	ostringstream found;					// What was kept
+
+	for (int i = 0; i < 3; i++)
+	{
+		BlockRec block;		// The block offered
+
+		block.type = RED;
+		block.size = sizes[i];
+		block.id = (size_t)i;
+		top.Offer(block);
+	}
+
+	found << top.GetBound();
+	top.TakeSorted(kept);
+
+	for (size_t i = 0; i < kept.size(); i++)
+		found << " " << kept[i].size;
+
+	return Report("top blocks past INT_MAX", kept.size() == 2 && kept[ZERO].size == sizes[2] &&
+				  kept[OFFSET].size == sizes[ZERO], found.str());
+
+}// end CheckTopBlocks
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(S * N^3) : S searches of each cube
+//Purpose: To check that every search finds the same two largest blocks of a cube
+//Pre: The working directory can be written
+//Post: Every cube of AGREE_SHAPES is searched by the label search and every search of
+//		AGREE_SEARCHES, a check is reported for each. Returns true if every search agreed
+bool CheckSearchesAgree()
+{
+	bool passed = true;		// If every search agreed
+
+	for (int i = 0; i < AGREE_SHAPE_AMT; i++)
+	{
+		vector<string> args;	// The command line of the label search
+		SearchResultRec labeled;	// The blocks the label search found
+
+		args.push_back("Tests");
+		for (int j = 0; j < 3; j++)
+			args.push_back(to_string(AGREE_SHAPES[i][j]));
+
+		labeled = RunSearch(args);
+
+		for (int j = 0; j < AGREE_SEARCH_AMT; j++)
+		{
+			vector<string> searchArgs = args;	// The command line of the search
+			SearchResultRec searched;			// The blocks the search found
+			ostringstream name;					// The name of the check
+			ostringstream found;				// What the search found
+
+			searchArgs.push_back(AGREE_SEARCHES[j]);
+			searched = RunSearch(searchArgs);
+
+			name << AGREE_SEARCHES[j] << " agrees on " << args[1] << "x" << args[2] << "x" << args[3];
+			found << searched.largCol << ":" << searched.largSize << " " << searched.secLargCol << ":"
+				  << searched.secLargSize << " against " << labeled.largCol << ":" << labeled.largSize
+				  << " " << labeled.secLargCol << ":" << labeled.secLargSize;
+
+			passed = Report(name.str(), searched.largCol == labeled.largCol &&
+							searched.largSize == labeled.largSize && searched.secLargCol == labeled.secLargCol &&
+							searched.secLargSize == labeled.secLargSize, found.str()) && passed;
+		}
+	}
+
+	return passed;
+
+}// end CheckSearchesAgree
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To search a cube with the options of a command line
+//Pre: The command line is valid, its first argument the program name
+//Post: The cube is populated and searched as the client would, the two largest blocks
+//		it found are returned
+SearchResultRec RunSearch(/*IN*/const vector<string>& args)	// The command line of the search
+{
+	RunOptionsRec options;			// The options of the command line
+	vector<char*> argv;				// The command line as main is given it
+	size_t cellAmt;					// The amount of cells in the cube
+	ColorArr colorArr;				// The amount of each color, and the amount checked
+	vector<BlockRec> topBlocks;		// The largest blocks asked for with -top
+	vector<BlockRec> recolorBlocks;	// The largest blocks after -recolor
+	BlockShapesRec shapes;			// The shapes measured with -geometry
+	SearchResultRec result;			// The blocks found
+
+	for (size_t i = 0; i < args.size(); i++)
+		argv.push_back(const_cast<char*>(args[i].c_str()));
+
+	ReadArguments((int)argv.size(), argv.data(), options);
+
+	cellAmt = (size_t)options.rows * options.cols * options.deps;
+	ListClass largContigList((int)min(cellAmt, (size_t)MAX_LIST_LENGTH));	// The cells of the largest block
+	ListClass secLargContigList((int)min(cellAmt, (size_t)MAX_LIST_LENGTH));	// The cells of the second largest block
+
+	InitializeColorArray(colorArr, options.palette.GetColorAmt());
+	result.largCol = RED;
+	result.secLargCol = RED;
+
+	if (options.search == STREAM_SEARCH)
+		StreamSearch(options, colorArr, largContigList, secLargContigList, result.largCol, result.secLargCol,
+					 result.largSize, result.secLargSize, topBlocks);
+	else
+	{
+		MemorySearch(options, colorArr, largContigList, secLargContigList, result.largCol, result.secLargCol,
+					 topBlocks, recolorBlocks, shapes);
+		result.largSize = largContigList.GetLength();
+		result.secLargSize = secLargContigList.GetLength();
+	}
+
+	return result;
+
+}// end RunSearch
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(N^3)
+//Purpose: To check that a streamed cube of more than INT_MAX cells reports its whole block
+//Pre: There is room in the working directory for the cube file and its spills
+//Post: A cube of LARGE_EDGE^3 cells of one color is written and streamed. Its single block
+//		must hold every cell, and gathered it must list only its first cell. The cube file
+//		is removed. Returns true if it does
+bool CheckLargeStream()
+{
+	size_t cellAmt = (size_t)LARGE_EDGE * LARGE_EDGE * LARGE_EDGE;	// The amount of cells in the cube
+	vector<int> plane((size_t)LARGE_EDGE * LARGE_EDGE, RED);	// Every plane of the cube
+	vector<BlockRec> blocks;		// Every block closed
+	ostringstream found;			// What was streamed
+	bool passed;					// If the block held every cell
+
+	try
+	{
+		CubeFileWriterClass writer(LARGE_FILE_NAME, LARGE_EDGE, LARGE_EDGE, LARGE_EDGE, PaletteClass().GetNames());	// Writes the cube
+
+		for (int i = 0; i < LARGE_EDGE; i++)
+			writer.WritePlane(plane.data());
+		writer.Close();
+
+		{
+			StreamLabelerClass labeler;	// Streams the cube file
+
+			labeler.Label(LARGE_FILE_NAME, [&](const ComponentRec& comp)
+			{
+				BlockRec block;		// The closed block
+
+				block.type = comp.type;
+				block.size = comp.size;
+				block.id = ScanOrder(comp.firstCell, LARGE_EDGE, LARGE_EDGE);
+				blocks.push_back(move(block));
+			});
+
+			labeler.GatherCells(blocks);
+		}
+
+		found << blocks.size() << " blocks";
+		if (!blocks.empty())
+			found << ", " << blocks[ZERO].size << " cells of " << cellAmt << ", " << blocks[ZERO].cells.GetLength() << " listed";
+
+		passed = blocks.size() == OFFSET && blocks[ZERO].size == (long long)cellAmt &&
+				 blocks[ZERO].size > INT_MAX && blocks[ZERO].cells.GetLength() == OFFSET;
+	}
+	catch (CubeFileException)
+	{
+		found << "CubeFileException";
+		passed = false;
+	}
+
+	remove(LARGE_FILE_NAME.c_str());
+
+	return Report("stream of " + to_string(cellAmt) + " cells", passed, found.str());
+
+}// end CheckLargeStream
+
+
+// --------------------------------------------------------------------------------------
+
+
+//O(1)
+//Purpose: To display the result of a check
+//Pre: The name of the check, if it passed and what it found
+//Post: PASS or FAIL is displayed with the name, and what was found if it failed.
+//		Returns if the check passed
+bool Report(/*IN*/const string& name,		// The name of the check
+			/*IN*/const bool& passed,		// If the check passed
+			/*IN*/const string& found)		// What the check found
+{
+	if (passed)
+		cout << "PASS " << name << endl;
+	else
+		cout << "FAIL " << name << ": " << found << endl;
+
+	return passed;
+
+}// end Report